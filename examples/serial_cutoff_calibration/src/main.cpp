@@ -0,0 +1,112 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+// oneDPL headers should be included before standard headers
+#include <oneapi/dpl/execution>
+#include <oneapi/dpl/algorithm>
+#include <oneapi/dpl/numeric>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+using value_t = std::int32_t;
+
+// Sizes of the data measured, in bytes
+const std::size_t min_bytes = 256;
+const std::size_t max_bytes = std::size_t(4) << 20;
+
+// Median time of a call in nanoseconds
+template <typename Call>
+double median_time(Call call) {
+  const int repetitions = 31;
+  std::vector<double> times(repetitions);
+  call();  // warm up the caches and the threads
+  for (auto& t : times) {
+    auto start = std::chrono::steady_clock::now();
+    call();
+    auto stop = std::chrono::steady_clock::now();
+    t = std::chrono::duration<double, std::nano>(stop - start).count();
+  }
+  std::nth_element(times.begin(), times.begin() + repetitions / 2, times.end());
+  return times[repetitions / 2];
+}
+
+// Smallest data size from which the parallel policy is faster than the
+// sequential one for every larger size measured
+template <typename Loop>
+std::size_t measure_cutoff(const char* name, Loop loop) {
+  std::vector<value_t> data(max_bytes / sizeof(value_t), 1);
+  std::vector<value_t> out(data.size());
+  std::size_t cutoff = max_bytes;
+  std::cout << "# " << name << ": bytes, seq ns, par ns" << std::endl;
+  for (std::size_t bytes = max_bytes; bytes >= min_bytes; bytes /= 2) {
+    const std::size_t n = bytes / sizeof(value_t);
+    const double seq = median_time([&] {
+      loop(oneapi::dpl::execution::seq, data.begin(), data.begin() + n,
+           out.begin());
+    });
+    const double par = median_time([&] {
+      loop(oneapi::dpl::execution::par, data.begin(), data.begin() + n,
+           out.begin());
+    });
+    std::cout << "#   " << bytes << ", " << seq << ", " << par << std::endl;
+    if (par >= seq) break;
+    cutoff = bytes;
+  }
+  return cutoff;
+}
+
+int main() {
+  // The cutoffs are read at the first call of an algorithm, so disable them
+  // first to measure the parallel loops at every size
+  for (const char* name :
+       {"ONEDPL_SERIAL_CUTOFF_FOR", "ONEDPL_SERIAL_CUTOFF_REDUCE",
+        "ONEDPL_SERIAL_CUTOFF_SCAN"}) {
+#if _WIN32
+    _putenv_s(name, "0");
+#else
+    setenv(name, "0", 1);
+#endif
+  }
+
+  const std::size_t for_cutoff = measure_cutoff(
+      "for_each", [](auto&& policy, auto first, auto last, auto) {
+        std::for_each(policy, first, last, [](value_t& x) { x += 1; });
+      });
+  const std::size_t reduce_cutoff = measure_cutoff(
+      "reduce", [](auto&& policy, auto first, auto last, auto) {
+        volatile value_t sink = std::reduce(policy, first, last);
+        (void)sink;
+      });
+  const std::size_t scan_cutoff = measure_cutoff(
+      "inclusive_scan", [](auto&& policy, auto first, auto last, auto out) {
+        std::inclusive_scan(policy, first, last, out);
+      });
+
+  std::cout << "export ONEDPL_SERIAL_CUTOFF_FOR=" << for_cutoff << std::endl
+            << "export ONEDPL_SERIAL_CUTOFF_REDUCE=" << reduce_cutoff
+            << std::endl
+            << "export ONEDPL_SERIAL_CUTOFF_SCAN=" << scan_cutoff << std::endl;
+  std::cout << "#define ONEDPL_SERIAL_CUTOFF_FOR " << for_cutoff << std::endl
+            << "#define ONEDPL_SERIAL_CUTOFF_REDUCE " << reduce_cutoff
+            << std::endl
+            << "#define ONEDPL_SERIAL_CUTOFF_SCAN " << scan_cutoff
+            << std::endl;
+  return 0;
+}
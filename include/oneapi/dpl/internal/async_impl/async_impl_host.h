@@ -0,0 +1,115 @@
+/*
+ *  Copyright (c) Intel Corporation
+ *
+ *  Licensed under the Apache License, Version 2.0 (the "License");
+ *  you may not use this file except in compliance with the License.
+ *  You may obtain a copy of the License at
+ *
+ *      http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *  Unless required by applicable law or agreed to in writing, software
+ *  distributed under the License is distributed on an "AS IS" BASIS,
+ *  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *  See the License for the specific language governing permissions and
+ *  limitations under the License.
+ */
+
+#ifndef _ONEDPL_ASYNC_IMPL_HOST_H
+#define _ONEDPL_ASYNC_IMPL_HOST_H
+
+#include <future>
+#include <type_traits>
+#include <utility>
+
+#include "oneapi/dpl/pstl/execution_defs.h"
+#include "oneapi/dpl/pstl/execution_impl.h"
+#include "oneapi/dpl/pstl/parallel_backend.h"
+
+namespace oneapi
+{
+namespace dpl
+{
+namespace __internal
+{
+
+// The future-like object returned by the asynchronous algorithms with a host policy. It may be copied,
+// and every copy may be waited for, or passed as a dependency of another asynchronous algorithm.
+template <typename _Tp>
+class __host_future
+{
+    ::std::shared_future<_Tp> _M_future;
+
+  public:
+    explicit __host_future(::std::future<_Tp> __future) : _M_future(__future.share()) {}
+
+    void
+    wait() const
+    {
+        _M_future.wait();
+    }
+
+    _Tp
+    get() const
+    {
+        return _M_future.get();
+    }
+};
+
+template <typename _T>
+struct __is_host_future : ::std::false_type
+{
+};
+
+template <typename _Tp>
+struct __is_host_future<__host_future<_Tp>> : ::std::true_type
+{
+};
+
+// Extension: check if parameter pack consists of host futures
+template <class... _Ts>
+inline constexpr bool __is_host_future_v = (__is_host_future<::std::decay_t<_Ts>>::value && ...);
+
+template <typename _T, typename... _Ts>
+using __enable_if_host_futures = ::std::enable_if_t<(sizeof...(_Ts) > 0) && __is_host_future_v<_Ts...>, _T>;
+
+// Extension: execution policies type traits of the asynchronous algorithms
+template <typename _ExecPolicy, typename _T, typename... _Events>
+using __enable_if_host_execution_policy_async =
+    ::std::enable_if_t<__is_host_execution_policy<::std::decay_t<_ExecPolicy>>::value && __is_host_future_v<_Events...>,
+                       _T>;
+
+template <typename _ExecPolicy, typename _T, typename _Op1, typename... _Events>
+using __enable_if_host_execution_policy_async_single_no_default =
+    ::std::enable_if_t<__is_host_execution_policy<::std::decay_t<_ExecPolicy>>::value && !__is_host_future_v<_Op1> &&
+                           __is_host_future_v<_Events...>,
+                       _T>;
+
+template <typename _ExecPolicy, typename _T, typename _Op1, typename _Op2, typename... _Events>
+using __enable_if_host_execution_policy_async_double_no_default =
+    ::std::enable_if_t<__is_host_execution_policy<::std::decay_t<_ExecPolicy>>::value && !__is_host_future_v<_Op1> &&
+                           !__is_host_future_v<_Op2> && __is_host_future_v<_Events...>,
+                       _T>;
+
+template <typename... _Events>
+void
+__wait_for_host_futures(const _Events&... __dependencies)
+{
+    (__dependencies.wait(), ...);
+}
+
+// Submits __f to the parallel backend. The dependencies are waited for by the caller, as for the device
+// policies, so that no task of the backend blocks on another one.
+template <typename _ExecutionPolicy, typename _Fp, typename... _Events>
+__host_future<::std::invoke_result_t<_Fp&>>
+__submit_async(_ExecutionPolicy&& __exec, _Fp __f, const _Events&... __dependencies)
+{
+    __internal::__wait_for_host_futures(__dependencies...);
+    return __host_future<::std::invoke_result_t<_Fp&>>(__par_backend::__parallel_async(
+        __par_backend_tag{}, ::std::forward<_ExecutionPolicy>(__exec), ::std::move(__f)));
+}
+
+} // namespace __internal
+} // namespace dpl
+} // namespace oneapi
+
+#endif // _ONEDPL_ASYNC_IMPL_HOST_H
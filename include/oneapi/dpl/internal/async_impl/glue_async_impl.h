@@ -17,7 +17,18 @@
 #define _ONEDPL_GLUE_ASYNC_IMPL_H
 
 #include "../async_extension_defs.h"
-#include "async_impl_hetero.h"
+#if _ONEDPL_BACKEND_SYCL
+#    include "async_impl_hetero.h"
+#endif
+#include "async_impl_host.h"
+
+// The host algorithms run in the tasks are instantiated here, whatever the order of the headers
+#include "../../pstl/algorithm_impl.h"
+#include "../../pstl/numeric_impl.h"
+#include "../../pstl/glue_algorithm_defs.h"
+#include "../../pstl/glue_numeric_defs.h"
+#include "../../pstl/glue_algorithm_impl.h"
+#include "../../pstl/glue_numeric_impl.h"
 
 namespace oneapi
 {
@@ -25,6 +36,8 @@ namespace dpl
 {
 namespace experimental
 {
+#if _ONEDPL_BACKEND_SYCL
+
 // [wait_for_all]
 template <typename... _Ts>
 oneapi::dpl::__internal::__enable_if_convertible_to_events<void, _Ts...>
@@ -358,6 +371,285 @@ transform_inclusive_scan_async(_ExecutionPolicy&& __exec, _ForwardIt1 __first1,
                                                                    /*inclusive=*/::std::true_type());
 }
 
+#endif // _ONEDPL_BACKEND_SYCL
+
+// Host policies: the algorithm runs as a task of the parallel backend
+
+// [wait_for_all]
+template <typename... _Ts>
+oneapi::dpl::__internal::__enable_if_host_futures<void, _Ts...>
+wait_for_all(_Ts&&... __events)
+{
+    oneapi::dpl::__internal::__wait_for_host_futures(__events...);
+}
+
+// [async.transform]
+template <class _ExecutionPolicy, class _ForwardIterator1, class _ForwardIterator2, class _UnaryOperation,
+          class... _Events,
+          oneapi::dpl::__internal::__enable_if_host_execution_policy_async<_ExecutionPolicy, int, _Events...>>
+auto
+transform_async(_ExecutionPolicy&& __exec, _ForwardIterator1 __first, _ForwardIterator1 __last,
+                _ForwardIterator2 __result, _UnaryOperation __op, _Events&&... __dependencies)
+{
+    return oneapi::dpl::__internal::__submit_async(
+        __exec, [=]() { return oneapi::dpl::transform(__exec, __first, __last, __result, __op); }, __dependencies...);
+}
+
+template <class _ExecutionPolicy, class _ForwardIterator1, class _ForwardIterator2, class _ForwardIterator,
+          class _BinaryOperation, class... _Events,
+          oneapi::dpl::__internal::__enable_if_host_execution_policy_async_single_no_default<
+              _ExecutionPolicy, int, _BinaryOperation, _Events...>>
+auto
+transform_async(_ExecutionPolicy&& __exec, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
+                _ForwardIterator2 __first2, _ForwardIterator __result, _BinaryOperation __op,
+                _Events&&... __dependencies)
+{
+    return oneapi::dpl::__internal::__submit_async(
+        __exec, [=]() { return oneapi::dpl::transform(__exec, __first1, __last1, __first2, __result, __op); },
+        __dependencies...);
+}
+
+// [async.copy]
+template <class _ExecutionPolicy, class _ForwardIterator1, class _ForwardIterator2, class... _Events,
+          oneapi::dpl::__internal::__enable_if_host_execution_policy_async<_ExecutionPolicy, int, _Events...>>
+auto
+copy_async(_ExecutionPolicy&& __exec, _ForwardIterator1 __first, _ForwardIterator1 __last, _ForwardIterator2 __result,
+           _Events&&... __dependencies)
+{
+    return oneapi::dpl::__internal::__submit_async(
+        __exec, [=]() { return oneapi::dpl::copy(__exec, __first, __last, __result); }, __dependencies...);
+}
+
+// [async.sort]
+template <class _ExecutionPolicy, class _RandomAccessIterator, class _Compare, class... _Events,
+          oneapi::dpl::__internal::__enable_if_host_execution_policy_async_single_no_default<
+              _ExecutionPolicy, int, _Compare, _Events...>>
+auto
+sort_async(_ExecutionPolicy&& __exec, _RandomAccessIterator __first, _RandomAccessIterator __last, _Compare __comp,
+           _Events&&... __dependencies)
+{
+    return oneapi::dpl::__internal::__submit_async(
+        __exec, [=]() { return oneapi::dpl::sort(__exec, __first, __last, __comp); }, __dependencies...);
+}
+
+template <class _ExecutionPolicy, class _RandomAccessIterator, class... _Events,
+          oneapi::dpl::__internal::__enable_if_host_execution_policy_async<_ExecutionPolicy, int, _Events...>>
+auto
+sort_async(_ExecutionPolicy&& __exec, _RandomAccessIterator __first, _RandomAccessIterator __last,
+           _Events&&... __dependencies)
+{
+    return oneapi::dpl::__internal::__submit_async(
+        __exec, [=]() { return oneapi::dpl::sort(__exec, __first, __last); }, __dependencies...);
+}
+
+// [async.for_each]
+template <class _ExecutionPolicy, class _ForwardIterator, class _Function, class... _Events,
+          oneapi::dpl::__internal::__enable_if_host_execution_policy_async<_ExecutionPolicy, int, _Events...>>
+auto
+for_each_async(_ExecutionPolicy&& __exec, _ForwardIterator __first, _ForwardIterator __last, _Function __f,
+               _Events&&... __dependencies)
+{
+    return oneapi::dpl::__internal::__submit_async(
+        __exec, [=]() { return oneapi::dpl::for_each(__exec, __first, __last, __f); }, __dependencies...);
+}
+
+// [async.reduce]
+template <class _ExecutionPolicy, class _ForwardIterator, class _Tp, class _BinaryOperation, class... _Events,
+          oneapi::dpl::__internal::__enable_if_host_execution_policy_async_double_no_default<
+              _ExecutionPolicy, int, _Tp, _BinaryOperation, _Events...>>
+auto
+reduce_async(_ExecutionPolicy&& __exec, _ForwardIterator __first, _ForwardIterator __last, _Tp __init,
+             _BinaryOperation __binary_op, _Events&&... __dependencies)
+{
+    return oneapi::dpl::__internal::__submit_async(
+        __exec, [=]() { return oneapi::dpl::reduce(__exec, __first, __last, __init, __binary_op); }, __dependencies...);
+}
+
+template <class _ExecutionPolicy, class _ForwardIt, class... _Events,
+          oneapi::dpl::__internal::__enable_if_host_execution_policy_async<_ExecutionPolicy, int, _Events...>>
+auto
+reduce_async(_ExecutionPolicy&& __exec, _ForwardIt __first, _ForwardIt __last, _Events&&... __dependencies)
+{
+    return oneapi::dpl::__internal::__submit_async(
+        __exec, [=]() { return oneapi::dpl::reduce(__exec, __first, __last); }, __dependencies...);
+}
+
+template <class _ExecutionPolicy, class _ForwardIt, class _T, class... _Events,
+          oneapi::dpl::__internal::__enable_if_host_execution_policy_async_single_no_default<
+              _ExecutionPolicy, int, _T, _Events...>>
+auto
+reduce_async(_ExecutionPolicy&& __exec, _ForwardIt __first, _ForwardIt __last, _T __init, _Events&&... __dependencies)
+{
+    return oneapi::dpl::__internal::__submit_async(
+        __exec, [=]() { return oneapi::dpl::reduce(__exec, __first, __last, __init); }, __dependencies...);
+}
+
+// [async.fill]
+template <class _ExecutionPolicy, class _ForwardIterator, class _Tp, class... _Events,
+          oneapi::dpl::__internal::__enable_if_host_execution_policy_async<_ExecutionPolicy, int, _Events...>>
+auto
+fill_async(_ExecutionPolicy&& __exec, _ForwardIterator __first, _ForwardIterator __last, const _Tp& __value,
+           _Events&&... __dependencies)
+{
+    return oneapi::dpl::__internal::__submit_async(
+        __exec, [=]() { return oneapi::dpl::fill(__exec, __first, __last, __value); }, __dependencies...);
+}
+
+// [async.transform_reduce]
+template <class _ExecutionPolicy, class _ForwardIt1, class _ForwardIt2, class _T, class _BinaryOp1, class _BinaryOp2,
+          class... _Events,
+          oneapi::dpl::__internal::__enable_if_host_execution_policy_async_double_no_default<
+              _ExecutionPolicy, int, _BinaryOp1, _BinaryOp2, _Events...>>
+auto
+transform_reduce_async(_ExecutionPolicy&& __exec, _ForwardIt1 __first1, _ForwardIt1 __last1, _ForwardIt2 __first2,
+                       _T __init, _BinaryOp1 __binary_op1, _BinaryOp2 __binary_op2, _Events&&... __dependencies)
+{
+    return oneapi::dpl::__internal::__submit_async(
+        __exec,
+        [=]() {
+            return oneapi::dpl::transform_reduce(__exec, __first1, __last1, __first2, __init, __binary_op1,
+                                                 __binary_op2);
+        },
+        __dependencies...);
+}
+
+template <class _ExecutionPolicy, class _ForwardIt, class _T, class _BinaryOp, class _UnaryOp, class... _Events,
+          oneapi::dpl::__internal::__enable_if_host_execution_policy_async_single_no_default<
+              _ExecutionPolicy, int, _UnaryOp, _Events...>>
+auto
+transform_reduce_async(_ExecutionPolicy&& __exec, _ForwardIt __first, _ForwardIt __last, _T __init,
+                       _BinaryOp __binary_op, _UnaryOp __unary_op, _Events&&... __dependencies)
+{
+    return oneapi::dpl::__internal::__submit_async(
+        __exec,
+        [=]() {
+            return oneapi::dpl::transform_reduce(__exec, __first, __last, __init, __binary_op, __unary_op);
+        },
+        __dependencies...);
+}
+
+template <class _ExecutionPolicy, class _ForwardIt1, class _ForwardIt2, class _T, class... _Events,
+          oneapi::dpl::__internal::__enable_if_host_execution_policy_async<_ExecutionPolicy, int, _Events...>>
+auto
+transform_reduce_async(_ExecutionPolicy&& __exec, _ForwardIt1 __first1, _ForwardIt1 __last1, _ForwardIt2 __first2,
+                       _T __init, _Events&&... __dependencies)
+{
+    return oneapi::dpl::__internal::__submit_async(
+        __exec, [=]() { return oneapi::dpl::transform_reduce(__exec, __first1, __last1, __first2, __init); },
+        __dependencies...);
+}
+
+// [async.scan]
+template <class _ExecutionPolicy, class _ForwardIt1, class _ForwardIt2, class... _Events,
+          oneapi::dpl::__internal::__enable_if_host_execution_policy_async<_ExecutionPolicy, int, _Events...>>
+auto
+inclusive_scan_async(_ExecutionPolicy&& __exec, _ForwardIt1 __first1, _ForwardIt1 __last1, _ForwardIt2 __first2,
+                     _Events&&... __dependencies)
+{
+    return oneapi::dpl::__internal::__submit_async(
+        __exec, [=]() { return oneapi::dpl::inclusive_scan(__exec, __first1, __last1, __first2); }, __dependencies...);
+}
+
+template <class _ExecutionPolicy, class _ForwardIt1, class _ForwardIt2, class _BinaryOperation, class... _Events,
+          oneapi::dpl::__internal::__enable_if_host_execution_policy_async_single_no_default<
+              _ExecutionPolicy, int, _BinaryOperation, _Events...>>
+auto
+inclusive_scan_async(_ExecutionPolicy&& __exec, _ForwardIt1 __first1, _ForwardIt1 __last1, _ForwardIt2 __first2,
+                     _BinaryOperation __binary_op, _Events&&... __dependencies)
+{
+    return oneapi::dpl::__internal::__submit_async(
+        __exec, [=]() { return oneapi::dpl::inclusive_scan(__exec, __first1, __last1, __first2, __binary_op); },
+        __dependencies...);
+}
+
+template <class _ExecutionPolicy, class _ForwardIt1, class _ForwardIt2, class _BinaryOperation, class _T,
+          class... _Events,
+          oneapi::dpl::__internal::__enable_if_host_execution_policy_async_double_no_default<
+              _ExecutionPolicy, int, _BinaryOperation, _T, _Events...>>
+auto
+inclusive_scan_async(_ExecutionPolicy&& __exec, _ForwardIt1 __first1, _ForwardIt1 __last1, _ForwardIt2 __first2,
+                     _BinaryOperation __binary_op, _T __init, _Events&&... __dependencies)
+{
+    return oneapi::dpl::__internal::__submit_async(
+        __exec, [=]() { return oneapi::dpl::inclusive_scan(__exec, __first1, __last1, __first2, __binary_op, __init); },
+        __dependencies...);
+}
+
+template <class _ExecutionPolicy, class _ForwardIt1, class _ForwardIt2, class _T, class... _Events,
+          oneapi::dpl::__internal::__enable_if_host_execution_policy_async<_ExecutionPolicy, int, _Events...>>
+auto
+exclusive_scan_async(_ExecutionPolicy&& __exec, _ForwardIt1 __first1, _ForwardIt1 __last1, _ForwardIt2 __first2,
+                     _T __init, _Events&&... __dependencies)
+{
+    return oneapi::dpl::__internal::__submit_async(
+        __exec, [=]() { return oneapi::dpl::exclusive_scan(__exec, __first1, __last1, __first2, __init); },
+        __dependencies...);
+}
+
+template <class _ExecutionPolicy, class _ForwardIt1, class _ForwardIt2, class _T, class _BinaryOperation,
+          class... _Events,
+          oneapi::dpl::__internal::__enable_if_host_execution_policy_async_single_no_default<
+              _ExecutionPolicy, int, _BinaryOperation, _Events...>>
+auto
+exclusive_scan_async(_ExecutionPolicy&& __exec, _ForwardIt1 __first1, _ForwardIt1 __last1, _ForwardIt2 __first2,
+                     _T __init, _BinaryOperation __binary_op, _Events&&... __dependencies)
+{
+    return oneapi::dpl::__internal::__submit_async(
+        __exec, [=]() { return oneapi::dpl::exclusive_scan(__exec, __first1, __last1, __first2, __init, __binary_op); },
+        __dependencies...);
+}
+
+template <class _ExecutionPolicy, class _ForwardIt1, class _ForwardIt2, class _T, class _BinaryOperation,
+          class _UnaryOperation, class... _Events,
+          oneapi::dpl::__internal::__enable_if_host_execution_policy_async<_ExecutionPolicy, int, _Events...>>
+auto
+transform_exclusive_scan_async(_ExecutionPolicy&& __exec, _ForwardIt1 __first1, _ForwardIt1 __last1,
+                               _ForwardIt2 __first2, _T __init, _BinaryOperation __binary_op,
+                               _UnaryOperation __unary_op, _Events&&... __dependencies)
+{
+    return oneapi::dpl::__internal::__submit_async(
+        __exec,
+        [=]() {
+            return oneapi::dpl::transform_exclusive_scan(__exec, __first1, __last1, __first2, __init, __binary_op,
+                                                         __unary_op);
+        },
+        __dependencies...);
+}
+
+template <class _ExecutionPolicy, class _ForwardIt1, class _ForwardIt2, class _BinaryOperation, class _UnaryOperation,
+          class... _Events,
+          oneapi::dpl::__internal::__enable_if_host_execution_policy_async<_ExecutionPolicy, int, _Events...>>
+auto
+transform_inclusive_scan_async(_ExecutionPolicy&& __exec, _ForwardIt1 __first1, _ForwardIt1 __last1,
+                               _ForwardIt2 __first2, _BinaryOperation __binary_op, _UnaryOperation __unary_op,
+                               _Events&&... __dependencies)
+{
+    return oneapi::dpl::__internal::__submit_async(
+        __exec,
+        [=]() {
+            return oneapi::dpl::transform_inclusive_scan(__exec, __first1, __last1, __first2, __binary_op, __unary_op);
+        },
+        __dependencies...);
+}
+
+template <class _ExecutionPolicy, class _ForwardIt1, class _ForwardIt2, class _BinaryOperation, class _UnaryOperation,
+          class _T, class... _Events,
+          oneapi::dpl::__internal::__enable_if_host_execution_policy_async_single_no_default<
+              _ExecutionPolicy, int, _T, _Events...>>
+auto
+transform_inclusive_scan_async(_ExecutionPolicy&& __exec, _ForwardIt1 __first1, _ForwardIt1 __last1,
+                               _ForwardIt2 __first2, _BinaryOperation __binary_op, _UnaryOperation __unary_op,
+                               _T __init, _Events&&... __dependencies)
+{
+    return oneapi::dpl::__internal::__submit_async(
+        __exec,
+        [=]() {
+            return oneapi::dpl::transform_inclusive_scan(__exec, __first1, __last1, __first2, __binary_op, __unary_op,
+                                                         __init);
+        },
+        __dependencies...);
+}
+
 } // namespace experimental
 
 } // namespace dpl
@@ -17,6 +17,12 @@
 #ifndef _ONEDPL_BINARY_SEARCH_IMPL_H
 #define _ONEDPL_BINARY_SEARCH_IMPL_H
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
 #include "function.h"
 #include "binary_search_extension_defs.h"
 #include "../pstl/iterator_impl.h"
@@ -80,6 +86,293 @@ struct custom_brick
     }
 };
 
+//------------------------------------------------------------------------
+// Batched search engine for the host policies
+//------------------------------------------------------------------------
+
+// Number of queries processed by one task
+constexpr std::size_t batched_search_chunk_size = 1024;
+// Smaller tables stay hot in cache, so an independent binary search per query is good enough
+constexpr std::size_t eytzinger_min_table_size = std::size_t(1) << 16;
+// The Eytzinger copy of a table is built only if there is at least one query per this number of table elements
+constexpr std::size_t eytzinger_table_to_queries_ratio = 8;
+// Number of queries descending the Eytzinger tree in lock-step, so that their cache misses overlap
+constexpr std::size_t eytzinger_interleave = 8;
+// The subtrees rooted at this level of the Eytzinger tree are laid out in parallel
+constexpr std::size_t eytzinger_parallel_level = 8;
+
+// True if the answer to a query lies to the right of a table element
+template <typename Comp, search_algorithm func>
+struct search_goes_right
+{
+    mutable Comp comp;
+
+    template <typename Elem, typename Value>
+    bool
+    operator()(Elem&& elem, Value&& value) const
+    {
+        if constexpr (func == search_algorithm::upper_bound)
+            return !comp(::std::forward<Value>(value), ::std::forward<Elem>(elem));
+        else
+            return comp(::std::forward<Elem>(elem), ::std::forward<Value>(value));
+    }
+};
+
+template <search_algorithm func, typename InputIterator1, typename Size, typename InputIterator2,
+          typename OutputIterator, typename Comp>
+void
+store_search_result(InputIterator1 start, Size size, Size pos, InputIterator2 value, OutputIterator out, Comp& comp)
+{
+    if constexpr (func == search_algorithm::binary_search)
+        *out = pos != size && !comp(*value, start[pos]);
+    else
+        *out = pos;
+}
+
+// Queries are sorted: the answers are non-decreasing, so each query of a chunk gallops forward from the answer to
+// the previous one instead of searching the whole table. This is a merge of the queries with the table.
+template <search_algorithm func, typename InputIterator1, typename InputIterator2, typename OutputIterator,
+          typename Size, typename Comp>
+void
+sorted_queries_search(InputIterator1 start, Size size, InputIterator2 values, OutputIterator result, Size first,
+                      Size last, Comp comp)
+{
+    const search_goes_right<Comp, func> goes_right{comp};
+
+    Size pos = 0;
+    for (Size q = first; q != last; ++q)
+    {
+        auto&& value = values[q];
+        Size lo = pos;
+        Size hi = pos;
+        // The first query of a chunk has no previous answer, so the gallop degenerates into a plain binary search
+        for (Size step = q == first ? size : 1; hi < size && goes_right(start[hi], value); step *= 2)
+        {
+            lo = hi + 1;
+            hi = ::std::min(size, lo + step - 1);
+        }
+        pos = ::std::partition_point(start + lo, start + hi, [&](auto&& elem) { return goes_right(elem, value); }) -
+              start;
+        store_search_result<func>(start, size, pos, values + q, result + q, comp);
+    }
+}
+
+// Unsorted queries against a small table: an independent binary search per query
+template <search_algorithm func, typename InputIterator1, typename InputIterator2, typename OutputIterator,
+          typename Size, typename Comp>
+void
+independent_queries_search(InputIterator1 start, Size size, InputIterator2 values, OutputIterator result, Size first,
+                           Size last, Comp comp)
+{
+    const search_goes_right<Comp, func> goes_right{comp};
+
+    for (Size q = first; q != last; ++q)
+    {
+        auto&& value = values[q];
+        const Size pos =
+            ::std::partition_point(start, start + size, [&](auto&& elem) { return goes_right(elem, value); }) - start;
+        store_search_result<func>(start, size, pos, values + q, result + q, comp);
+    }
+}
+
+// A copy of a sorted table in the Eytzinger (1-based breadth-first) order together with the original position of
+// each element. The top levels of the tree, which every search visits, are packed into a few cache lines, and
+// the children of a node are adjacent, so a search can prefetch several levels ahead.
+template <typename ValueType>
+struct eytzinger_tree
+{
+    ValueType* tree;
+    std::size_t* index;
+    std::size_t size;
+    std::size_t depth;
+};
+
+// Number of nodes in the subtree rooted at node k of an Eytzinger tree of n nodes
+inline std::size_t
+eytzinger_subtree_size(std::size_t k, std::size_t n)
+{
+    std::size_t count = 0;
+    for (std::size_t first = k, last = k; first <= n; first = 2 * first, last = 2 * last + 1)
+        count += ::std::min(last, n) - first + 1;
+    return count;
+}
+
+// In-order walk of the subtree rooted at node k, which places the sorted elements starting from position pos
+template <typename InputIterator, typename ValueType>
+void
+eytzinger_layout(InputIterator sorted, eytzinger_tree<ValueType> t, std::size_t k, std::size_t& pos)
+{
+    while (k <= t.size)
+    {
+        eytzinger_layout(sorted, t, 2 * k, pos);
+        ::new (t.tree + k) ValueType(sorted[pos]);
+        t.index[k] = pos++;
+        k = 2 * k + 1;
+    }
+}
+
+// Places the nodes above eytzinger_parallel_level and computes the first sorted position of each subtree rooted
+// at that level
+template <typename InputIterator, typename ValueType, typename Roots>
+void
+eytzinger_layout_top(InputIterator sorted, eytzinger_tree<ValueType> t, std::size_t k, std::size_t level,
+                     std::size_t pos, Roots& roots)
+{
+    if (k > t.size)
+        return;
+    if (level == eytzinger_parallel_level)
+    {
+        roots[k - (std::size_t(1) << eytzinger_parallel_level)] = pos;
+        return;
+    }
+    const std::size_t left = eytzinger_subtree_size(2 * k, t.size);
+    ::new (t.tree + k) ValueType(sorted[pos + left]);
+    t.index[k] = pos + left;
+    eytzinger_layout_top(sorted, t, 2 * k, level + 1, pos, roots);
+    eytzinger_layout_top(sorted, t, 2 * k + 1, level + 1, pos + left + 1, roots);
+}
+
+template <typename Policy, typename InputIterator, typename ValueType>
+void
+eytzinger_build(Policy&& policy, InputIterator sorted, eytzinger_tree<ValueType> t)
+{
+    constexpr std::size_t roots_first = std::size_t(1) << eytzinger_parallel_level;
+
+    std::array<std::size_t, roots_first> roots{};
+    eytzinger_layout_top(sorted, t, 1, 0, 0, roots);
+    if (t.size < roots_first)
+        return;
+
+    const std::size_t* roots_pos = roots.data();
+    oneapi::dpl::for_each(::std::forward<Policy>(policy), oneapi::dpl::counting_iterator<std::size_t>(roots_first),
+                          oneapi::dpl::counting_iterator<std::size_t>(::std::min(2 * roots_first, t.size + 1)),
+                          [=](std::size_t k) {
+                              std::size_t pos = roots_pos[k - roots_first];
+                              eytzinger_layout(sorted, t, k, pos);
+                          });
+}
+
+// Number of levels below a node of an Eytzinger tree whose descendants fit into a 64-byte cache line: the
+// descendants at the level d below are 2^d nodes, so it is log2 of the number of values in a line, at least one
+template <typename ValueType>
+constexpr std::size_t
+eytzinger_prefetch_levels()
+{
+    std::size_t levels = 0;
+    for (std::size_t nodes = 64 / sizeof(ValueType); nodes > 1; nodes >>= 1)
+        ++levels;
+    return ::std::max<std::size_t>(levels, 1);
+}
+
+// Branchless descent of eytzinger_interleave queries at a time. The descendants of node k at the level d below
+// are the 2^d adjacent nodes starting from k * 2^d, so each step prefetches the cache line filled by the
+// descendants of the current node eytzinger_prefetch_levels below (four levels for 4-byte, three for 8-byte and
+// two for 12-byte values).
+template <search_algorithm func, typename ValueType, typename InputIterator1, typename InputIterator2,
+          typename OutputIterator, typename Size, typename Comp>
+void
+eytzinger_queries_search(eytzinger_tree<ValueType> t, InputIterator1 start, InputIterator2 values,
+                         OutputIterator result, Size first, Size last, Comp comp)
+{
+    constexpr std::size_t prefetch_levels = eytzinger_prefetch_levels<ValueType>();
+
+    const search_goes_right<Comp, func> goes_right{comp};
+    const std::size_t n = t.size;
+
+    std::size_t node[eytzinger_interleave];
+    for (Size q = first; q < last; q += eytzinger_interleave)
+    {
+        const std::size_t count = ::std::min<std::size_t>(eytzinger_interleave, last - q);
+        for (std::size_t b = 0; b < count; ++b)
+            node[b] = 1;
+
+        // All the levels except the last one are complete, so the descent through them needs no bound checks
+        for (std::size_t level = 1; level < t.depth; ++level)
+        {
+            for (std::size_t b = 0; b < count; ++b)
+            {
+                node[b] = 2 * node[b] + goes_right(t.tree[node[b]], values[q + b]);
+                _ONEDPL_PREFETCH(t.tree + ::std::min(node[b] << prefetch_levels, n));
+            }
+        }
+        for (std::size_t b = 0; b < count; ++b)
+        {
+            // A missing node on the last level is passed on the right, which keeps the final decoding uniform
+            std::size_t k = 2 * node[b] + (node[b] > n || goes_right(t.tree[node[b]], values[q + b]));
+            // Strip the trailing right turns and the last left turn: the remaining prefix addresses the answer
+            while (k & 1)
+                k >>= 1;
+            k >>= 1;
+            const Size pos = k == 0 ? Size(n) : Size(t.index[k]);
+            store_search_result<func>(start, Size(n), pos, values + q + b, result + q + b, comp);
+        }
+    }
+}
+
+template <search_algorithm func, typename Policy, typename InputIterator1, typename InputIterator2,
+          typename OutputIterator, typename StrictWeakOrdering>
+OutputIterator
+batched_search_impl(Policy&& policy, InputIterator1 start, InputIterator1 end, InputIterator2 value_start,
+                    InputIterator2 value_end, OutputIterator result, StrictWeakOrdering comp)
+{
+    using Size = typename ::std::iterator_traits<InputIterator1>::difference_type;
+    using ValueType = typename ::std::iterator_traits<InputIterator1>::value_type;
+    using QueryType = typename ::std::iterator_traits<InputIterator2>::value_type;
+
+    const Size size = end - start;
+    const Size value_size = value_end - value_start;
+    if (value_size <= 0)
+        return result;
+
+    const Size chunks = (value_size - 1) / Size(batched_search_chunk_size) + 1;
+    auto for_each_chunk = [&policy, value_size, chunks](auto brick) {
+        oneapi::dpl::for_each(policy, oneapi::dpl::counting_iterator<Size>(0),
+                              oneapi::dpl::counting_iterator<Size>(chunks), [=](Size chunk) {
+                                  const Size first = chunk * Size(batched_search_chunk_size);
+                                  brick(first, ::std::min(value_size, first + Size(batched_search_chunk_size)));
+                              });
+    };
+
+    // Sortedness of the queries is only checked when the comparator is known to accept two queries
+    if constexpr (::std::is_same_v<ValueType, QueryType>)
+    {
+        if (value_size > 1 && oneapi::dpl::is_sorted(policy, value_start, value_end, comp))
+        {
+            for_each_chunk([=](Size first, Size last) {
+                sorted_queries_search<func>(start, size, value_start, result, first, last, comp);
+            });
+            return result + value_size;
+        }
+    }
+
+    if constexpr (::std::is_trivially_copyable_v<ValueType>)
+    {
+        if (std::size_t(size) >= eytzinger_min_table_size &&
+            std::size_t(value_size) * eytzinger_table_to_queries_ratio >= std::size_t(size))
+        {
+            const std::size_t n = size;
+            oneapi::dpl::__par_backend::__buffer<Policy, ValueType> tree_buf(policy, n + 1);
+            oneapi::dpl::__par_backend::__buffer<Policy, std::size_t> index_buf(policy, n + 1);
+
+            std::size_t depth = 0;
+            for (std::size_t k = n; k > 0; k >>= 1)
+                ++depth;
+            const eytzinger_tree<ValueType> t{tree_buf.get(), index_buf.get(), n, depth};
+
+            eytzinger_build(policy, start, t);
+            for_each_chunk([=](Size first, Size last) {
+                eytzinger_queries_search<func>(t, start, value_start, result, first, last, comp);
+            });
+            return result + value_size;
+        }
+    }
+
+    for_each_chunk([=](Size first, Size last) {
+        independent_queries_search<func>(start, size, value_start, result, first, last, comp);
+    });
+    return result + value_size;
+}
+
 template <class _Tag, typename Policy, typename InputIterator1, typename InputIterator2, typename OutputIterator,
           typename StrictWeakOrdering>
 OutputIterator
@@ -88,10 +381,14 @@ lower_bound_impl(_Tag, Policy&& policy, InputIterator1 start, InputIterator1 end
 {
     static_assert(__internal::__is_host_dispatch_tag_v<_Tag>);
 
-    return oneapi::dpl::transform(policy, value_start, value_end, result,
-                                  [=](typename ::std::iterator_traits<InputIterator2>::reference val) {
-                                      return ::std::lower_bound(start, end, val, comp) - start;
-                                  });
+    if constexpr (__internal::__is_random_access_iterator_v<InputIterator1, InputIterator2, OutputIterator>)
+        return batched_search_impl<search_algorithm::lower_bound>(::std::forward<Policy>(policy), start, end,
+                                                                  value_start, value_end, result, comp);
+    else
+        return oneapi::dpl::transform(policy, value_start, value_end, result,
+                                      [=](typename ::std::iterator_traits<InputIterator2>::reference val) {
+                                          return ::std::lower_bound(start, end, val, comp) - start;
+                                      });
 }
 
 template <class _Tag, typename Policy, typename InputIterator1, typename InputIterator2, typename OutputIterator,
@@ -102,10 +399,14 @@ upper_bound_impl(_Tag, Policy&& policy, InputIterator1 start, InputIterator1 end
 {
     static_assert(__internal::__is_host_dispatch_tag_v<_Tag>);
 
-    return oneapi::dpl::transform(policy, value_start, value_end, result,
-                                  [=](typename ::std::iterator_traits<InputIterator2>::reference val) {
-                                      return ::std::upper_bound(start, end, val, comp) - start;
-                                  });
+    if constexpr (__internal::__is_random_access_iterator_v<InputIterator1, InputIterator2, OutputIterator>)
+        return batched_search_impl<search_algorithm::upper_bound>(::std::forward<Policy>(policy), start, end,
+                                                                  value_start, value_end, result, comp);
+    else
+        return oneapi::dpl::transform(policy, value_start, value_end, result,
+                                      [=](typename ::std::iterator_traits<InputIterator2>::reference val) {
+                                          return ::std::upper_bound(start, end, val, comp) - start;
+                                      });
 }
 
 template <class _Tag, typename Policy, typename InputIterator1, typename InputIterator2, typename OutputIterator,
@@ -116,10 +417,14 @@ binary_search_impl(_Tag, Policy&& policy, InputIterator1 start, InputIterator1 e
 {
     static_assert(__internal::__is_host_dispatch_tag_v<_Tag>);
 
-    return oneapi::dpl::transform(policy, value_start, value_end, result,
-                                  [=](typename ::std::iterator_traits<InputIterator2>::reference val) {
-                                      return ::std::binary_search(start, end, val, comp);
-                                  });
+    if constexpr (__internal::__is_random_access_iterator_v<InputIterator1, InputIterator2, OutputIterator>)
+        return batched_search_impl<search_algorithm::binary_search>(::std::forward<Policy>(policy), start, end,
+                                                                    value_start, value_end, result, comp);
+    else
+        return oneapi::dpl::transform(policy, value_start, value_end, result,
+                                      [=](typename ::std::iterator_traits<InputIterator2>::reference val) {
+                                          return ::std::binary_search(start, end, val, comp);
+                                      });
 }
 
 #if _ONEDPL_BACKEND_SYCL
@@ -26,6 +26,8 @@
 #include "oneapi/dpl/internal/dynamic_selection_impl/backend_traits.h"
 #if _DS_BACKEND_SYCL != 0
 #    include "oneapi/dpl/internal/dynamic_selection_impl/sycl_backend.h"
+#else
+#    include "oneapi/dpl/internal/dynamic_selection_impl/host_backend.h"
 #endif
 
 namespace oneapi
@@ -38,7 +40,7 @@ namespace experimental
 #if _DS_BACKEND_SYCL != 0
 template <typename Backend = sycl_backend, typename... KeyArgs>
 #else
-template <typename Backend, typename... KeyArgs>
+template <typename Backend = host_backend<>, typename... KeyArgs>
 #endif
 class auto_tune_policy
 {
@@ -22,6 +22,8 @@
 #include "oneapi/dpl/internal/dynamic_selection_impl/backend_traits.h"
 #if _DS_BACKEND_SYCL != 0
 #    include "oneapi/dpl/internal/dynamic_selection_impl/sycl_backend.h"
+#else
+#    include "oneapi/dpl/internal/dynamic_selection_impl/host_backend.h"
 #endif
 
 namespace oneapi
@@ -34,7 +36,7 @@ namespace experimental
 #if _DS_BACKEND_SYCL != 0
 template <typename Backend = sycl_backend>
 #else
-template <typename Backend>
+template <typename Backend = host_backend<>>
 #endif
 struct dynamic_load_policy
 {
@@ -0,0 +1,405 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_HOST_BACKEND_IMPL_H
+#define _ONEDPL_HOST_BACKEND_IMPL_H
+
+#include "oneapi/dpl/internal/dynamic_selection_traits.h"
+
+#include "oneapi/dpl/internal/dynamic_selection_impl/scoring_policy_defs.h"
+#include "oneapi/dpl/pstl/parallel_backend.h"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#if _ONEDPL_PAR_BACKEND_TBB
+#    include <tbb/task_arena.h>
+#    if __has_include(<tbb/info.h>)
+#        include <tbb/info.h>
+#        define _DS_BACKEND_HOST_TBB_NUMA 1
+#    endif
+#endif
+
+namespace oneapi
+{
+namespace dpl
+{
+namespace experimental
+{
+
+// A fixed set of threads running the enqueued tasks in the order of submission. It is the resource of host_backend
+// when oneTBB is not the parallel backend of oneDPL.
+class host_thread_pool
+{
+    struct state_t
+    {
+        std::mutex m_;
+        std::condition_variable cv_;
+        std::deque<std::function<void()>> tasks_;
+        bool stop_ = false;
+    };
+
+    std::shared_ptr<state_t> state_;
+    std::vector<std::thread> threads_;
+
+    // the queued tasks are run before the thread exits
+    static void
+    run(std::shared_ptr<state_t> state)
+    {
+        while (true)
+        {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> l(state->m_);
+                state->cv_.wait(l, [&state] { return state->stop_ || !state->tasks_.empty(); });
+                if (state->tasks_.empty())
+                    return;
+                task = std::move(state->tasks_.front());
+                state->tasks_.pop_front();
+            }
+            task();
+        }
+    }
+
+  public:
+    explicit host_thread_pool(std::size_t num_threads = std::thread::hardware_concurrency())
+        : state_(std::make_shared<state_t>())
+    {
+        num_threads = std::max<std::size_t>(num_threads, 1);
+        threads_.reserve(num_threads);
+        for (std::size_t i = 0; i < num_threads; ++i)
+            threads_.emplace_back(run, state_);
+    }
+
+    host_thread_pool(const host_thread_pool&) = delete;
+    host_thread_pool&
+    operator=(const host_thread_pool&) = delete;
+
+    ~host_thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> l(state_->m_);
+            state_->stop_ = true;
+        }
+        state_->cv_.notify_all();
+        for (auto& t : threads_)
+        {
+            // a pool destroyed by one of its own tasks cannot join the thread running it
+            if (t.get_id() == std::this_thread::get_id())
+                t.detach();
+            else
+                t.join();
+        }
+    }
+
+    template <typename Function>
+    void
+    enqueue(Function&& f)
+    {
+        {
+            std::lock_guard<std::mutex> l(state_->m_);
+            state_->tasks_.emplace_back(std::forward<Function>(f));
+        }
+        state_->cv_.notify_one();
+    }
+
+    std::size_t
+    size() const
+    {
+        return threads_.size();
+    }
+};
+
+#if _ONEDPL_PAR_BACKEND_TBB
+using default_host_resource_t = tbb::task_arena*;
+#else
+using default_host_resource_t = host_thread_pool*;
+#endif
+
+// Runs the submitted functions asynchronously on the host. A resource is a pointer to an executor with an enqueue
+// member function taking a callable, such as tbb::task_arena or host_thread_pool; the function is called with the
+// resource and the arguments of submit, and its result is available through the returned waiter.
+template <typename ResourceHandle = default_host_resource_t>
+class host_backend
+{
+  public:
+    using resource_type = ResourceHandle;
+    using wait_type = std::shared_future<void>;
+    using execution_resource_t = resource_type;
+    using resource_container_t = std::vector<execution_resource_t>;
+    using report_duration = std::chrono::milliseconds;
+
+  private:
+    using report_clock_type = std::chrono::steady_clock;
+    using owned_resource_t = std::remove_pointer_t<resource_type>;
+
+    // the backend whose task runs on the current thread, if any
+    static inline thread_local const host_backend* running_backend_ = nullptr;
+
+    struct pending_tasks_t
+    {
+        std::mutex m_;
+        std::condition_variable cv_;
+        std::size_t count_ = 0;
+
+        void
+        add()
+        {
+            std::lock_guard<std::mutex> l(m_);
+            ++count_;
+        }
+
+        void
+        remove()
+        {
+            std::lock_guard<std::mutex> l(m_);
+            if (--count_ == 0)
+                cv_.notify_all();
+        }
+
+        void
+        wait()
+        {
+            std::unique_lock<std::mutex> l(m_);
+            cv_.wait(l, [this] { return count_ == 0; });
+        }
+    };
+
+    template <typename Result>
+    class async_waiter
+    {
+        std::shared_future<Result> f_;
+
+      public:
+        async_waiter(std::shared_future<Result> f) : f_(std::move(f)) {}
+
+        std::shared_future<Result>
+        unwrap()
+        {
+            return f_;
+        }
+
+        // rethrows the exception thrown by the task
+        void
+        wait()
+        {
+            f_.get();
+        }
+    };
+
+    class submission_group
+    {
+        std::shared_ptr<pending_tasks_t> pending_;
+
+      public:
+        submission_group(std::shared_ptr<pending_tasks_t> p) : pending_(std::move(p)) {}
+
+        void
+        wait()
+        {
+            pending_->wait();
+        }
+    };
+
+    template <typename SelectionHandle, typename Function, typename... Args>
+    struct task_t
+    {
+        using selection_type = SelectionHandle;
+        using result_type = std::invoke_result_t<Function&, resource_type, Args&...>;
+
+        std::optional<SelectionHandle> s_;
+        Function f_;
+        std::tuple<Args...> args_;
+        std::promise<result_type> promise_;
+    };
+
+    // the reports are made when the function returns or throws, before its result is made available
+    template <bool report_task_time, bool report_task_completion, typename SelectionHandle>
+    struct report_on_exit
+    {
+        SelectionHandle& s_;
+        report_clock_type::time_point t0_;
+
+        ~report_on_exit()
+        {
+            if constexpr (report_task_time)
+                report(s_, execution_info::task_time,
+                       std::chrono::duration_cast<report_duration>(report_clock_type::now() - t0_));
+            if constexpr (report_task_completion)
+                report(s_, execution_info::task_completion);
+        }
+    };
+
+    template <bool report_task_time, bool report_task_completion, typename Task>
+    static void
+    run_task(const host_backend* backend, resource_type r, pending_tasks_t& pending, Task& task)
+    {
+        using result_type = typename Task::result_type;
+        using reporter_t = report_on_exit<report_task_time, report_task_completion, typename Task::selection_type>;
+
+        const host_backend* outer = running_backend_;
+        running_backend_ = backend;
+        auto call = [&]() -> result_type {
+            return std::apply([&](auto&... args) -> result_type { return task.f_(r, args...); }, task.args_);
+        };
+        try
+        {
+            if constexpr (std::is_void_v<result_type>)
+            {
+                {
+                    reporter_t reporter{*task.s_, report_clock_type::now()};
+                    call();
+                }
+                task.promise_.set_value();
+            }
+            else
+            {
+                std::optional<result_type> result;
+                {
+                    reporter_t reporter{*task.s_, report_clock_type::now()};
+                    result.emplace(call());
+                }
+                task.promise_.set_value(std::move(*result));
+            }
+        }
+        catch (...)
+        {
+            task.promise_.set_exception(std::current_exception());
+        }
+        pending.remove();
+        // the selection may hold the last reference to the policy and so to this backend
+        task.s_.reset();
+        running_backend_ = outer;
+    }
+
+  public:
+    host_backend(const host_backend&) = delete;
+    host_backend&
+    operator=(const host_backend&) = delete;
+
+    host_backend() { initialize_default_resources(); }
+
+    template <typename NativeUniverseVector>
+    host_backend(const NativeUniverseVector& v)
+    {
+        resources_.reserve(v.size());
+        for (auto e : v)
+            resources_.push_back(e);
+    }
+
+    ~host_backend()
+    {
+        if (running_backend_ != this)
+        {
+            pending_->wait();
+            return;
+        }
+        // The last reference was released by a task of this backend, which can neither wait for itself nor
+        // destroy the resource it runs on: the resources are released once the other tasks complete.
+        if (!owned_.empty())
+            std::thread([owned = std::move(owned_), pending = pending_] { pending->wait(); }).detach();
+    }
+
+    template <typename SelectionHandle, typename Function, typename... Args>
+    auto
+    submit(SelectionHandle s, Function&& f, Args&&... args)
+    {
+        constexpr bool report_task_completion = report_info_v<SelectionHandle, execution_info::task_completion_t>;
+        constexpr bool report_task_submission = report_info_v<SelectionHandle, execution_info::task_submission_t>;
+        constexpr bool report_task_time = report_value_v<SelectionHandle, execution_info::task_time_t, report_duration>;
+
+        using task_type = task_t<SelectionHandle, std::decay_t<Function>, std::decay_t<Args>...>;
+        using result_type = typename task_type::result_type;
+
+        resource_type r = unwrap(s);
+
+        if constexpr (report_task_submission)
+            report(s, execution_info::task_submission);
+
+        auto task = std::make_shared<task_type>(
+            task_type{s, std::forward<Function>(f), std::make_tuple(std::forward<Args>(args)...), {}});
+        std::shared_future<result_type> future = task->promise_.get_future().share();
+
+        pending_->add();
+        r->enqueue([backend = static_cast<const host_backend*>(this), r, pending = pending_, task]() {
+            run_task<report_task_time, report_task_completion>(backend, r, *pending, *task);
+        });
+        return async_waiter<result_type>{std::move(future)};
+    }
+
+    auto
+    get_submission_group()
+    {
+        return submission_group{pending_};
+    }
+
+    auto
+    get_resources()
+    {
+        return resources_;
+    }
+
+  private:
+    resource_container_t resources_;
+    std::vector<std::unique_ptr<owned_resource_t>> owned_;
+    std::shared_ptr<pending_tasks_t> pending_ = std::make_shared<pending_tasks_t>();
+
+    void
+    own(std::unique_ptr<owned_resource_t> resource)
+    {
+        resources_.push_back(resource.get());
+        owned_.push_back(std::move(resource));
+    }
+
+    void
+    initialize_default_resources()
+    {
+        if constexpr (std::is_same_v<resource_type, host_thread_pool*>)
+        {
+            own(std::make_unique<host_thread_pool>());
+        }
+#if _ONEDPL_PAR_BACKEND_TBB
+        else if constexpr (std::is_same_v<resource_type, tbb::task_arena*>)
+        {
+            // an arena per NUMA node, or a single arena spanning the machine when the topology is unknown
+#    if _DS_BACKEND_HOST_TBB_NUMA
+            for (auto node : tbb::info::numa_nodes())
+                own(std::make_unique<tbb::task_arena>(tbb::task_arena::constraints(node)));
+#    else
+            own(std::make_unique<tbb::task_arena>());
+#    endif
+        }
+#endif
+        else
+        {
+            static_assert(std::is_same_v<resource_type, host_thread_pool*>,
+                          "host_backend creates default resources of type host_thread_pool* or tbb::task_arena* "
+                          "only; other resources must be passed to the constructor");
+        }
+    }
+};
+
+} //namespace experimental
+} //namespace dpl
+} //namespace oneapi
+
+#endif /*_ONEDPL_HOST_BACKEND_IMPL_H*/
@@ -20,6 +20,8 @@
 #include <type_traits>
 #include <functional>
 #include <algorithm>
+#include <cstring>
+#include <new>
 
 #include "algorithm_fwd.h"
 
@@ -43,6 +45,151 @@ namespace dpl
 namespace __internal
 {
 
+//------------------------------------------------------------------------
+// bitwise copies and comparisons
+//------------------------------------------------------------------------
+
+// The copies between contiguous sequences of a trivially copyable type are done by memcpy/memmove
+// (or by streaming stores)
+template <typename _Iterator1, typename _Iterator2>
+constexpr bool
+__is_bitwise_copyable()
+{
+    if constexpr (__is_contiguous_iterator_v<_Iterator1> && __is_contiguous_iterator_v<_Iterator2>)
+    {
+        using _ValueType1 = ::std::remove_cv_t<typename ::std::iterator_traits<_Iterator1>::value_type>;
+        using _ValueType2 = typename ::std::iterator_traits<_Iterator2>::value_type;
+        return ::std::is_same_v<_ValueType1, _ValueType2> && ::std::is_trivially_copyable_v<_ValueType2>;
+    }
+    else
+        return false;
+}
+
+// The comparisons for equality of contiguous sequences of a scalar type whose values have unique representations
+// (integers, enumerations, pointers, but not floating-point numbers) are done by memcmp
+template <typename _Iterator1, typename _Iterator2, typename _BinaryPredicate>
+constexpr bool
+__is_bitwise_comparable()
+{
+    if constexpr (__is_contiguous_iterator_v<_Iterator1> && __is_contiguous_iterator_v<_Iterator2>)
+    {
+        using _ValueType1 = ::std::remove_cv_t<typename ::std::iterator_traits<_Iterator1>::value_type>;
+        using _ValueType2 = ::std::remove_cv_t<typename ::std::iterator_traits<_Iterator2>::value_type>;
+        return ::std::is_same_v<_ValueType1, _ValueType2> && ::std::is_scalar_v<_ValueType1> &&
+               ::std::has_unique_object_representations_v<_ValueType1> &&
+               (::std::is_same_v<_BinaryPredicate, oneapi::dpl::__internal::__pstl_equal> ||
+                ::std::is_same_v<_BinaryPredicate, ::std::equal_to<_ValueType1>> ||
+                ::std::is_same_v<_BinaryPredicate, ::std::equal_to<>>);
+    }
+    else
+        return false;
+}
+
+// Whether two contiguous sequences of __n elements are equal bitwise
+template <typename _Iterator1, typename _Size, typename _Iterator2>
+bool
+__brick_bitwise_equal(_Iterator1 __first1, _Size __n, _Iterator2 __first2) noexcept
+{
+    return __n <= 0 || ::std::memcmp(__internal::__to_address(__first1), __internal::__to_address(__first2),
+                                     __n * sizeof(*__internal::__to_address(__first1))) == 0;
+}
+
+// memcmp finds the block of the first difference, which is then searched element by element
+template <typename _Iterator1, typename _Size, typename _Iterator2>
+::std::pair<_Iterator1, _Iterator2>
+__brick_bitwise_mismatch(_Iterator1 __first1, _Size __n, _Iterator2 __first2) noexcept
+{
+    if (__n <= 0)
+        return {__first1, __first2};
+
+    const auto* __x = __internal::__to_address(__first1);
+    const auto* __y = __internal::__to_address(__first2);
+    constexpr _Size __block = 256 / sizeof(*__x);
+    _Size __i = 0;
+    while (__i < __n)
+    {
+        const _Size __len = ::std::min(__block, __n - __i);
+        if (::std::memcmp(__x + __i, __y + __i, __len * sizeof(*__x)) != 0)
+            break;
+        __i += __len;
+    }
+    for (; __i < __n && __x[__i] == __y[__i]; ++__i)
+        ;
+    return {__first1 + __i, __first2 + __i};
+}
+
+//------------------------------------------------------------------------
+// structures of arrays
+//------------------------------------------------------------------------
+
+// A zip_iterator over pointers walks the columns of a structure of arrays, such as a soa_vector. The algorithms
+// moving whole elements of such sequences move each column on its own, with the bricks of plain pointers.
+template <typename _Iterator>
+struct __soa_columns
+{
+    static constexpr bool __value = false;
+};
+
+template <typename... _Tp>
+struct __soa_columns<oneapi::dpl::zip_iterator<_Tp*...>>
+{
+    static constexpr bool __value = true;
+    using __indices = ::std::index_sequence_for<_Tp...>;
+};
+
+// Whether the elements of one structure of arrays can be assigned column by column to another
+template <typename _Iterator1, typename _Iterator2>
+constexpr bool
+__are_soa_columns()
+{
+    if constexpr (__soa_columns<_Iterator1>::__value && __soa_columns<_Iterator2>::__value)
+        return ::std::is_same_v<typename __soa_columns<_Iterator1>::__indices,
+                                typename __soa_columns<_Iterator2>::__indices>;
+    else
+        return false;
+}
+
+//------------------------------------------------------------------------
+// streaming stores
+//------------------------------------------------------------------------
+
+// The fills of a contiguous sequence with a value of its type, or of an arithmetic type converted to it
+template <typename _Iterator, typename _Tp>
+constexpr bool
+__is_stream_fillable()
+{
+#if _ONEDPL_STREAMING_STORES_AVAILABLE
+    if constexpr (__is_contiguous_iterator_v<_Iterator>)
+    {
+        using _ValueType = typename ::std::iterator_traits<_Iterator>::value_type;
+        return __unseq_backend::__is_stream_fillable_v<_ValueType> &&
+               (::std::is_same_v<::std::remove_cv_t<_Tp>, _ValueType> ||
+                (::std::is_arithmetic_v<_Tp> && ::std::is_arithmetic_v<_ValueType>));
+    }
+#endif
+    return false;
+}
+
+template <typename _Brick, typename = void>
+inline constexpr bool __has_streaming_stores_v = false;
+
+template <typename _Brick>
+inline constexpr bool
+    __has_streaming_stores_v<_Brick, ::std::void_t<decltype(::std::declval<_Brick&>().__streaming)>> = true;
+
+// Turns on the streaming stores of a vectorized brick writing __n elements, if the policy selects them for
+// the size of the destination
+template <typename _OutputIterator, typename _Brick, typename _ExecutionPolicy, typename _Size>
+void
+__enable_streaming_stores(_Brick& __brick, const _ExecutionPolicy& __exec, _Size __n)
+{
+    using _ValueType = typename ::std::iterator_traits<_OutputIterator>::value_type;
+
+    if constexpr (__has_streaming_stores_v<_Brick>)
+        __brick.__streaming =
+            oneapi::dpl::__utils::__use_streaming_stores(__exec, static_cast<::std::size_t>(__n) * sizeof(_ValueType));
+}
+
 //------------------------------------------------------------------------
 // any_of
 //------------------------------------------------------------------------
@@ -181,6 +328,8 @@ __pattern_walk_brick(_Tag, _ExecutionPolicy&& __exec, _ForwardIterator __first,
 {
     static_assert(__is_serial_tag_v<_Tag> || __is_parallel_forward_tag_v<_Tag>);
 
+    if constexpr (_Tag::__is_vector::value)
+        __internal::__enable_streaming_stores<_ForwardIterator>(__brick, __exec, __last - __first);
     __brick(__first, __last, typename _Tag::__is_vector{});
 }
 
@@ -191,6 +340,8 @@ __pattern_walk_brick(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec, _Rand
 {
     using __backend_tag = typename __parallel_tag<_IsVector>::__backend_tag;
 
+    if constexpr (_IsVector::value)
+        __internal::__enable_streaming_stores<_RandomAccessIterator>(__brick, __exec, __last - __first);
     __internal::__except_handler([&]() {
         __par_backend::__parallel_for(
             __backend_tag{}, ::std::forward<_ExecutionPolicy>(__exec), __first, __last,
@@ -242,6 +393,8 @@ __pattern_walk_brick_n(_Tag, _ExecutionPolicy&& __exec, _ForwardIterator __first
 {
     static_assert(__is_serial_tag_v<_Tag> || __is_parallel_forward_tag_v<_Tag>);
 
+    if constexpr (_Tag::__is_vector::value)
+        __internal::__enable_streaming_stores<_ForwardIterator>(__brick, __exec, __n);
     return __brick(__first, __n, typename _Tag::__is_vector{});
 }
 
@@ -252,6 +405,8 @@ __pattern_walk_brick_n(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec, _Ra
 {
     using __backend_tag = typename __parallel_tag<_IsVector>::__backend_tag;
 
+    if constexpr (_IsVector::value)
+        __internal::__enable_streaming_stores<_RandomAccessIterator>(__brick, __exec, __n);
     return __internal::__except_handler([&]() {
         __par_backend::__parallel_for(
             __backend_tag{}, ::std::forward<_ExecutionPolicy>(__exec), __first, __first + __n,
@@ -386,6 +541,8 @@ __pattern_walk2_brick(_Tag, _ExecutionPolicy&& __exec, _ForwardIterator1 __first
 {
     static_assert(__is_serial_tag_v<_Tag>);
 
+    if constexpr (_Tag::__is_vector::value)
+        __internal::__enable_streaming_stores<_ForwardIterator2>(__brick, __exec, __last1 - __first1);
     return __brick(__first1, __last1, __first2, typename _Tag::__is_vector{});
 }
 
@@ -397,6 +554,8 @@ __pattern_walk2_brick(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec, _Ran
 {
     using __backend_tag = typename __parallel_tag<_IsVector>::__backend_tag;
 
+    if constexpr (_IsVector::value)
+        __internal::__enable_streaming_stores<_RandomAccessIterator2>(__brick, __exec, __last1 - __first1);
     return __except_handler([&]() {
         __par_backend::__parallel_for(
             __backend_tag{}, ::std::forward<_ExecutionPolicy>(__exec), __first1, __last1,
@@ -445,6 +604,8 @@ __pattern_walk2_brick_n(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec, _R
 {
     using __backend_tag = typename __parallel_tag<_IsVector>::__backend_tag;
 
+    if constexpr (_IsVector::value)
+        __internal::__enable_streaming_stores<_RandomAccessIterator2>(__brick, __exec, __n);
     return __except_handler([&]() {
         __par_backend::__parallel_for(
             __backend_tag{}, ::std::forward<_ExecutionPolicy>(__exec), __first1, __first1 + __n,
@@ -463,6 +624,8 @@ __pattern_walk2_brick_n(_Tag, _ExecutionPolicy&& __exec, _ForwardIterator1 __fir
 {
     static_assert(__is_serial_tag_v<_Tag> || __is_parallel_forward_tag_v<_Tag>);
 
+    if constexpr (_Tag::__is_vector::value)
+        __internal::__enable_streaming_stores<_ForwardIterator2>(__brick, __exec, __n);
     return __brick(__first1, __n, __first2, typename _Tag::__is_vector{});
 }
 
@@ -588,7 +751,11 @@ bool
 __brick_equal(_ForwardIterator1 __first1, _ForwardIterator1 __last1, _ForwardIterator2 __first2,
               _ForwardIterator2 __last2, _BinaryPredicate __p, /* IsVector = */ ::std::false_type) noexcept
 {
-    return ::std::equal(__first1, __last1, __first2, __last2, __p);
+    if constexpr (__is_bitwise_comparable<_ForwardIterator1, _ForwardIterator2, _BinaryPredicate>())
+        return __last1 - __first1 == __last2 - __first2 &&
+               __internal::__brick_bitwise_equal(__first1, __last1 - __first1, __first2);
+    else
+        return ::std::equal(__first1, __last1, __first2, __last2, __p);
 }
 
 template <class _RandomAccessIterator1, class _RandomAccessIterator2, class _BinaryPredicate>
@@ -599,8 +766,12 @@ __brick_equal(_RandomAccessIterator1 __first1, _RandomAccessIterator1 __last1, _
     if (__last1 - __first1 != __last2 - __first2)
         return false;
 
-    return __unseq_backend::__simd_first(__first1, __last1 - __first1, __first2, __not_pred<_BinaryPredicate&>(__p))
-               .first == __last1;
+    if constexpr (__is_bitwise_comparable<_RandomAccessIterator1, _RandomAccessIterator2, _BinaryPredicate>())
+        return __internal::__brick_bitwise_equal(__first1, __last1 - __first1, __first2);
+    else
+        return __unseq_backend::__simd_first(__first1, __last1 - __first1, __first2,
+                                             __not_pred<_BinaryPredicate&>(__p))
+                   .first == __last1;
 }
 
 template <class _Tag, class _ExecutionPolicy, class _ForwardIterator1, class _ForwardIterator2, class _BinaryPredicate>
@@ -642,7 +813,10 @@ bool
 __brick_equal(_ForwardIterator1 __first1, _ForwardIterator1 __last1, _ForwardIterator2 __first2, _BinaryPredicate __p,
               /* IsVector = */ ::std::false_type) noexcept
 {
-    return ::std::equal(__first1, __last1, __first2, __p);
+    if constexpr (__is_bitwise_comparable<_ForwardIterator1, _ForwardIterator2, _BinaryPredicate>())
+        return __internal::__brick_bitwise_equal(__first1, __last1 - __first1, __first2);
+    else
+        return ::std::equal(__first1, __last1, __first2, __p);
 }
 
 template <class _RandomAccessIterator1, class _RandomAccessIterator2, class _BinaryPredicate>
@@ -650,8 +824,12 @@ bool
 __brick_equal(_RandomAccessIterator1 __first1, _RandomAccessIterator1 __last1, _RandomAccessIterator2 __first2,
               _BinaryPredicate __p, /* is_vector = */ ::std::true_type) noexcept
 {
-    return __unseq_backend::__simd_first(__first1, __last1 - __first1, __first2, __not_pred<_BinaryPredicate&>(__p))
-               .first == __last1;
+    if constexpr (__is_bitwise_comparable<_RandomAccessIterator1, _RandomAccessIterator2, _BinaryPredicate>())
+        return __internal::__brick_bitwise_equal(__first1, __last1 - __first1, __first2);
+    else
+        return __unseq_backend::__simd_first(__first1, __last1 - __first1, __first2,
+                                             __not_pred<_BinaryPredicate&>(__p))
+                   .first == __last1;
 }
 
 template <class _Tag, class _ExecutionPolicy, class _ForwardIterator1, class _ForwardIterator2, class _BinaryPredicate>
@@ -1050,11 +1228,28 @@ template <class _Tag, typename _ExecutionPolicy>
 struct __brick_copy_n<_Tag, _ExecutionPolicy,
                       ::std::enable_if_t<oneapi::dpl::__internal::__is_host_dispatch_tag_v<_Tag>>>
 {
+    bool __streaming = false;
+
     template <typename _RandomAccessIterator1, typename _Size, typename _RandomAccessIterator2>
     _RandomAccessIterator2
     operator()(_RandomAccessIterator1 __first, _Size __n, _RandomAccessIterator2 __result,
                /*vec*/ ::std::true_type) const
     {
+        if constexpr (__is_bitwise_copyable<_RandomAccessIterator1, _RandomAccessIterator2>())
+        {
+            if (__n > 0)
+            {
+#if _ONEDPL_STREAMING_STORES_AVAILABLE
+                if (__streaming)
+                    __unseq_backend::__simd_stream_copy_n(__internal::__to_address(__first), __n,
+                                                          __internal::__to_address(__result));
+                else
+#endif
+                    ::std::memcpy(__internal::__to_address(__result), __internal::__to_address(__first),
+                                  __n * sizeof(*__internal::__to_address(__first)));
+            }
+            return __result + __n;
+        }
         return __unseq_backend::__simd_assign(
             __first, __n, __result,
             [](_RandomAccessIterator1 __first, _RandomAccessIterator2 __result) { *__result = *__first; });
@@ -1075,11 +1270,28 @@ struct __brick_copy_n<_Tag, _ExecutionPolicy,
 template <class _Tag, typename _ExecutionPolicy>
 struct __brick_copy<_Tag, _ExecutionPolicy, ::std::enable_if_t<__is_host_dispatch_tag_v<_Tag>>>
 {
+    bool __streaming = false;
+
     template <typename _RandomAccessIterator1, typename _RandomAccessIterator2>
     _RandomAccessIterator2
     operator()(_RandomAccessIterator1 __first, _RandomAccessIterator1 __last, _RandomAccessIterator2 __result,
                /*vec*/ ::std::true_type) const
     {
+        if constexpr (__is_bitwise_copyable<_RandomAccessIterator1, _RandomAccessIterator2>())
+        {
+            if (__first != __last)
+            {
+#if _ONEDPL_STREAMING_STORES_AVAILABLE
+                if (__streaming)
+                    __unseq_backend::__simd_stream_copy_n(__internal::__to_address(__first), __last - __first,
+                                                          __internal::__to_address(__result));
+                else
+#endif
+                    ::std::memcpy(__internal::__to_address(__result), __internal::__to_address(__first),
+                                  (__last - __first) * sizeof(*__internal::__to_address(__first)));
+            }
+            return __result + (__last - __first);
+        }
         return __unseq_backend::__simd_assign(
             __first, __last - __first, __result,
             [](_RandomAccessIterator1 __first, _RandomAccessIterator2 __result) { *__result = *__first; });
@@ -1107,11 +1319,28 @@ struct __brick_copy<_Tag, _ExecutionPolicy, ::std::enable_if_t<__is_host_dispatc
 template <class _Tag, typename _ExecutionPolicy>
 struct __brick_move<_Tag, _ExecutionPolicy, ::std::enable_if_t<__is_host_dispatch_tag_v<_Tag>>>
 {
+    bool __streaming = false;
+
     template <typename _RandomAccessIterator1, typename _RandomAccessIterator2>
     _RandomAccessIterator2
     operator()(_RandomAccessIterator1 __first, _RandomAccessIterator1 __last, _RandomAccessIterator2 __result,
                /*vec*/ ::std::true_type) const
     {
+        if constexpr (__is_bitwise_copyable<_RandomAccessIterator1, _RandomAccessIterator2>())
+        {
+            if (__first != __last)
+            {
+#if _ONEDPL_STREAMING_STORES_AVAILABLE
+                if (__streaming)
+                    __unseq_backend::__simd_stream_copy_n(__internal::__to_address(__first), __last - __first,
+                                                          __internal::__to_address(__result));
+                else
+#endif
+                    ::std::memmove(__internal::__to_address(__result), __internal::__to_address(__first),
+                                   (__last - __first) * sizeof(*__internal::__to_address(__first)));
+            }
+            return __result + (__last - __first);
+        }
         return __unseq_backend::__simd_assign(
             __first, __last - __first, __result,
             [](_RandomAccessIterator1 __first, _RandomAccessIterator2 __result) { *__result = ::std::move(*__first); });
@@ -1268,6 +1497,50 @@ __brick_copy_by_mask(_RandomAccessIterator1 __first, _RandomAccessIterator1 __la
 #endif
 }
 
+template <class _RandomAccessIterator1, class _RandomAccessIterator2, class _IsVector, ::std::size_t... _Ip>
+void
+__brick_copy_columns_by_mask(_RandomAccessIterator1 __first, _RandomAccessIterator1 __last,
+                             _RandomAccessIterator2 __result, bool* __mask, _IsVector __is_vector,
+                             ::std::index_sequence<_Ip...>) noexcept
+{
+    const auto __n = __last - __first;
+    const auto __in = __first.base();
+    const auto __out = __result.base();
+    (__internal::__brick_copy_by_mask(
+         ::std::get<_Ip>(__in), ::std::get<_Ip>(__in) + __n, ::std::get<_Ip>(__out), __mask,
+         [](auto __x, auto __z) { *__z = *__x; }, __is_vector),
+     ...);
+}
+
+// Copies the elements marked in the mask; the columns of structures of arrays are copied one after another
+template <class _ForwardIterator, class _OutputIterator>
+void
+__brick_copy_by_mask(_ForwardIterator __first, _ForwardIterator __last, _OutputIterator __result, bool* __mask,
+                     /*vector=*/::std::false_type) noexcept
+{
+    if constexpr (__are_soa_columns<_ForwardIterator, _OutputIterator>())
+        __internal::__brick_copy_columns_by_mask(__first, __last, __result, __mask, ::std::false_type{},
+                                                 typename __soa_columns<_ForwardIterator>::__indices{});
+    else
+        __internal::__brick_copy_by_mask(
+            __first, __last, __result, __mask, [](_ForwardIterator __x, _OutputIterator __z) { *__z = *__x; },
+            ::std::false_type{});
+}
+
+template <class _RandomAccessIterator, class _OutputIterator>
+void
+__brick_copy_by_mask(_RandomAccessIterator __first, _RandomAccessIterator __last, _OutputIterator __result,
+                     bool* __restrict __mask, /*vector=*/::std::true_type) noexcept
+{
+    if constexpr (__are_soa_columns<_RandomAccessIterator, _OutputIterator>())
+        __internal::__brick_copy_columns_by_mask(__first, __last, __result, __mask, ::std::true_type{},
+                                                 typename __soa_columns<_RandomAccessIterator>::__indices{});
+    else
+        __internal::__brick_copy_by_mask(
+            __first, __last, __result, __mask, [](_RandomAccessIterator __x, _OutputIterator __z) { *__z = *__x; },
+            ::std::true_type{});
+}
+
 template <class _ForwardIterator, class _OutputIterator1, class _OutputIterator2>
 void
 __brick_partition_by_mask(_ForwardIterator __first, _ForwardIterator __last, _OutputIterator1 __out_true,
@@ -1336,9 +1609,8 @@ __pattern_copy_if(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec, _RandomA
                 },
                 ::std::plus<_DifferenceType>(),                                              // Combine
                 [=](_DifferenceType __i, _DifferenceType __len, _DifferenceType __initial) { // Scan
-                    __internal::__brick_copy_by_mask(
-                        __first + __i, __first + (__i + __len), __result + __initial, __mask + __i,
-                        [](_RandomAccessIterator1 __x, _RandomAccessIterator2 __z) { *__z = *__x; }, _IsVector{});
+                    __internal::__brick_copy_by_mask(__first + __i, __first + (__i + __len), __result + __initial,
+                                                     __mask + __i, _IsVector{});
                 },
                 [&__m](_DifferenceType __total) { __m = __total; });
             return __result + __m;
@@ -1628,9 +1900,8 @@ __pattern_unique_copy(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec, _Ran
                     ::std::plus<_DifferenceType>(),                                              // Combine
                     [=](_DifferenceType __i, _DifferenceType __len, _DifferenceType __initial) { // Scan
                         // Phase 2 is same as for __pattern_copy_if
-                        __internal::__brick_copy_by_mask(
-                            __first + __i, __first + (__i + __len), __result + __initial, __mask + __i,
-                            [](_RandomAccessIterator1 __x, _RandomAccessIterator2 __z) { *__z = *__x; }, _IsVector{});
+                        __internal::__brick_copy_by_mask(__first + __i, __first + (__i + __len),
+                                                         __result + __initial, __mask + __i, _IsVector{});
                     },
                     [&__m](_DifferenceType __total) { __m = __total; });
                 return __result + __m;
@@ -2454,6 +2725,52 @@ __pattern_stable_sort(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec, _Ran
 // sort_by_key
 //------------------------------------------------------------------------
 
+// Moves __column[__index[__i]] to the position __i
+template <class _Tag, class _ExecutionPolicy, class _Tp, class _DifferenceType>
+void
+__permute_soa_column(_Tag __tag, _ExecutionPolicy&& __exec, _Tp* __column, const _DifferenceType* __index,
+                     _DifferenceType __n)
+{
+    __par_backend::__buffer<_ExecutionPolicy, _Tp> __buf(__exec, __n);
+    if (!__buf)
+        throw ::std::bad_alloc();
+    _Tp* __tmp = __buf.get();
+
+    __internal::__pattern_walk2(__tag, __exec, __index, __index + __n, __tmp,
+                                [__column](_DifferenceType __j, _Tp& __y) {
+                                    ::new (::std::addressof(__y)) _Tp(::std::move(__column[__j]));
+                                });
+    __internal::__pattern_walk2(__tag, __exec, __tmp, __tmp + __n, __column, [](_Tp& __x, _Tp& __y) {
+        __y = ::std::move(__x);
+        __x.~_Tp();
+    });
+}
+
+// The values are a structure of arrays: the keys are sorted together with the positions of the elements only, and
+// the columns of the values are permuted after that one by one, so the sort never moves the whole elements.
+template <class _Tag, class _ExecutionPolicy, class _RandomAccessIterator1, class _RandomAccessIterator2,
+          class _Compare, ::std::size_t... _Ip>
+void
+__sort_by_key_soa(_Tag __tag, _ExecutionPolicy&& __exec, _RandomAccessIterator1 __keys_first,
+                  _RandomAccessIterator1 __keys_last, _RandomAccessIterator2 __values_first, _Compare __comp,
+                  ::std::index_sequence<_Ip...>)
+{
+    using _DifferenceType = typename ::std::iterator_traits<_RandomAccessIterator1>::difference_type;
+    const _DifferenceType __n = __keys_last - __keys_first;
+
+    __par_backend::__buffer<_ExecutionPolicy, _DifferenceType> __index_buf(__exec, __n);
+    if (!__index_buf)
+        throw ::std::bad_alloc();
+    _DifferenceType* __index = __index_buf.get();
+    __internal::__pattern_walk2(__tag, __exec, oneapi::dpl::counting_iterator<_DifferenceType>(0),
+                                oneapi::dpl::counting_iterator<_DifferenceType>(__n), __index,
+                                [](_DifferenceType __i, _DifferenceType& __j) { __j = __i; });
+    __internal::__pattern_sort_by_key(__tag, __exec, __keys_first, __keys_last, __index, __comp);
+
+    const auto __columns = __values_first.base();
+    (__internal::__permute_soa_column(__tag, __exec, ::std::get<_Ip>(__columns), __index, __n), ...);
+}
+
 template <class _Tag, typename _ExecutionPolicy, typename _RandomAccessIterator1, typename _RandomAccessIterator2,
           typename _Compare>
 void
@@ -2463,6 +2780,16 @@ __pattern_sort_by_key(_Tag, _ExecutionPolicy&& __exec, _RandomAccessIterator1 __
 {
     static_assert(__is_serial_tag_v<_Tag> || __is_parallel_forward_tag_v<_Tag>);
 
+    if constexpr (__soa_columns<_RandomAccessIterator2>::__value)
+    {
+        if (__keys_last - __keys_first > 1)
+        {
+            __internal::__sort_by_key_soa(_Tag{}, __exec, __keys_first, __keys_last, __values_first, __comp,
+                                          typename __soa_columns<_RandomAccessIterator2>::__indices{});
+            return;
+        }
+    }
+
     auto __beg = oneapi::dpl::make_zip_iterator(__keys_first, __values_first);
     auto __end = __beg + (__keys_last - __keys_first);
     auto __cmp_f = [__comp](const auto& __a, const auto& __b) {
@@ -2483,6 +2810,17 @@ __pattern_sort_by_key(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec, _Ran
             ::std::is_move_constructible_v<typename ::std::iterator_traits<_RandomAccessIterator2>::value_type>,
         "The keys and values should be move constructible in case of parallel execution.");
 
+    if constexpr (__soa_columns<_RandomAccessIterator2>::__value)
+    {
+        if (__keys_last - __keys_first > 1)
+        {
+            __internal::__sort_by_key_soa(__parallel_tag<_IsVector>{}, __exec, __keys_first, __keys_last,
+                                          __values_first, __comp,
+                                          typename __soa_columns<_RandomAccessIterator2>::__indices{});
+            return;
+        }
+    }
+
     auto __beg = oneapi::dpl::make_zip_iterator(__keys_first, __values_first);
     auto __end = __beg + (__keys_last - __keys_first);
     auto __cmp_f = [__comp](const auto& __a, const auto& __b) {
@@ -2664,6 +3002,22 @@ __pattern_adjacent_find(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec, _R
     if (__last - __first < 2)
         return __last;
 
+    if constexpr (!_Semantic::value)
+    {
+        // The first pair is searched for (adjacent_find, is_sorted_until): claim the blocks from the front
+        return __internal::__except_handler([&]() {
+            return __internal::__parallel_find(
+                __parallel_tag<_IsVector>{}, ::std::forward<_ExecutionPolicy>(__exec), __first, __last,
+                [__last, __pred](_RandomAccessIterator __begin, _RandomAccessIterator __end) {
+                    // check the pair on the boundary with the next block as well
+                    const _RandomAccessIterator __res = __internal::__brick_adjacent_find(
+                        __begin, __end != __last ? __end + 1 : __end, __pred, _IsVector{}, false);
+                    return __res < __end ? __res : __end;
+                },
+                ::std::true_type{});
+        });
+    }
+
     return __internal::__except_handler([&]() {
         return __par_backend::__parallel_reduce(
             __backend_tag{}, ::std::forward<_ExecutionPolicy>(__exec), __first, __last, __last,
@@ -2762,12 +3116,25 @@ template <class _Tag, typename _ExecutionPolicy, typename _Tp>
 struct __brick_fill<_Tag, _ExecutionPolicy, _Tp, ::std::enable_if_t<__is_host_dispatch_tag_v<_Tag>>>
 {
     const _Tp& __value;
+    bool __streaming = false;
 
     template <typename _RandomAccessIterator>
     void
     operator()(_RandomAccessIterator __first, _RandomAccessIterator __last,
                /* __is_vector = */ ::std::true_type) const noexcept
     {
+#if _ONEDPL_STREAMING_STORES_AVAILABLE
+        if constexpr (__is_stream_fillable<_RandomAccessIterator, _Tp>())
+        {
+            if (__streaming && __first != __last)
+            {
+                using _ValueType = typename ::std::iterator_traits<_RandomAccessIterator>::value_type;
+                __unseq_backend::__simd_stream_fill_n(__internal::__to_address(__first), __last - __first,
+                                                      static_cast<_ValueType>(__value));
+                return;
+            }
+        }
+#endif
         __unseq_backend::__simd_fill_n(__first, __last - __first, __value);
     }
 
@@ -2782,11 +3149,15 @@ struct __brick_fill<_Tag, _ExecutionPolicy, _Tp, ::std::enable_if_t<__is_host_di
 
 template <class _Tag, class _ExecutionPolicy, class _ForwardIterator, class _Tp>
 void
-__pattern_fill(_Tag, _ExecutionPolicy&&, _ForwardIterator __first, _ForwardIterator __last, const _Tp& __value) noexcept
+__pattern_fill(_Tag, _ExecutionPolicy&& __exec, _ForwardIterator __first, _ForwardIterator __last,
+               const _Tp& __value) noexcept
 {
     static_assert(__is_serial_tag_v<_Tag> || __is_parallel_forward_tag_v<_Tag>);
 
-    __internal::__brick_fill<_Tag, _ExecutionPolicy, _Tp>{__value}(__first, __last, typename _Tag::__is_vector{});
+    __internal::__brick_fill<_Tag, _ExecutionPolicy, _Tp> __brick{__value};
+    if constexpr (_Tag::__is_vector::value)
+        __internal::__enable_streaming_stores<_ForwardIterator>(__brick, __exec, __last - __first);
+    __brick(__first, __last, typename _Tag::__is_vector{});
 }
 
 template <class _IsVector, class _ExecutionPolicy, class _RandomAccessIterator, class _Tp>
@@ -2796,11 +3167,13 @@ __pattern_fill(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec, _RandomAcce
 {
     using __backend_tag = typename __parallel_tag<_IsVector>::__backend_tag;
 
-    return __internal::__except_handler([&__exec, __first, __last, &__value]() {
+    __internal::__brick_fill<__parallel_tag<_IsVector>, _ExecutionPolicy, _Tp> __brick{__value};
+    if constexpr (_IsVector::value)
+        __internal::__enable_streaming_stores<_RandomAccessIterator>(__brick, __exec, __last - __first);
+    return __internal::__except_handler([&__exec, __first, __last, &__brick]() {
         __par_backend::__parallel_for(__backend_tag{}, ::std::forward<_ExecutionPolicy>(__exec), __first, __last,
-                                      [&__value](_RandomAccessIterator __begin, _RandomAccessIterator __end) {
-                                          __internal::__brick_fill<__parallel_tag<_IsVector>, _ExecutionPolicy, _Tp>{
-                                              __value}(__begin, __end, _IsVector{});
+                                      [&__brick](_RandomAccessIterator __begin, _RandomAccessIterator __end) {
+                                          __brick(__begin, __end, _IsVector{});
                                       });
         return __last;
     });
@@ -2810,12 +3183,25 @@ template <class _Tag, typename _ExecutionPolicy, typename _Tp>
 struct __brick_fill_n<_Tag, _ExecutionPolicy, _Tp, ::std::enable_if_t<__is_host_dispatch_tag_v<_Tag>>>
 {
     const _Tp& __value;
+    bool __streaming = false;
 
     template <typename _RandomAccessIterator, typename _Size>
     _RandomAccessIterator
     operator()(_RandomAccessIterator __first, _Size __count,
                /* __is_vector = */ ::std::true_type) const noexcept
     {
+#if _ONEDPL_STREAMING_STORES_AVAILABLE
+        if constexpr (__is_stream_fillable<_RandomAccessIterator, _Tp>())
+        {
+            if (__streaming && __count > 0)
+            {
+                using _ValueType = typename ::std::iterator_traits<_RandomAccessIterator>::value_type;
+                __unseq_backend::__simd_stream_fill_n(__internal::__to_address(__first), __count,
+                                                      static_cast<_ValueType>(__value));
+                return __first + __count;
+            }
+        }
+#endif
         return __unseq_backend::__simd_fill_n(__first, __count, __value);
     }
 
@@ -2830,12 +3216,14 @@ struct __brick_fill_n<_Tag, _ExecutionPolicy, _Tp, ::std::enable_if_t<__is_host_
 
 template <class _Tag, class _ExecutionPolicy, class _OutputIterator, class _Size, class _Tp>
 _OutputIterator
-__pattern_fill_n(_Tag, _ExecutionPolicy&&, _OutputIterator __first, _Size __count, const _Tp& __value) noexcept
+__pattern_fill_n(_Tag, _ExecutionPolicy&& __exec, _OutputIterator __first, _Size __count, const _Tp& __value) noexcept
 {
     static_assert(__is_serial_tag_v<_Tag> || __is_parallel_forward_tag_v<_Tag>);
 
-    return __internal::__brick_fill_n<_Tag, _ExecutionPolicy, _Tp>{__value}(__first, __count,
-                                                                            typename _Tag::__is_vector{});
+    __internal::__brick_fill_n<_Tag, _ExecutionPolicy, _Tp> __brick{__value};
+    if constexpr (_Tag::__is_vector::value)
+        __internal::__enable_streaming_stores<_OutputIterator>(__brick, __exec, __count);
+    return __brick(__first, __count, typename _Tag::__is_vector{});
 }
 
 template <class _IsVector, class _ExecutionPolicy, class _RandomAccessIterator, class _Size, class _Tp>
@@ -4016,7 +4404,11 @@ template <class _ForwardIterator1, class _ForwardIterator2, class _Predicate>
 __brick_mismatch(_ForwardIterator1 __first1, _ForwardIterator1 __last1, _ForwardIterator2 __first2,
                  _ForwardIterator2 __last2, _Predicate __pred, /* __is_vector = */ ::std::false_type) noexcept
 {
-    return __mismatch_serial(__first1, __last1, __first2, __last2, __pred);
+    if constexpr (__is_bitwise_comparable<_ForwardIterator1, _ForwardIterator2, _Predicate>())
+        return __internal::__brick_bitwise_mismatch(__first1, ::std::min(__last1 - __first1, __last2 - __first2),
+                                                    __first2);
+    else
+        return __mismatch_serial(__first1, __last1, __first2, __last2, __pred);
 }
 
 template <class _RandomAccessIterator1, class _RandomAccessIterator2, class _Predicate>
@@ -4025,7 +4417,10 @@ __brick_mismatch(_RandomAccessIterator1 __first1, _RandomAccessIterator1 __last1
                  _RandomAccessIterator2 __last2, _Predicate __pred, /* __is_vector = */ ::std::true_type) noexcept
 {
     auto __n = ::std::min(__last1 - __first1, __last2 - __first2);
-    return __unseq_backend::__simd_first(__first1, __n, __first2, __not_pred<_Predicate&>(__pred));
+    if constexpr (__is_bitwise_comparable<_RandomAccessIterator1, _RandomAccessIterator2, _Predicate>())
+        return __internal::__brick_bitwise_mismatch(__first1, __n, __first2);
+    else
+        return __unseq_backend::__simd_first(__first1, __n, __first2, __not_pred<_Predicate&>(__pred));
 }
 
 template <class _Tag, class _ExecutionPolicy, class _ForwardIterator1, class _ForwardIterator2, class _Predicate>
@@ -0,0 +1,455 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_ALGORITHM_RANGES_IMPL_H
+#define _ONEDPL_ALGORITHM_RANGES_IMPL_H
+
+#include <functional>
+#include <iterator>
+#include <utility>
+
+#include "algorithm_fwd.h"
+#include "execution_impl.h"
+#include "utils.h"
+#include "utils_ranges.h"
+#include "../internal/by_segment_extension_defs.h"
+
+// The range-based algorithms with the host policies run the iterator-based patterns over the iterators of the ranges.
+// A pipeline of views is therefore evaluated element by element inside the parallel loop of the pattern, without
+// materializing its intermediate results.
+
+namespace oneapi
+{
+namespace dpl
+{
+namespace __internal
+{
+namespace __ranges
+{
+
+template <typename _Range>
+auto
+__begin(_Range& __rng)
+{
+    return ::std::begin(__rng);
+}
+
+template <typename _Range>
+oneapi::dpl::__internal::__difference_t<_Range>
+__size(const _Range& __rng)
+{
+    return __rng.size();
+}
+
+//------------------------------------------------------------------------
+// walk_n
+//------------------------------------------------------------------------
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Function, typename _Size, typename _Iterator>
+void
+__walk_n_iterators(_Tag __tag, _ExecutionPolicy&& __exec, _Function __f, _Size __n, _Iterator __first)
+{
+    oneapi::dpl::__internal::__pattern_walk1(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first, __first + __n,
+                                             __f);
+}
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Function, typename _Size, typename _Iterator1,
+          typename _Iterator2>
+void
+__walk_n_iterators(_Tag __tag, _ExecutionPolicy&& __exec, _Function __f, _Size __n, _Iterator1 __first1,
+                   _Iterator2 __first2)
+{
+    oneapi::dpl::__internal::__pattern_walk2(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first1,
+                                             __first1 + __n, __first2, __f);
+}
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Function, typename _Size, typename _Iterator1,
+          typename _Iterator2, typename _Iterator3>
+void
+__walk_n_iterators(_Tag __tag, _ExecutionPolicy&& __exec, _Function __f, _Size __n, _Iterator1 __first1,
+                   _Iterator2 __first2, _Iterator3 __first3)
+{
+    oneapi::dpl::__internal::__pattern_walk3(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first1,
+                                             __first1 + __n, __first2, __first3, __f);
+}
+
+template <typename _Range, typename... _Ranges>
+oneapi::dpl::__internal::__difference_t<_Range>
+__first_size(const _Range& __rng, const _Ranges&...)
+{
+    return __ranges::__size(__rng);
+}
+
+// __f is applied to the elements of the ranges with the same index, up to the size of the first range
+template <typename _Tag, typename _ExecutionPolicy, typename _Function, typename... _Ranges>
+void
+__pattern_walk_n(_Tag __tag, _ExecutionPolicy&& __exec, _Function __f, _Ranges&&... __rngs)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    __ranges::__walk_n_iterators(__tag, ::std::forward<_ExecutionPolicy>(__exec), __f,
+                                 __ranges::__first_size(__rngs...), __ranges::__begin(__rngs)...);
+}
+
+//------------------------------------------------------------------------
+// swap
+//------------------------------------------------------------------------
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Range1, typename _Range2, typename _Function>
+oneapi::dpl::__internal::__difference_t<_Range1>
+__pattern_swap(_Tag __tag, _ExecutionPolicy&& __exec, _Range1&& __rng1, _Range2&& __rng2, _Function __f)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    const oneapi::dpl::__internal::__difference_t<_Range1> __n =
+        ::std::min<oneapi::dpl::__internal::__difference_t<_Range1>>(__ranges::__size(__rng1),
+                                                                     __ranges::__size(__rng2));
+    __ranges::__walk_n_iterators(__tag, ::std::forward<_ExecutionPolicy>(__exec), __f, __n, __ranges::__begin(__rng1),
+                                 __ranges::__begin(__rng2));
+    return __n;
+}
+
+//------------------------------------------------------------------------
+// equal
+//------------------------------------------------------------------------
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Range1, typename _Range2, typename _Pred>
+bool
+__pattern_equal(_Tag __tag, _ExecutionPolicy&& __exec, _Range1&& __rng1, _Range2&& __rng2, _Pred __pred)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    auto __first1 = __ranges::__begin(__rng1);
+    auto __first2 = __ranges::__begin(__rng2);
+    return oneapi::dpl::__internal::__pattern_equal(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first1,
+                                                    __first1 + __ranges::__size(__rng1), __first2,
+                                                    __first2 + __ranges::__size(__rng2), __pred);
+}
+
+//------------------------------------------------------------------------
+// find_if
+//------------------------------------------------------------------------
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Range, typename _Pred>
+oneapi::dpl::__internal::__difference_t<_Range>
+__pattern_find_if(_Tag __tag, _ExecutionPolicy&& __exec, _Range&& __rng, _Pred __pred)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    auto __first = __ranges::__begin(__rng);
+    return oneapi::dpl::__internal::__pattern_find_if(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first,
+                                                      __first + __ranges::__size(__rng), __pred) -
+           __first;
+}
+
+//------------------------------------------------------------------------
+// find_end
+//------------------------------------------------------------------------
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Range1, typename _Range2, typename _Pred>
+oneapi::dpl::__internal::__difference_t<_Range1>
+__pattern_find_end(_Tag __tag, _ExecutionPolicy&& __exec, _Range1&& __rng1, _Range2&& __rng2, _Pred __pred)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    auto __first1 = __ranges::__begin(__rng1);
+    auto __first2 = __ranges::__begin(__rng2);
+    return oneapi::dpl::__internal::__pattern_find_end(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first1,
+                                                       __first1 + __ranges::__size(__rng1), __first2,
+                                                       __first2 + __ranges::__size(__rng2), __pred) -
+           __first1;
+}
+
+//------------------------------------------------------------------------
+// find_first_of
+//------------------------------------------------------------------------
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Range1, typename _Range2, typename _Pred>
+oneapi::dpl::__internal::__difference_t<_Range1>
+__pattern_find_first_of(_Tag __tag, _ExecutionPolicy&& __exec, _Range1&& __rng1, _Range2&& __rng2, _Pred __pred)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    auto __first1 = __ranges::__begin(__rng1);
+    auto __first2 = __ranges::__begin(__rng2);
+    return oneapi::dpl::__internal::__pattern_find_first_of(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first1,
+                                                            __first1 + __ranges::__size(__rng1), __first2,
+                                                            __first2 + __ranges::__size(__rng2), __pred) -
+           __first1;
+}
+
+//------------------------------------------------------------------------
+// any_of
+//------------------------------------------------------------------------
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Range, typename _Pred>
+bool
+__pattern_any_of(_Tag __tag, _ExecutionPolicy&& __exec, _Range&& __rng, _Pred __pred)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    auto __first = __ranges::__begin(__rng);
+    return oneapi::dpl::__internal::__pattern_any_of(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first,
+                                                     __first + __ranges::__size(__rng), __pred);
+}
+
+//------------------------------------------------------------------------
+// search
+//------------------------------------------------------------------------
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Range1, typename _Range2, typename _Pred>
+oneapi::dpl::__internal::__difference_t<_Range1>
+__pattern_search(_Tag __tag, _ExecutionPolicy&& __exec, _Range1&& __rng1, _Range2&& __rng2, _Pred __pred)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    auto __first1 = __ranges::__begin(__rng1);
+    auto __first2 = __ranges::__begin(__rng2);
+    return oneapi::dpl::__internal::__pattern_search(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first1,
+                                                     __first1 + __ranges::__size(__rng1), __first2,
+                                                     __first2 + __ranges::__size(__rng2), __pred) -
+           __first1;
+}
+
+//------------------------------------------------------------------------
+// search_n
+//------------------------------------------------------------------------
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Range, typename _Size, typename _Tp,
+          typename _BinaryPredicate>
+oneapi::dpl::__internal::__difference_t<_Range>
+__pattern_search_n(_Tag __tag, _ExecutionPolicy&& __exec, _Range&& __rng, _Size __count, const _Tp& __value,
+                   _BinaryPredicate __pred)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    auto __first = __ranges::__begin(__rng);
+    return oneapi::dpl::__internal::__pattern_search_n(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first,
+                                                       __first + __ranges::__size(__rng), __count, __value, __pred) -
+           __first;
+}
+
+//------------------------------------------------------------------------
+// adjacent_find
+//------------------------------------------------------------------------
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Range, typename _BinaryPredicate, typename _OrFirstTag>
+oneapi::dpl::__internal::__difference_t<_Range>
+__pattern_adjacent_find(_Tag __tag, _ExecutionPolicy&& __exec, _Range&& __rng, _BinaryPredicate __predicate,
+                        _OrFirstTag __is__or_semantic)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    auto __first = __ranges::__begin(__rng);
+    return oneapi::dpl::__internal::__pattern_adjacent_find(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first,
+                                                            __first + __ranges::__size(__rng), __predicate,
+                                                            __is__or_semantic) -
+           __first;
+}
+
+//------------------------------------------------------------------------
+// count
+//------------------------------------------------------------------------
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Range, typename _Predicate>
+oneapi::dpl::__internal::__difference_t<_Range>
+__pattern_count(_Tag __tag, _ExecutionPolicy&& __exec, _Range&& __rng, _Predicate __predicate)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    auto __first = __ranges::__begin(__rng);
+    return oneapi::dpl::__internal::__pattern_count(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first,
+                                                    __first + __ranges::__size(__rng), __predicate);
+}
+
+//------------------------------------------------------------------------
+// copy_if
+//------------------------------------------------------------------------
+
+// The host patterns assign the elements themselves, so the assignment operation is not used
+template <typename _Tag, typename _ExecutionPolicy, typename _Range1, typename _Range2, typename _Predicate,
+          typename _Assign = oneapi::dpl::__internal::__pstl_assign>
+oneapi::dpl::__internal::__difference_t<_Range2>
+__pattern_copy_if(_Tag __tag, _ExecutionPolicy&& __exec, _Range1&& __rng1, _Range2&& __rng2, _Predicate __pred,
+                  _Assign)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    auto __first1 = __ranges::__begin(__rng1);
+    auto __result = __ranges::__begin(__rng2);
+    return oneapi::dpl::__internal::__pattern_copy_if(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first1,
+                                                      __first1 + __ranges::__size(__rng1), __result, __pred) -
+           __result;
+}
+
+//------------------------------------------------------------------------
+// remove_if
+//------------------------------------------------------------------------
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Range, typename _Predicate>
+oneapi::dpl::__internal::__difference_t<_Range>
+__pattern_remove_if(_Tag __tag, _ExecutionPolicy&& __exec, _Range&& __rng, _Predicate __pred)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    auto __first = __ranges::__begin(__rng);
+    return oneapi::dpl::__internal::__pattern_remove_if(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first,
+                                                        __first + __ranges::__size(__rng), __pred) -
+           __first;
+}
+
+//------------------------------------------------------------------------
+// unique_copy
+//------------------------------------------------------------------------
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Range1, typename _Range2, typename _BinaryPredicate,
+          typename _Assign = oneapi::dpl::__internal::__pstl_assign>
+oneapi::dpl::__internal::__difference_t<_Range2>
+__pattern_unique_copy(_Tag __tag, _ExecutionPolicy&& __exec, _Range1&& __rng, _Range2&& __result,
+                      _BinaryPredicate __pred, _Assign)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    auto __first = __ranges::__begin(__rng);
+    auto __first_result = __ranges::__begin(__result);
+    return oneapi::dpl::__internal::__pattern_unique_copy(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first,
+                                                          __first + __ranges::__size(__rng), __first_result, __pred) -
+           __first_result;
+}
+
+//------------------------------------------------------------------------
+// unique
+//------------------------------------------------------------------------
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Range, typename _BinaryPredicate>
+oneapi::dpl::__internal::__difference_t<_Range>
+__pattern_unique(_Tag __tag, _ExecutionPolicy&& __exec, _Range&& __rng, _BinaryPredicate __pred)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    auto __first = __ranges::__begin(__rng);
+    return oneapi::dpl::__internal::__pattern_unique(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first,
+                                                     __first + __ranges::__size(__rng), __pred) -
+           __first;
+}
+
+//------------------------------------------------------------------------
+// merge
+//------------------------------------------------------------------------
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Range1, typename _Range2, typename _Range3,
+          typename _Compare>
+oneapi::dpl::__internal::__difference_t<_Range3>
+__pattern_merge(_Tag __tag, _ExecutionPolicy&& __exec, _Range1&& __rng1, _Range2&& __rng2, _Range3&& __rng3,
+                _Compare __comp)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    auto __first1 = __ranges::__begin(__rng1);
+    auto __first2 = __ranges::__begin(__rng2);
+    auto __result = __ranges::__begin(__rng3);
+    return oneapi::dpl::__internal::__pattern_merge(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first1,
+                                                    __first1 + __ranges::__size(__rng1), __first2,
+                                                    __first2 + __ranges::__size(__rng2), __result, __comp) -
+           __result;
+}
+
+//------------------------------------------------------------------------
+// sort
+//------------------------------------------------------------------------
+
+// The sort of the range-based API is stable, as with the device policies
+template <typename _Tag, typename _ExecutionPolicy, typename _Range, typename _Compare, typename _Proj>
+void
+__pattern_sort(_Tag __tag, _ExecutionPolicy&& __exec, _Range&& __rng, _Compare __comp, _Proj __proj)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    auto __first = __ranges::__begin(__rng);
+    oneapi::dpl::__internal::__pattern_stable_sort(
+        __tag, ::std::forward<_ExecutionPolicy>(__exec), __first, __first + __ranges::__size(__rng),
+        [__comp, __proj](const auto& __a, const auto& __b) {
+            return __comp(::std::invoke(__proj, __a), ::std::invoke(__proj, __b));
+        });
+}
+
+//------------------------------------------------------------------------
+// min_element
+//------------------------------------------------------------------------
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Range, typename _Compare>
+oneapi::dpl::__internal::__difference_t<_Range>
+__pattern_min_element(_Tag __tag, _ExecutionPolicy&& __exec, _Range&& __rng, _Compare __comp)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    //If size == 1, result is the zero-indexed element. If size == 0, result is 0.
+    if (__ranges::__size(__rng) < 2)
+        return 0;
+
+    auto __first = __ranges::__begin(__rng);
+    return oneapi::dpl::__internal::__pattern_min_element(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first,
+                                                          __first + __ranges::__size(__rng), __comp) -
+           __first;
+}
+
+//------------------------------------------------------------------------
+// minmax_element
+//------------------------------------------------------------------------
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Range, typename _Compare>
+::std::pair<oneapi::dpl::__internal::__difference_t<_Range>, oneapi::dpl::__internal::__difference_t<_Range>>
+__pattern_minmax_element(_Tag __tag, _ExecutionPolicy&& __exec, _Range&& __rng, _Compare __comp)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    //If size == 1, result is the zero-indexed element. If size == 0, result is 0.
+    if (__ranges::__size(__rng) < 2)
+        return ::std::make_pair(0, 0);
+
+    auto __first = __ranges::__begin(__rng);
+    const auto __res = oneapi::dpl::__internal::__pattern_minmax_element(
+        __tag, ::std::forward<_ExecutionPolicy>(__exec), __first, __first + __ranges::__size(__rng), __comp);
+    return ::std::make_pair(__res.first - __first, __res.second - __first);
+}
+
+//------------------------------------------------------------------------
+// reduce_by_segment
+//------------------------------------------------------------------------
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Range1, typename _Range2, typename _Range3,
+          typename _Range4, typename _BinaryPredicate, typename _BinaryOperator>
+oneapi::dpl::__internal::__difference_t<_Range3>
+__pattern_reduce_by_segment(_Tag, _ExecutionPolicy&& __exec, _Range1&& __keys, _Range2&& __values,
+                            _Range3&& __out_keys, _Range4&& __out_values, _BinaryPredicate __binary_pred,
+                            _BinaryOperator __binary_op)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    auto __first = __ranges::__begin(__keys);
+    auto __result = __ranges::__begin(__out_keys);
+    return oneapi::dpl::reduce_by_segment(::std::forward<_ExecutionPolicy>(__exec), __first,
+                                          __first + __ranges::__size(__keys), __ranges::__begin(__values), __result,
+                                          __ranges::__begin(__out_values), __binary_pred, __binary_op)
+               .first -
+           __result;
+}
+
+} // namespace __ranges
+} // namespace __internal
+} // namespace dpl
+} // namespace oneapi
+
+#endif // _ONEDPL_ALGORITHM_RANGES_IMPL_H
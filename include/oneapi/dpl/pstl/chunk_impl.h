@@ -0,0 +1,252 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_CHUNK_IMPL_H
+#define _ONEDPL_CHUNK_IMPL_H
+
+#include <deque>
+#include <mutex>
+#include <optional>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "execution_impl.h"
+#include "parallel_backend.h"
+#include "utils.h"
+
+namespace oneapi
+{
+namespace dpl
+{
+namespace __internal
+{
+
+//------------------------------------------------------------------------
+// per-worker states of the chunks
+//------------------------------------------------------------------------
+
+// The states are copies of the initial state, created on demand: there are never more of them than the chunks
+// running at the same time. A released state is handed preferably to the thread which used it last, so a worker
+// keeps its own state across its chunks; a state is never shared by two chunks running at the same time, even when
+// a worker runs another chunk of the same loop while waiting in a nested algorithm.
+template <typename _State>
+class __chunk_state_pool
+{
+    struct __entry
+    {
+        _State _M_state;
+        ::std::thread::id _M_owner;
+
+        __entry(const _State& __state, ::std::thread::id __owner) : _M_state(__state), _M_owner(__owner) {}
+    };
+
+    const _State& _M_init;
+    ::std::mutex _M_mutex;
+    ::std::deque<__entry> _M_entries;
+    ::std::vector<__entry*> _M_free;
+
+  public:
+    explicit __chunk_state_pool(const _State& __init) : _M_init(__init) {}
+
+    __chunk_state_pool(const __chunk_state_pool&) = delete;
+    __chunk_state_pool&
+    operator=(const __chunk_state_pool&) = delete;
+
+    __entry*
+    __acquire()
+    {
+        const ::std::thread::id __self = ::std::this_thread::get_id();
+        ::std::lock_guard<::std::mutex> __lock(_M_mutex);
+        for (auto __it = _M_free.rbegin(); __it != _M_free.rend(); ++__it)
+        {
+            if ((*__it)->_M_owner == __self)
+            {
+                __entry* __e = *__it;
+                _M_free.erase(::std::next(__it).base());
+                return __e;
+            }
+        }
+        if (!_M_free.empty())
+        {
+            __entry* __e = _M_free.back();
+            _M_free.pop_back();
+            __e->_M_owner = __self;
+            return __e;
+        }
+        return &_M_entries.emplace_back(_M_init, __self);
+    }
+
+    void
+    __release(__entry* __e)
+    {
+        ::std::lock_guard<::std::mutex> __lock(_M_mutex);
+        _M_free.push_back(__e);
+    }
+
+    // Calls __f with a state held for the duration of the call
+    template <typename _Function, typename... _Args>
+    decltype(auto)
+    __with_state(_Function& __f, _Args&&... __args)
+    {
+        struct __lease
+        {
+            __chunk_state_pool* _M_pool;
+            __entry* _M_entry;
+            ~__lease() { _M_pool->__release(_M_entry); }
+        } __held{this, __acquire()};
+
+        return __f(__held._M_entry->_M_state, ::std::forward<_Args>(__args)...);
+    }
+};
+
+//------------------------------------------------------------------------
+// for_each_chunk
+//------------------------------------------------------------------------
+
+template <class _Tag, class _ExecutionPolicy, class _RandomAccessIterator, class _State, class _Function>
+void
+__pattern_for_each_chunk(_Tag, _ExecutionPolicy&&, _RandomAccessIterator __first, _RandomAccessIterator __last,
+                         const _State& __init_state, _Function __f)
+{
+    static_assert(__is_serial_tag_v<_Tag>);
+
+    if (__first == __last)
+        return;
+    _State __state(__init_state);
+    __f(__state, __first, __last);
+}
+
+// The chunks are the subranges the backend hands to the brick of __parallel_for
+template <class _IsVector, class _ExecutionPolicy, class _RandomAccessIterator, class _State, class _Function>
+void
+__pattern_for_each_chunk(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec, _RandomAccessIterator __first,
+                         _RandomAccessIterator __last, const _State& __init_state, _Function __f)
+{
+    using __backend_tag = typename __parallel_tag<_IsVector>::__backend_tag;
+
+    if (__first == __last)
+        return;
+
+    __internal::__except_handler([&]() {
+        __chunk_state_pool<_State> __states(__init_state);
+        __par_backend::__parallel_for(__backend_tag{}, ::std::forward<_ExecutionPolicy>(__exec), __first, __last,
+                                      [&__states, &__f](_RandomAccessIterator __i, _RandomAccessIterator __j) {
+                                          __states.__with_state(__f, __i, __j);
+                                      });
+    });
+}
+
+//------------------------------------------------------------------------
+// transform_reduce_chunk
+//------------------------------------------------------------------------
+
+template <class _Tag, class _ExecutionPolicy, class _RandomAccessIterator, class _State, class _Tp,
+          class _BinaryOperation, class _Function>
+_Tp
+__pattern_transform_reduce_chunk(_Tag, _ExecutionPolicy&&, _RandomAccessIterator __first,
+                                 _RandomAccessIterator __last, const _State& __init_state, _Tp __init,
+                                 _BinaryOperation __binary_op, _Function __f)
+{
+    static_assert(__is_serial_tag_v<_Tag>);
+
+    if (__first == __last)
+        return __init;
+    _State __state(__init_state);
+    return __binary_op(__init, __f(__state, __first, __last));
+}
+
+// The chunk results are the partial sums of __parallel_reduce; as the operation has no known identity, a partial
+// sum stays empty until its subrange has a chunk computed.
+template <class _IsVector, class _ExecutionPolicy, class _RandomAccessIterator, class _State, class _Tp,
+          class _BinaryOperation, class _Function>
+_Tp
+__pattern_transform_reduce_chunk(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec, _RandomAccessIterator __first,
+                                 _RandomAccessIterator __last, const _State& __init_state, _Tp __init,
+                                 _BinaryOperation __binary_op, _Function __f)
+{
+    using __backend_tag = typename __parallel_tag<_IsVector>::__backend_tag;
+    using _Partial = ::std::optional<_Tp>;
+
+    if (__first == __last)
+        return __init;
+
+    auto __combine = [__binary_op](const _Partial& __x, const _Partial& __y) -> _Partial {
+        if (!__x)
+            return __y;
+        if (!__y)
+            return __x;
+        return _Tp(__binary_op(*__x, *__y));
+    };
+
+    return __internal::__except_handler([&]() {
+        __chunk_state_pool<_State> __states(__init_state);
+        const _Partial __sum = __par_backend::__parallel_reduce(
+            __backend_tag{}, ::std::forward<_ExecutionPolicy>(__exec), __first, __last, _Partial{},
+            [&__states, &__f, __combine](_RandomAccessIterator __i, _RandomAccessIterator __j,
+                                         _Partial __partial) -> _Partial {
+                if (__i == __j)
+                    return __partial;
+                return __combine(__partial, _Tp(__states.__with_state(__f, __i, __j)));
+            },
+            __combine);
+        return __sum ? _Tp(__binary_op(__init, *__sum)) : __init;
+    });
+}
+
+} // namespace __internal
+
+// Calls f(state, chunk_first, chunk_last) for the chunks the sequence is split into by the backend. The state is
+// a copy of init_state reused by the chunks of a worker, so the chunks may keep their scratch data in it.
+template <typename _ExecutionPolicy, typename _RandomAccessIterator, typename _State, typename _Function>
+oneapi::dpl::__internal::__enable_if_execution_policy<_ExecutionPolicy, void>
+for_each_chunk(_ExecutionPolicy&& __exec, _RandomAccessIterator __first, _RandomAccessIterator __last,
+               const _State& __init_state, _Function __f)
+{
+    static_assert(oneapi::dpl::__internal::__is_host_execution_policy<::std::decay_t<_ExecutionPolicy>>::value,
+                  "for_each_chunk supports the host execution policies only");
+    static_assert(oneapi::dpl::__internal::__is_random_access_iterator_v<_RandomAccessIterator>,
+                  "for_each_chunk requires random access iterators");
+
+    const auto __dispatch_tag = oneapi::dpl::__internal::__select_backend(__exec, __first);
+
+    oneapi::dpl::__internal::__pattern_for_each_chunk(__dispatch_tag, ::std::forward<_ExecutionPolicy>(__exec), __first,
+                                                      __last, __init_state, __f);
+}
+
+// Reduces the results of f(state, chunk_first, chunk_last) with binary_op, starting from init
+template <typename _ExecutionPolicy, typename _RandomAccessIterator, typename _State, typename _Tp,
+          typename _BinaryOperation, typename _Function>
+oneapi::dpl::__internal::__enable_if_execution_policy<_ExecutionPolicy, _Tp>
+transform_reduce_chunk(_ExecutionPolicy&& __exec, _RandomAccessIterator __first, _RandomAccessIterator __last,
+                       const _State& __init_state, _Tp __init, _BinaryOperation __binary_op, _Function __f)
+{
+    static_assert(oneapi::dpl::__internal::__is_host_execution_policy<::std::decay_t<_ExecutionPolicy>>::value,
+                  "transform_reduce_chunk supports the host execution policies only");
+    static_assert(oneapi::dpl::__internal::__is_random_access_iterator_v<_RandomAccessIterator>,
+                  "transform_reduce_chunk requires random access iterators");
+
+    const auto __dispatch_tag = oneapi::dpl::__internal::__select_backend(__exec, __first);
+
+    return oneapi::dpl::__internal::__pattern_transform_reduce_chunk(
+        __dispatch_tag, ::std::forward<_ExecutionPolicy>(__exec), __first, __last, __init_state, __init, __binary_op,
+        __f);
+}
+
+} // namespace dpl
+} // namespace oneapi
+
+#endif // _ONEDPL_CHUNK_IMPL_H
@@ -18,28 +18,211 @@
 
 #include <type_traits>
 #include <iterator>
+#include <cstddef>
 
 namespace oneapi
 {
 namespace dpl
 {
+class scratch_memory_resource;
+
 namespace execution
 {
 inline namespace v1
 {
 
+// Extension: strategy used by the parallel host backends to split the iteration space
+enum class partitioner
+{
+    auto_,  // backend default: adaptive splitting driven by work stealing
+    simple, // split down to the grain size; every chunk is a separate task
+    static_ // split evenly among the worker threads with a deterministic thread-to-chunk mapping
+};
+
+// Extension: placement of the memory pages written by the parallel host algorithms on NUMA systems
+enum class numa_placement
+{
+    default_,   // pages land on the node of the thread that first writes to them
+    first_touch // static partitioning, and the pages of large scratch buffers are first touched in parallel
+};
+
+// Extension: backing of the large temporary buffers of the parallel host algorithms by 2 MiB pages (Linux only)
+enum class huge_pages
+{
+    default_, // as set by the ONEDPL_SCRATCH_HUGE_PAGES macro, disabled by default
+    enabled,  // 2 MiB aligned and advised for transparent huge pages
+    disabled
+};
+
+// Extension: non-temporal stores of the large fills and copies of the vectorized host algorithms (x86 only), which
+// bypass the caches for the destinations not read again soon
+enum class streaming_stores
+{
+    default_, // as set by the ONEDPL_STREAMING_STORES macro, disabled by default
+    enabled,  // for the destinations of any size
+    disabled
+};
+
+// Extension: minimal number of elements processed by a single task of the parallel host backends
+struct grainsize
+{
+    std::size_t value;
+
+    constexpr explicit grainsize(std::size_t __value) : value(__value) {}
+};
+
+// Extension: cost of processing an element relative to copying it. The data sizes below which the parallel host
+// backends run a loop on the calling thread are divided by it.
+struct cost_hint
+{
+    std::size_t value;
+
+    constexpr explicit cost_hint(std::size_t __value) : value(__value) {}
+};
+
+// Extension: maximal number of threads used by a parallel host algorithm
+struct num_threads
+{
+    std::size_t value;
+
+    constexpr explicit num_threads(std::size_t __value) : value(__value) {}
+};
+
+// Extension: reference to an arena (e.g. tbb::task_arena) the parallel host algorithms are executed in.
+// The arena must outlive every algorithm call made with the policy.
+template <typename _Arena>
+class arena
+{
+  public:
+    constexpr explicit arena(_Arena& __arena) : _M_arena(&__arena) {}
+
+    constexpr _Arena&
+    get() const
+    {
+        return *_M_arena;
+    }
+
+  private:
+    _Arena* _M_arena;
+};
+
+// Extension: resource the temporary buffers of the parallel host algorithms are obtained from.
+// The resource must outlive every algorithm call made with the policy.
+struct scratch_resource
+{
+    oneapi::dpl::scratch_memory_resource* value;
+
+    constexpr explicit scratch_resource(oneapi::dpl::scratch_memory_resource* __value) : value(__value) {}
+};
+
+// Tuning parameters carried by the parallel host policies; zero, auto_ and null select the backend defaults
+struct __host_policy_params
+{
+    std::size_t __grainsize = 0;
+    partitioner __partitioner = partitioner::auto_;
+    std::size_t __num_threads = 0;
+    numa_placement __numa_placement = numa_placement::default_;
+    // Type-erased arena: __arena_execute(__arena, __body, __context) calls __body(__context) inside the arena
+    void* __arena = nullptr;
+    void (*__arena_execute)(void*, void (*)(void*), void*) = nullptr;
+    // Null selects the process-wide default resource
+    oneapi::dpl::scratch_memory_resource* __scratch_resource = nullptr;
+    huge_pages __huge_pages = huge_pages::default_;
+    std::size_t __cost_hint = 1;
+    streaming_stores __streaming_stores = streaming_stores::default_;
+};
+
+// Extension: policy.with(params...) returns a copy of the policy with the given tuning parameters applied
+template <typename _Policy>
+class __host_policy_tuning
+{
+  public:
+    template <typename... _Params>
+    constexpr _Policy
+    with(_Params... __params) const
+    {
+        _Policy __policy(static_cast<const _Policy&>(*this));
+        (static_cast<__host_policy_tuning&>(__policy).__set(__params), ...);
+        return __policy;
+    }
+
+    constexpr const __host_policy_params&
+    __get_params() const
+    {
+        return _M_params;
+    }
+
+  private:
+    constexpr void
+    __set(grainsize __g)
+    {
+        _M_params.__grainsize = __g.value;
+    }
+    constexpr void
+    __set(partitioner __p)
+    {
+        _M_params.__partitioner = __p;
+    }
+    constexpr void
+    __set(numa_placement __p)
+    {
+        _M_params.__numa_placement = __p;
+        // Pages are placed on the nodes of the threads processing them only if every loop maps chunks to threads
+        // the same way
+        if (__p == numa_placement::first_touch)
+            _M_params.__partitioner = partitioner::static_;
+    }
+    constexpr void
+    __set(num_threads __n)
+    {
+        _M_params.__num_threads = __n.value;
+    }
+    template <typename _Arena>
+    constexpr void
+    __set(arena<_Arena> __a)
+    {
+        _M_params.__arena = &__a.get();
+        _M_params.__arena_execute = [](void* __arena, void (*__body)(void*), void* __context) {
+            auto __f = [__body, __context]() { __body(__context); };
+            static_cast<_Arena*>(__arena)->execute(__f);
+        };
+    }
+    constexpr void
+    __set(scratch_resource __r)
+    {
+        _M_params.__scratch_resource = __r.value;
+    }
+    constexpr void
+    __set(huge_pages __h)
+    {
+        _M_params.__huge_pages = __h;
+    }
+    constexpr void
+    __set(cost_hint __c)
+    {
+        _M_params.__cost_hint = __c.value ? __c.value : 1;
+    }
+    constexpr void
+    __set(streaming_stores __s)
+    {
+        _M_params.__streaming_stores = __s;
+    }
+
+    __host_policy_params _M_params;
+};
+
 // 2.4, Sequential execution policy
 class sequenced_policy
 {
 };
 
 // 2.5, Parallel execution policy
-class parallel_policy
+class parallel_policy : public __host_policy_tuning<parallel_policy>
 {
 };
 
 // 2.6, Parallel+Vector execution policy
-class parallel_unsequenced_policy
+class parallel_unsequenced_policy : public __host_policy_tuning<parallel_unsequenced_policy>
 {
 };
 
@@ -108,6 +291,17 @@ struct __is_host_execution_policy<oneapi::dpl::execution::unsequenced_policy> :
 {
 };
 
+// Tuning parameters of a host policy, or the backend defaults for policies that carry none
+template <class _ExecPolicy>
+constexpr oneapi::dpl::execution::__host_policy_params
+__get_host_policy_params(const _ExecPolicy& __exec)
+{
+    if constexpr (::std::is_base_of_v<oneapi::dpl::execution::__host_policy_tuning<_ExecPolicy>, _ExecPolicy>)
+        return __exec.__get_params();
+    else
+        return {};
+}
+
 template <class _ExecPolicy, class _T = void>
 using __enable_if_execution_policy =
     ::std::enable_if_t<oneapi::dpl::execution::is_execution_policy_v<::std::decay_t<_ExecPolicy>>, _T>;
@@ -153,6 +347,10 @@ struct __omp_backend_tag
 {
 };
 
+struct __std_thread_backend_tag
+{
+};
+
 //------------------------------------------------------------------------
 // dispatch tags
 //------------------------------------------------------------------------
@@ -38,6 +38,8 @@ namespace __internal
 using __par_backend_tag = __tbb_backend_tag;
 #elif _ONEDPL_PAR_BACKEND_OPENMP
 using __par_backend_tag = __omp_backend_tag;
+#elif _ONEDPL_PAR_BACKEND_STD_THREAD
+using __par_backend_tag = __std_thread_backend_tag;
 #elif _ONEDPL_PAR_BACKEND_SERIAL
 using __par_backend_tag = __serial_backend_tag;
 #else
@@ -160,6 +162,32 @@ inline constexpr bool __is_host_dispatch_tag_v =
     __is_serial_tag_v<_Tag> || __is_parallel_forward_tag_v<_Tag> || __is_parallel_tag_v<_Tag>;
 
 } // namespace __internal
+
+namespace __ranges
+{
+
+//----------------------------------------------------------
+// __select_backend (for the host policies)
+//----------------------------------------------------------
+
+template <typename _Range>
+using __range_iterator_t = decltype(::std::begin(::std::declval<_Range&>()));
+
+// The host patterns of the range-based API run over the iterators of the ranges, so the tag is selected
+// as for those iterators
+template <typename _ExecutionPolicy, typename... _Ranges>
+auto
+__select_backend(const _ExecutionPolicy& __exec, _Ranges&&...)
+    -> ::std::enable_if_t<oneapi::dpl::__internal::__is_host_execution_policy<_ExecutionPolicy>::value,
+                          decltype(oneapi::dpl::__internal::__select_backend(
+                              __exec, ::std::declval<__range_iterator_t<_Ranges>>()...))>
+{
+    static_assert(oneapi::dpl::__internal::__is_random_access_iterator_v<__range_iterator_t<_Ranges>...>,
+                  "The range-based algorithms require random access ranges");
+    return {};
+}
+
+} // namespace __ranges
 } // namespace dpl
 } // namespace oneapi
 
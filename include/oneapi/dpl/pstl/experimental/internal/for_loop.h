@@ -16,6 +16,8 @@
 #ifndef _ONEDPL_EXPERIMENTAL_FOR_LOOP_H
 #define _ONEDPL_EXPERIMENTAL_FOR_LOOP_H
 
+#include <array>
+#include <cstddef>
 #include <tuple>
 
 #include "../../onedpl_config.h"
@@ -98,6 +100,42 @@ for_loop_n_strided(_ExecutionPolicy&& __exec, _Ip __start, _Size __n, _Sp __stri
                                                  ::std::forward_as_tuple(::std::forward<_Rest>(__rest)...));
 }
 
+// Extension: order in which for_loop_nd visits the tiles of an index space
+enum class tile_order
+{
+    row_major, // the last dimension varies fastest
+    morton     // Z-order curve, keeping the tiles processed one after another close in every dimension
+};
+
+// Extension: loop over the N-dimensional index space [0, __extents), partitioned into tiles of __tile_shape
+// processed in parallel, the innermost dimension of a tile being a vectorizable loop. A non-positive extent of
+// __tile_shape is chosen by the implementation. The callable receives the index as std::array, followed by the
+// reduction and induction values; an induction advances by the row-major ordinal of the index.
+template <typename _ExecutionPolicy, typename _Index, ::std::size_t _Rank, typename... _Rest>
+void
+for_loop_nd(_ExecutionPolicy&& __exec, const ::std::array<_Index, _Rank>& __extents,
+            const ::std::array<_Index, _Rank>& __tile_shape, tile_order __order, _Rest&&... __rest)
+{
+    static_assert(oneapi::dpl::__internal::__is_host_execution_policy<::std::decay_t<_ExecutionPolicy>>::value,
+                  "for_loop_nd is implemented for the host policies only");
+    static_assert(::std::is_integral_v<_Index>, "for_loop_nd requires an integral index type");
+
+    oneapi::dpl::__internal::__for_loop_nd_repack(
+        ::std::forward<_ExecutionPolicy>(__exec),
+        oneapi::dpl::__internal::__tiled_space<_Index, _Rank>(__extents, __tile_shape, __order == tile_order::morton),
+        ::std::forward_as_tuple(::std::forward<_Rest>(__rest)...));
+}
+
+template <typename _ExecutionPolicy, typename _Index, ::std::size_t _Rank, typename... _Rest>
+void
+for_loop_nd(_ExecutionPolicy&& __exec, const ::std::array<_Index, _Rank>& __extents,
+            const ::std::array<_Index, _Rank>& __tile_shape, _Rest&&... __rest)
+{
+    oneapi::dpl::experimental::parallelism_v2::for_loop_nd(::std::forward<_ExecutionPolicy>(__exec), __extents,
+                                                           __tile_shape, tile_order::row_major,
+                                                           ::std::forward<_Rest>(__rest)...);
+}
+
 // Serial implementations
 template <typename _Ip, typename... _Rest>
 void
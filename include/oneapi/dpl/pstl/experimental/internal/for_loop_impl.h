@@ -16,6 +16,7 @@
 #ifndef _ONEDPL_EXPERIMENTAL_FOR_LOOP_IMPL_H
 #define _ONEDPL_EXPERIMENTAL_FOR_LOOP_IMPL_H
 
+#include <array>
 #include <iterator>
 #include <type_traits>
 #include <utility>
@@ -91,6 +92,86 @@ __calculate_input_sequence_length(const _Ip __first, const _Ip __last, __single_
     return __last - __first;
 }
 
+template <typename _Tp, typename _Combiner>
+class __reduction_object;
+
+// Whether the pack of reduction and induction objects carries state between the iterations: induction objects
+// compute their values from the ordinal position, so the iterations of a loop without reduction objects are
+// independent.
+template <typename _Tp>
+struct __is_reduction_object : ::std::false_type
+{
+};
+
+template <typename _Tp, typename _Combiner>
+struct __is_reduction_object<__reduction_object<_Tp, _Combiner>> : ::std::true_type
+{
+};
+
+template <typename... _Rest>
+inline constexpr bool __has_reduction_v = (__is_reduction_object<::std::decay_t<_Rest>>::value || ...);
+
+// Number of lanes of a vectorized loop with reduction objects
+constexpr ::std::size_t __for_loop_lanes = 8;
+
+template <typename _Tp, ::std::size_t... _Is>
+::std::array<_Tp, sizeof...(_Is)>
+__replicate(const _Tp& __value, ::std::index_sequence<_Is...>)
+{
+    return {{((void)_Is, __value)...}};
+}
+
+// State of an induction object in the lanes of a vectorized loop: its values only depend on the ordinal position
+template <typename _Object>
+class __lane_state
+{
+    _Object __object_;
+
+  public:
+    explicit __lane_state(const _Object& __object) : __object_(__object) {}
+
+    template <typename _Index>
+    decltype(auto)
+    __get_induction_or_reduction_value(::std::size_t, _Index __p)
+    {
+        return __object_.__get_induction_or_reduction_value(__p);
+    }
+
+    void
+    __combine_into(_Object&) const
+    {
+    }
+};
+
+// State of a reduction object in the lanes of a vectorized loop: a private accumulator per lane, stored contiguously
+// so that a SIMD loop updates the accumulators of all the lanes with vector instructions
+template <typename _Tp, typename _Combiner>
+class __lane_state<__reduction_object<_Tp, _Combiner>>
+{
+    ::std::array<_Tp, __for_loop_lanes> __acc_;
+
+  public:
+    explicit __lane_state(const __reduction_object<_Tp, _Combiner>& __object)
+        : __acc_(oneapi::dpl::__internal::__replicate(__object.__accumulator(),
+                                                      ::std::make_index_sequence<__for_loop_lanes>{}))
+    {
+    }
+
+    template <typename _Index>
+    _Tp&
+    __get_induction_or_reduction_value(::std::size_t __lane, _Index)
+    {
+        return __acc_[__lane];
+    }
+
+    void
+    __combine_into(__reduction_object<_Tp, _Combiner>& __object) const
+    {
+        for (const _Tp& __acc : __acc_)
+            __object.__accumulate(__acc);
+    }
+};
+
 // A tag for compiler to distinguish between copy and variadic argument constructors.
 struct __reduction_pack_tag
 {
@@ -104,6 +185,11 @@ class __reduction_pack
     // to avoid modification of the original ones.
     ::std::tuple<::std::remove_cv_t<::std::remove_reference_t<_Ts>>...> __objects_;
 
+  public:
+    // Lane-private state of the objects for a vectorized loop
+    using __lanes_type = ::std::tuple<__lane_state<::std::remove_cv_t<::std::remove_reference_t<_Ts>>>...>;
+
+  private:
     template <typename _Fp, typename _Ip, typename _Position, ::std::size_t... _Is>
     void
     __apply_func_impl(_Fp&& __f, _Ip __current, _Position __p, ::std::index_sequence<_Is...>)
@@ -119,6 +205,23 @@ class __reduction_pack
             0, ((void)::std::get<_Is>(__objects_).__combine(::std::get<_Is>(__other.__objects_)), 0)...};
     }
 
+    template <typename _Fp, typename _Ip, typename _Position, ::std::size_t... _Is>
+    static void
+    __apply_func_lane_impl(__lanes_type& __lanes, _Fp&& __f, _Ip __current, _Position __p, ::std::size_t __lane,
+                           ::std::index_sequence<_Is...>)
+    {
+        ::std::forward<_Fp>(__f)(__current,
+                                 ::std::get<_Is>(__lanes).__get_induction_or_reduction_value(__lane, __p)...);
+    }
+
+    template <::std::size_t... _Is>
+    void
+    __combine_lanes_impl(const __lanes_type& __lanes, ::std::index_sequence<_Is...>)
+    {
+        (void)::std::initializer_list<int>{
+            0, ((void)::std::get<_Is>(__lanes).__combine_into(::std::get<_Is>(__objects_)), 0)...};
+    }
+
     template <typename _RangeSize, ::std::size_t... _Is>
     void
     __finalize_impl(const _RangeSize __n, ::std::index_sequence<_Is...>)
@@ -127,6 +230,8 @@ class __reduction_pack
     }
 
   public:
+    static constexpr bool __has_reduction = __has_reduction_v<_Ts...>;
+
     template <typename... _Args>
     __reduction_pack(__reduction_pack_tag, _Args&&... __args) : __objects_(::std::make_tuple(__args...))
     {
@@ -153,6 +258,28 @@ class __reduction_pack
         __apply_func_impl(::std::forward<_Fp>(__f), __current, __p, ::std::make_index_sequence<sizeof...(_Ts)>{});
     }
 
+    // Lanes starting from the state of this pack, which is expected to be the identity
+    __lanes_type
+    __make_lanes() const
+    {
+        return ::std::apply([](const auto&... __objects) { return __lanes_type(__objects...); }, __objects_);
+    }
+
+    // Apply __f in the lane __lane of __lanes
+    template <typename _Fp, typename _Ip, typename _Position>
+    static void
+    __apply_func(__lanes_type& __lanes, _Fp&& __f, _Ip __current, _Position __p, ::std::size_t __lane)
+    {
+        __apply_func_lane_impl(__lanes, ::std::forward<_Fp>(__f), __current, __p, __lane,
+                               ::std::make_index_sequence<sizeof...(_Ts)>{});
+    }
+
+    void
+    __combine(const __lanes_type& __lanes)
+    {
+        __combine_lanes_impl(__lanes, ::std::make_index_sequence<sizeof...(_Ts)>{});
+    }
+
     template <typename _RangeSize>
     void
     __finalize(const _RangeSize __n)
@@ -161,6 +288,62 @@ class __reduction_pack
     }
 };
 
+// Run the iterations [__offset, __offset + __n) of a loop, __element(__i) being the element of the iteration __i
+template <typename _Size, typename _Pack, typename _Function, typename _Element>
+void
+__brick_for_loop_n(_Size __offset, _Size __n, _Pack& __pack, const _Pack&, _Function __f, _Element __element,
+                   /*vector=*/::std::false_type) noexcept
+{
+    for (_Size __i = __offset; __i < __offset + __n; ++__i)
+        __pack.__apply_func(__f, __element(__i), __i);
+}
+
+// The iterations of a loop with reduction objects accumulate into lane-private copies of the identity,
+// the iteration __i into the lane __i % __for_loop_lanes, so that the iterations of a block have no dependency on
+// each other and run in SIMD lanes. The lanes are combined into __pack at the end.
+template <typename _Size, typename _Pack, typename _Function, typename _Element>
+void
+__brick_for_loop_n(_Size __offset, _Size __n, _Pack& __pack, const _Pack& __identity, _Function __f,
+                   _Element __element, /*vector=*/::std::true_type) noexcept
+{
+    constexpr _Size __block_size = __for_loop_lanes;
+    if constexpr (!_Pack::__has_reduction)
+    {
+        oneapi::dpl::__internal::__brick_walk1(
+            __n, [&__pack, __f, __element, __offset](_Size __idx) {
+                __pack.__apply_func(__f, __element(__offset + __idx), __offset + __idx);
+            },
+            ::std::true_type{});
+    }
+    else if (__n < 2 * __block_size)
+    {
+        oneapi::dpl::__internal::__brick_for_loop_n(__offset, __n, __pack, __identity, __f, __element,
+                                                    ::std::false_type{});
+    }
+    else
+    {
+        typename _Pack::__lanes_type __lanes = __identity.__make_lanes();
+        // main loop
+        const _Size __last_iteration = __offset + __block_size * (__n / __block_size);
+        for (_Size __i = __offset; __i < __last_iteration; __i += __block_size)
+        {
+            _ONEDPL_PRAGMA_SIMD
+            for (_Size __j = 0; __j < __block_size; ++__j)
+            {
+                _Pack::__apply_func(__lanes, __f, __element(__i + __j), __i + __j, __j);
+            }
+        }
+        // remainder
+        _ONEDPL_PRAGMA_SIMD
+        for (_Size __j = 0; __j < __offset + __n - __last_iteration; ++__j)
+        {
+            _Pack::__apply_func(__lanes, __f, __element(__last_iteration + __j), __last_iteration + __j, __j);
+        }
+        // combiner
+        __pack.__combine(__lanes);
+    }
+}
+
 // Sequenced version of for_loop_n
 template <typename _ExecutionPolicy, typename _Ip, typename _Size, typename _Function, typename... _Rest>
 void
@@ -345,9 +528,10 @@ __pattern_for_loop_n(_ExecutionPolicy&&, _Ip __first, _Size __n, _Function __f,
                      /*vector=*/::std::true_type, /*parallel=*/::std::false_type, _Rest&&... __rest) noexcept
 {
     __reduction_pack<_Rest...> __pack{__reduction_pack_tag(), ::std::forward<_Rest>(__rest)...};
+    const __reduction_pack<_Rest...> __identity(__pack);
 
-    oneapi::dpl::__internal::__brick_walk1(
-        __n, [&__pack, __first, __f](_Size __idx) { __pack.__apply_func(__f, __first + __idx, __idx); },
+    oneapi::dpl::__internal::__brick_for_loop_n(
+        _Size(0), __n, __pack, __identity, __f, [__first](_Size __idx) { return __first + __idx; },
         ::std::true_type{});
 
     __pack.__finalize(__n);
@@ -359,11 +543,11 @@ __pattern_for_loop_n(_ExecutionPolicy&&, _Ip __first, _Size __n, _Function __f,
                      /*vector=*/::std::true_type, /*parallel=*/::std::false_type, _Rest&&... __rest) noexcept
 {
     __reduction_pack<_Rest...> __pack{__reduction_pack_tag(), ::std::forward<_Rest>(__rest)...};
+    const __reduction_pack<_Rest...> __identity(__pack);
 
-    oneapi::dpl::__internal::__brick_walk1(
-        __n,
-        [&__pack, __first, __f, __stride](_Size __idx) { __pack.__apply_func(__f, __first + __idx * __stride, __idx); },
-        ::std::true_type{});
+    oneapi::dpl::__internal::__brick_for_loop_n(
+        _Size(0), __n, __pack, __identity, __f,
+        [__first, __stride](_Size __idx) { return __first + __idx * __stride; }, ::std::true_type{});
 
     __pack.__finalize(__n);
 }
@@ -382,15 +566,13 @@ __pattern_for_loop(_ExecutionPolicy&& __exec, _Ip __first, _Ip __last, _Function
 
 // Parallel version of for_loop_n
 
-// TODO: Using parallel_reduce when we don't have a reduction object in the pack might be ineffective,
-// perhaps it's better to check for presence of reduction object and call parallel_for routine instead.
-// TODO: need to add a static_assert for match between rest and f's arguments, currently there is a lot
-// of unclear error in cast of mismatch.
-template <typename _ExecutionPolicy, typename _Ip, typename _Size, typename _Function, typename _IsVector,
-          typename... _Rest>
+// Run a loop of __n iterations split into __n_blocks blocks in parallel, __brick(__i, __j, __pack, __identity)
+// running the blocks [__i, __j) and accumulating into __pack. A loop without reduction objects runs as
+// a parallel for; the reduction objects of a loop with them are copied per chunk of a parallel reduction.
+template <typename _ExecutionPolicy, typename _Size, typename _Brick, typename _IsVector, typename... _Rest>
 void
-__pattern_for_loop_n(_ExecutionPolicy&& __exec, _Ip __first, _Size __n, _Function __f, __single_stride_type,
-                     _IsVector __is_vector, /*parallel=*/::std::true_type, _Rest&&... __rest)
+__for_loop_parallel(_ExecutionPolicy&& __exec, _Size __n_blocks, _Size __n, _Brick __brick, _IsVector,
+                    _Rest&&... __rest)
 {
     using __pack_type = __reduction_pack<_Rest...>;
 
@@ -398,28 +580,64 @@ __pattern_for_loop_n(_ExecutionPolicy&& __exec, _Ip __first, _Size __n, _Functio
     const __pack_type __identity{__reduction_pack_tag(), ::std::forward<_Rest>(__rest)...};
 
     using __backend_tag = typename oneapi::dpl::__internal::__parallel_tag<_IsVector>::__backend_tag;
-    oneapi::dpl::__internal::__except_handler([&]() {
-        return __par_backend::__parallel_reduce(
-                   __backend_tag{}, ::std::forward<_ExecutionPolicy>(__exec), _Size(0), __n, __identity,
-                   [__is_vector, __first, __f](_Size __i, _Size __j, __pack_type __value) {
-                       const auto __subseq_start = __first + __i;
-                       const auto __length = __j - __i;
-
-                       oneapi::dpl::__internal::__brick_walk1(
-                           __length,
-                           [&__value, __f, __i, __subseq_start](_Size __idx) {
-                               __value.__apply_func(__f, __subseq_start + __idx, __i + __idx);
-                           },
-                           __is_vector);
-
-                       return __value;
-                   },
-                   [](__pack_type __lhs, const __pack_type& __rhs) {
-                       __lhs.__combine(__rhs);
-                       return __lhs;
-                   })
-            .__finalize(__n);
-    });
+    if constexpr (!__pack_type::__has_reduction)
+    {
+        oneapi::dpl::__internal::__except_handler([&]() {
+            __par_backend::__parallel_for(__backend_tag{}, ::std::forward<_ExecutionPolicy>(__exec), _Size(0),
+                                          __n_blocks, [__brick, &__identity](_Size __i, _Size __j) {
+                                              __pack_type __value(__identity);
+                                              __brick(__i, __j, __value, __identity);
+                                          });
+        });
+        // The induction objects are stateless, so any copy sets the final values
+        __pack_type __result(__identity);
+        __result.__finalize(__n);
+    }
+    else
+    {
+        oneapi::dpl::__internal::__except_handler([&]() {
+            return __par_backend::__parallel_reduce(
+                       __backend_tag{}, ::std::forward<_ExecutionPolicy>(__exec), _Size(0), __n_blocks, __identity,
+                       [__brick, &__identity](_Size __i, _Size __j, __pack_type __value) {
+                           __brick(__i, __j, __value, __identity);
+                           return __value;
+                       },
+                       [](__pack_type __lhs, const __pack_type& __rhs) {
+                           __lhs.__combine(__rhs);
+                           return __lhs;
+                       })
+                .__finalize(__n);
+        });
+    }
+}
+
+// __element(__i) is the element of the iteration __i.
+// TODO: need to add a static_assert for match between rest and f's arguments, currently there is a lot
+// of unclear error in cast of mismatch.
+template <typename _ExecutionPolicy, typename _Size, typename _Function, typename _Element, typename _IsVector,
+          typename... _Rest>
+void
+__for_loop_n_parallel(_ExecutionPolicy&& __exec, _Size __n, _Function __f, _Element __element, _IsVector __is_vector,
+                      _Rest&&... __rest)
+{
+    oneapi::dpl::__internal::__for_loop_parallel(
+        ::std::forward<_ExecutionPolicy>(__exec), __n, __n,
+        [__f, __element, __is_vector](_Size __i, _Size __j, auto& __pack, const auto& __identity) {
+            oneapi::dpl::__internal::__brick_for_loop_n(__i, __j - __i, __pack, __identity, __f, __element,
+                                                        __is_vector);
+        },
+        __is_vector, ::std::forward<_Rest>(__rest)...);
+}
+
+template <typename _ExecutionPolicy, typename _Ip, typename _Size, typename _Function, typename _IsVector,
+          typename... _Rest>
+void
+__pattern_for_loop_n(_ExecutionPolicy&& __exec, _Ip __first, _Size __n, _Function __f, __single_stride_type,
+                     _IsVector __is_vector, /*parallel=*/::std::true_type, _Rest&&... __rest)
+{
+    oneapi::dpl::__internal::__for_loop_n_parallel(
+        ::std::forward<_ExecutionPolicy>(__exec), __n, __f, [__first](_Size __idx) { return __first + __idx; },
+        __is_vector, ::std::forward<_Rest>(__rest)...);
 }
 
 template <typename _ExecutionPolicy, typename _Ip, typename _Size, typename _Function, typename _Sp, typename _IsVector,
@@ -428,34 +646,10 @@ void
 __pattern_for_loop_n(_ExecutionPolicy&& __exec, _Ip __first, _Size __n, _Function __f, _Sp __stride,
                      _IsVector __is_vector, /*parallel=*/::std::true_type, _Rest&&... __rest)
 {
-    using __pack_type = __reduction_pack<_Rest...>;
-
-    // Create an identity pack object, operations are done on copies of it.
-    const __pack_type __identity{__reduction_pack_tag(), ::std::forward<_Rest>(__rest)...};
-
-    using __backend_tag = typename oneapi::dpl::__internal::__parallel_tag<_IsVector>::__backend_tag;
-    oneapi::dpl::__internal::__except_handler([&]() {
-        return __par_backend::__parallel_reduce(
-                   __backend_tag{}, ::std::forward<_ExecutionPolicy>(__exec), _Size(0), __n, __identity,
-                   [__is_vector, __first, __f, __stride](_Size __i, _Size __j, __pack_type __value) {
-                       const auto __subseq_start = __first + __i * __stride;
-                       const auto __length = __j - __i;
-
-                       oneapi::dpl::__internal::__brick_walk1(
-                           __length,
-                           [&__value, __f, __i, __subseq_start, __stride](_Size __idx) {
-                               __value.__apply_func(__f, __subseq_start + __idx * __stride, __i + __idx);
-                           },
-                           __is_vector);
-
-                       return __value;
-                   },
-                   [](__pack_type __lhs, const __pack_type& __rhs) {
-                       __lhs.__combine(__rhs);
-                       return __lhs;
-                   })
-            .__finalize(__n);
-    });
+    oneapi::dpl::__internal::__for_loop_n_parallel(
+        ::std::forward<_ExecutionPolicy>(__exec), __n, __f,
+        [__first, __stride](_Size __idx) { return __first + __idx * __stride; }, __is_vector,
+        ::std::forward<_Rest>(__rest)...);
 }
 
 template <typename _ExecutionPolicy, typename _Ip, typename _Function, typename _Sp, typename _IsVector,
@@ -471,6 +665,233 @@ __pattern_for_loop(_ExecutionPolicy&& __exec, _Ip __first, _Ip __last, _Function
         __is_vector, ::std::true_type{}, ::std::forward<_Rest>(__rest)...);
 }
 
+//------------------------------------------------------------------------
+// for_loop_nd
+//------------------------------------------------------------------------
+
+// Number of elements of a tile whose extents are chosen by the implementation: 16-32 KiB of 4-8 byte elements
+constexpr ::std::size_t __for_loop_nd_tile_size = 4096;
+// Maximal extent of the innermost dimension of such a tile
+constexpr ::std::size_t __for_loop_nd_row_size = 512;
+// Maximal number of bits of a Morton code of a tile; larger grids of tiles are visited in row-major order
+constexpr unsigned __for_loop_nd_max_morton_bits = 48;
+
+// N-dimensional index space of for_loop_nd partitioned into tiles. The elements are numbered in row-major order,
+// the last dimension being contiguous; the tiles are numbered in row-major or Morton order.
+template <typename _Index, ::std::size_t _Rank>
+class __tiled_space
+{
+    static_assert(_Rank > 0, "for_loop_nd requires a non-empty index space");
+
+  public:
+    using __size_type = typename __difference<_Index>::__type;
+    using __index_type = ::std::array<_Index, _Rank>;
+
+  private:
+    __index_type __extents_;
+    __index_type __tile_;
+    // Number of tiles along each dimension
+    ::std::array<__size_type, _Rank> __tiles_;
+    // Number of bits of the tile coordinates along each dimension in a Morton code
+    ::std::array<unsigned, _Rank> __bits_;
+    bool __morton_;
+    __size_type __n_codes_;
+    __size_type __n_;
+
+  public:
+    // A non-positive extent of __tile_shape selects the extent of the tiles along that dimension so that a tile holds
+    // about __for_loop_nd_tile_size elements, starting from the innermost dimension
+    __tiled_space(const __index_type& __extents, const __index_type& __tile_shape, bool __morton)
+        : __extents_(__extents), __morton_(__morton), __n_codes_(1), __n_(1)
+    {
+        __size_type __budget = __for_loop_nd_tile_size;
+        unsigned __total_bits = 0;
+        for (::std::size_t __d = _Rank; __d-- > 0;)
+        {
+            const __size_type __extent = __extents[__d] > 0 ? __size_type(__extents[__d]) : 0;
+            __size_type __tile = __tile_shape[__d];
+            if (__tile <= 0)
+            {
+                const __size_type __cap =
+                    __d == _Rank - 1 ? ::std::min<__size_type>(__budget, __for_loop_nd_row_size) : __budget;
+                __tile = ::std::max<__size_type>(1, ::std::min(__extent, __cap));
+            }
+            __tile_[__d] = _Index(__tile);
+            __budget = ::std::max<__size_type>(1, __budget / __tile);
+
+            __tiles_[__d] = (__extent + __tile - 1) / __tile;
+            __n_ *= __extent;
+            __bits_[__d] = 0;
+            while ((__size_type(1) << __bits_[__d]) < __tiles_[__d])
+                ++__bits_[__d];
+            __total_bits += __bits_[__d];
+        }
+        __morton_ = __morton_ && __total_bits < __for_loop_nd_max_morton_bits;
+        if (__n_ == 0)
+            __n_codes_ = 0;
+        else if (__morton_)
+            __n_codes_ = __size_type(1) << __total_bits;
+        else
+            for (__size_type __tiles : __tiles_)
+                __n_codes_ *= __tiles;
+    }
+
+    // Number of elements
+    __size_type
+    __size() const
+    {
+        return __n_;
+    }
+
+    // Number of tile ordinals, including the Morton codes outside of the grid of tiles
+    __size_type
+    __n_codes() const
+    {
+        return __n_codes_;
+    }
+
+    __size_type
+    __tile_size() const
+    {
+        __size_type __size = 1;
+        for (_Index __extent : __tile_)
+            __size *= __extent;
+        return __size;
+    }
+
+    // Bounds of the tile of the ordinal __t; false for a Morton code outside of the grid of tiles
+    bool
+    __tile_bounds(__size_type __t, __index_type& __begin, __index_type& __end) const
+    {
+        ::std::array<__size_type, _Rank> __coords{};
+        if (__morton_)
+        {
+            // The bits of the coordinates are interleaved from the lowest one, the innermost dimension first;
+            // a dimension with fewer tiles runs out of bits earlier
+            for (unsigned __b = 0, __shift = 0; __shift < sizeof(__size_type) * 8 && (__t >> __shift) != 0; ++__b)
+                for (::std::size_t __d = _Rank; __d-- > 0;)
+                    if (__b < __bits_[__d])
+                        __coords[__d] |= ((__t >> __shift++) & 1) << __b;
+        }
+        else
+        {
+            for (::std::size_t __d = _Rank; __d-- > 0;)
+            {
+                __coords[__d] = __t % __tiles_[__d];
+                __t /= __tiles_[__d];
+            }
+        }
+        for (::std::size_t __d = 0; __d < _Rank; ++__d)
+        {
+            if (__coords[__d] >= __tiles_[__d])
+                return false;
+            __begin[__d] = _Index(__coords[__d] * __tile_[__d]);
+            __end[__d] = _Index(::std::min<__size_type>(__begin[__d] + __tile_[__d], __extents_[__d]));
+        }
+        return true;
+    }
+
+    // Row-major ordinal position of an element
+    __size_type
+    __position(const __index_type& __idx) const
+    {
+        __size_type __pos = 0;
+        for (::std::size_t __d = 0; __d < _Rank; ++__d)
+            __pos = __pos * __extents_[__d] + __idx[__d];
+        return __pos;
+    }
+};
+
+// Run the tiles [__first, __last) of an index space, row by row, each row being a vectorizable loop
+template <typename _Index, ::std::size_t _Rank, typename _Pack, typename _Function, typename _IsVector>
+void
+__brick_for_loop_tiles(const __tiled_space<_Index, _Rank>& __space,
+                       typename __tiled_space<_Index, _Rank>::__size_type __first,
+                       typename __tiled_space<_Index, _Rank>::__size_type __last, _Pack& __pack,
+                       const _Pack& __identity, _Function __f, _IsVector __is_vector) noexcept
+{
+    using __size_type = typename __tiled_space<_Index, _Rank>::__size_type;
+    using __index_type = typename __tiled_space<_Index, _Rank>::__index_type;
+
+    for (__size_type __t = __first; __t < __last; ++__t)
+    {
+        __index_type __begin, __end;
+        if (!__space.__tile_bounds(__t, __begin, __end))
+            continue;
+
+        const __size_type __row_size = __end[_Rank - 1] - __begin[_Rank - 1];
+        for (__index_type __idx = __begin;;)
+        {
+            const __size_type __row_position = __space.__position(__idx);
+            oneapi::dpl::__internal::__brick_for_loop_n(
+                __row_position, __row_size, __pack, __identity, __f,
+                [__idx, __row_position](__size_type __pos) {
+                    __index_type __element = __idx;
+                    __element[_Rank - 1] += _Index(__pos - __row_position);
+                    return __element;
+                },
+                __is_vector);
+
+            // Next row of the tile
+            ::std::size_t __d = _Rank - 1;
+            while (__d > 0 && ++__idx[__d - 1] == __end[__d - 1])
+            {
+                __idx[__d - 1] = __begin[__d - 1];
+                --__d;
+            }
+            if (__d == 0)
+                break;
+        }
+    }
+}
+
+// Policy accounting for the __elements elements of an iteration of a parallel loop over blocks,
+// so that the backends do not take a short loop over large blocks for a cheap one
+template <class _ExecutionPolicy>
+decltype(auto)
+__policy_per_block(_ExecutionPolicy&& __exec, ::std::size_t __elements)
+{
+    using _Policy = ::std::decay_t<_ExecutionPolicy>;
+    if constexpr (::std::is_base_of_v<oneapi::dpl::execution::__host_policy_tuning<_Policy>, _Policy>)
+    {
+        const ::std::size_t __cost = oneapi::dpl::__internal::__get_host_policy_params(__exec).__cost_hint;
+        return __exec.with(oneapi::dpl::execution::cost_hint(__cost * __elements));
+    }
+    else
+        return ::std::forward<_ExecutionPolicy>(__exec);
+}
+
+template <typename _ExecutionPolicy, typename _Index, ::std::size_t _Rank, typename _Function, typename _IsVector,
+          typename... _Rest>
+void
+__pattern_for_loop_nd(_ExecutionPolicy&&, const __tiled_space<_Index, _Rank>& __space, _Function __f,
+                      _IsVector __is_vector, /*parallel=*/::std::false_type, _Rest&&... __rest) noexcept
+{
+    __reduction_pack<_Rest...> __pack{__reduction_pack_tag(), ::std::forward<_Rest>(__rest)...};
+    const __reduction_pack<_Rest...> __identity(__pack);
+
+    oneapi::dpl::__internal::__brick_for_loop_tiles(__space, 0, __space.__n_codes(), __pack, __identity, __f,
+                                                    __is_vector);
+
+    __pack.__finalize(__space.__size());
+}
+
+template <typename _ExecutionPolicy, typename _Index, ::std::size_t _Rank, typename _Function, typename _IsVector,
+          typename... _Rest>
+void
+__pattern_for_loop_nd(_ExecutionPolicy&& __exec, const __tiled_space<_Index, _Rank>& __space, _Function __f,
+                      _IsVector __is_vector, /*parallel=*/::std::true_type, _Rest&&... __rest)
+{
+    using __size_type = typename __tiled_space<_Index, _Rank>::__size_type;
+    oneapi::dpl::__internal::__for_loop_parallel(
+        oneapi::dpl::__internal::__policy_per_block(::std::forward<_ExecutionPolicy>(__exec), __space.__tile_size()),
+        __space.__n_codes(), __space.__size(),
+        [&__space, __f, __is_vector](__size_type __i, __size_type __j, auto& __pack, const auto& __identity) {
+            oneapi::dpl::__internal::__brick_for_loop_tiles(__space, __i, __j, __pack, __identity, __f, __is_vector);
+        },
+        __is_vector, ::std::forward<_Rest>(__rest)...);
+}
+
 // Helper structure to split code functions for integral and iterator types so the return
 // value can be successfully deduced.
 template <typename _Ip>
@@ -556,6 +977,30 @@ __for_loop_repack_n(_ExecutionPolicy&& __exec, _Ip __start, _Size __n, _Sp __str
                                                ::std::make_index_sequence<sizeof...(_Rest) - 1>());
 }
 
+template <typename _ExecutionPolicy, typename _Index, ::std::size_t _Rank, typename _Fp, typename... _Rest,
+          ::std::size_t... _Is>
+void
+__for_loop_nd_impl(_ExecutionPolicy&& __exec, const __tiled_space<_Index, _Rank>& __space, _Fp&& __f,
+                   ::std::tuple<_Rest...>&& __t, ::std::index_sequence<_Is...>)
+{
+    oneapi::dpl::__internal::__pattern_for_loop_nd(
+        ::std::forward<_ExecutionPolicy>(__exec), __space, __f,
+        oneapi::dpl::__internal::__use_vectorization<_ExecutionPolicy, _Index>(__exec),
+        oneapi::dpl::__internal::__use_parallelization<_ExecutionPolicy, _Index>(__exec),
+        ::std::get<_Is>(::std::move(__t))...);
+}
+
+template <typename _ExecutionPolicy, typename _Index, ::std::size_t _Rank, typename... _Rest>
+void
+__for_loop_nd_repack(_ExecutionPolicy&& __exec, const __tiled_space<_Index, _Rank>& __space,
+                     ::std::tuple<_Rest...>&& __t)
+{
+    // Extract a callable object from the parameter pack and put it before the other elements
+    oneapi::dpl::__internal::__for_loop_nd_impl(::std::forward<_ExecutionPolicy>(__exec), __space,
+                                                ::std::get<sizeof...(_Rest) - 1>(__t), ::std::move(__t),
+                                                ::std::make_index_sequence<sizeof...(_Rest) - 1>());
+}
+
 } // namespace __internal
 } // namespace dpl
 } // namespace oneapi
@@ -70,6 +70,20 @@ class __reduction_object
         return __acc_;
     }
 
+    // Current accumulated value, used to initialize the lanes of a vectorized loop.
+    const _Tp&
+    __accumulator() const
+    {
+        return __acc_;
+    }
+
+    // Accumulate the value accumulated by a lane of a vectorized loop.
+    void
+    __accumulate(const _Tp& __value)
+    {
+        __acc_ = __combiner_(__acc_, __value);
+    }
+
     // Combine 2 reduction objects together.
     void
     __combine(const __reduction_object& __other)
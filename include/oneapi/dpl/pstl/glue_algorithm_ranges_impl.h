@@ -18,6 +18,7 @@
 
 #include "execution_defs.h"
 #include "glue_algorithm_defs.h"
+#include "algorithm_ranges_impl.h"
 
 #if _ONEDPL_HETERO_BACKEND
 #    include "hetero/algorithm_ranges_impl_hetero.h"
@@ -406,7 +407,7 @@ oneapi::dpl::__internal::__enable_if_execution_policy<_ExecutionPolicy>
 reverse(_ExecutionPolicy&& __exec, _Range&& __rng)
 {
     auto __v = views::all(::std::forward<_Range>(__rng));
-    auto __n = __v.size();
+    const oneapi::dpl::__internal::__difference_t<decltype(__v)> __n = __v.size();
     auto __n_2 = __n / 2;
 
     auto __r1 = __v | views::take(__n_2);
@@ -596,8 +597,10 @@ template <typename _ExecutionPolicy, typename _Range1, typename _Range2>
 oneapi::dpl::__internal::__enable_if_execution_policy<_ExecutionPolicy, bool>
 equal(_ExecutionPolicy&& __exec, _Range1&& __rng1, _Range2&& __rng2)
 {
-    return equal(::std::forward<_ExecutionPolicy>(__exec), ::std::forward<_Range1>(__rng1),
-                 ::std::forward<_Range2>(__rng2), oneapi::dpl::__internal::__pstl_equal());
+    // Qualified, so that the parallel std::equal is not found for the ranges of the standard containers
+    return oneapi::dpl::experimental::ranges::equal(::std::forward<_ExecutionPolicy>(__exec),
+                                                    ::std::forward<_Range1>(__rng1), ::std::forward<_Range2>(__rng2),
+                                                    oneapi::dpl::__internal::__pstl_equal());
 }
 
 // [alg.move]
@@ -18,6 +18,7 @@
 
 #include "execution_defs.h"
 #include "glue_numeric_defs.h"
+#include "numeric_ranges_impl.h"
 
 #if _ONEDPL_HETERO_BACKEND
 #    include "hetero/numeric_ranges_impl_hetero.h"
@@ -0,0 +1,116 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_NUMERIC_RANGES_IMPL_H
+#define _ONEDPL_NUMERIC_RANGES_IMPL_H
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+
+#include "numeric_fwd.h"
+#include "execution_impl.h"
+#include "utils_ranges.h"
+
+namespace oneapi
+{
+namespace dpl
+{
+namespace __internal
+{
+namespace __ranges
+{
+
+//------------------------------------------------------------------------
+// transform_reduce (version with two binary functions)
+//------------------------------------------------------------------------
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Range1, typename _Range2, typename _Tp,
+          typename _BinaryOperation1, typename _BinaryOperation2>
+_Tp
+__pattern_transform_reduce(_Tag __tag, _ExecutionPolicy&& __exec, _Range1&& __rng1, _Range2&& __rng2, _Tp __init,
+                           _BinaryOperation1 __binary_op1, _BinaryOperation2 __binary_op2)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    const oneapi::dpl::__internal::__difference_t<_Range1> __n =
+        ::std::min<oneapi::dpl::__internal::__difference_t<_Range1>>(__rng1.size(), __rng2.size());
+    auto __first1 = ::std::begin(__rng1);
+    return oneapi::dpl::__internal::__pattern_transform_reduce(__tag, ::std::forward<_ExecutionPolicy>(__exec),
+                                                               __first1, __first1 + __n, ::std::begin(__rng2), __init,
+                                                               __binary_op1, __binary_op2);
+}
+
+//------------------------------------------------------------------------
+// transform_reduce (with unary and binary functions)
+//------------------------------------------------------------------------
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Range, typename _Tp, typename _BinaryOperation,
+          typename _UnaryOperation>
+_Tp
+__pattern_transform_reduce(_Tag __tag, _ExecutionPolicy&& __exec, _Range&& __rng, _Tp __init,
+                           _BinaryOperation __binary_op, _UnaryOperation __unary_op)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    auto __first = ::std::begin(__rng);
+    return oneapi::dpl::__internal::__pattern_transform_reduce(__tag, ::std::forward<_ExecutionPolicy>(__exec),
+                                                               __first, __first + __rng.size(), __init, __binary_op,
+                                                               __unary_op);
+}
+
+//------------------------------------------------------------------------
+// transform_scan
+//------------------------------------------------------------------------
+
+template <typename _Tag, typename _ExecutionPolicy, typename _Range1, typename _Range2, typename _UnaryOperation,
+          typename _Type, typename _BinaryOperation, typename _Inclusive>
+oneapi::dpl::__internal::__difference_t<_Range2>
+__pattern_transform_scan(_Tag __tag, _ExecutionPolicy&& __exec, _Range1&& __rng1, _Range2&& __rng2,
+                         _UnaryOperation __unary_op, _Type __init, _BinaryOperation __binary_op, _Inclusive)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    auto __first = ::std::begin(__rng1);
+    auto __result = ::std::begin(__rng2);
+    return oneapi::dpl::__internal::__pattern_transform_scan(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first,
+                                                             __first + __rng1.size(), __result, __unary_op, __init,
+                                                             __binary_op, _Inclusive()) -
+           __result;
+}
+
+// transform_scan without initial element
+template <typename _Tag, typename _ExecutionPolicy, typename _Range1, typename _Range2, typename _UnaryOperation,
+          typename _BinaryOperation, typename _Inclusive>
+oneapi::dpl::__internal::__difference_t<_Range2>
+__pattern_transform_scan(_Tag __tag, _ExecutionPolicy&& __exec, _Range1&& __rng1, _Range2&& __rng2,
+                         _UnaryOperation __unary_op, _BinaryOperation __binary_op, _Inclusive)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    auto __first = ::std::begin(__rng1);
+    auto __result = ::std::begin(__rng2);
+    return oneapi::dpl::__internal::__pattern_transform_scan(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first,
+                                                             __first + __rng1.size(), __result, __unary_op,
+                                                             __binary_op, _Inclusive()) -
+           __result;
+}
+
+} // namespace __ranges
+} // namespace __internal
+} // namespace dpl
+} // namespace oneapi
+
+#endif // _ONEDPL_NUMERIC_RANGES_IMPL_H
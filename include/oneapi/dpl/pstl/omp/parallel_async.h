@@ -0,0 +1,44 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_INTERNAL_OMP_PARALLEL_ASYNC_H
+#define _ONEDPL_INTERNAL_OMP_PARALLEL_ASYNC_H
+
+#include <future>
+#include <type_traits>
+#include <utility>
+
+#include "util.h"
+
+namespace oneapi
+{
+namespace dpl
+{
+namespace __omp_backend
+{
+
+// An OpenMP task cannot outlive the parallel region of the caller, so __f runs on a thread of its own,
+// where the algorithms open their parallel regions as from any other thread
+template <class _ExecutionPolicy, typename _Fp>
+std::future<std::invoke_result_t<_Fp&>>
+__parallel_async(oneapi::dpl::__internal::__omp_backend_tag, _ExecutionPolicy&&, _Fp __f)
+{
+    return std::async(std::launch::async, std::move(__f));
+}
+
+} // namespace __omp_backend
+} // namespace dpl
+} // namespace oneapi
+#endif // _ONEDPL_INTERNAL_OMP_PARALLEL_ASYNC_H
@@ -27,18 +27,64 @@ namespace dpl
 namespace __omp_backend
 {
 
+// A chunk calling __cancel_execution cancels the loop: the chunks not started yet are skipped, and with
+// the OpenMP cancellation enabled (OMP_CANCELLATION=true) the tasks not started yet are discarded
 template <class _Index, class _Fp>
 void
-__parallel_for_body(_Index __first, _Index __last, _Fp __f)
+__parallel_for_body(_Index __first, _Index __last, _Fp __f, std::atomic<bool>& __cancelled,
+                    std::size_t __chunk_size = __default_chunk_size,
+                    oneapi::dpl::execution::partitioner __partitioner = oneapi::dpl::execution::partitioner::auto_)
 {
     // initial partition of the iteration space into chunks
-    auto __policy = oneapi::dpl::__omp_backend::__chunk_partitioner(__first, __last);
+    auto __policy = oneapi::dpl::__omp_backend::__chunk_partitioner(__first, __last, __chunk_size);
 
     // To avoid over-subscription we use taskloop for the nested parallelism
-    _PSTL_PRAGMA(omp taskloop untied mergeable)
+    if (__partitioner == oneapi::dpl::execution::partitioner::simple)
+    {
+        // every chunk becomes a task of its own
+        _PSTL_PRAGMA(omp taskloop untied grainsize(1) shared(__cancelled))
+        for (std::size_t __chunk = 0; __chunk < __policy.__n_chunks; ++__chunk)
+        {
+            if (oneapi::dpl::__omp_backend::__run_cancellable(__cancelled, [&]() {
+                    oneapi::dpl::__omp_backend::__process_chunk(__policy, __first, __chunk, __f);
+                }))
+            {
+                _PSTL_PRAGMA(omp cancel taskgroup)
+            }
+        }
+    }
+    else
+    {
+        _PSTL_PRAGMA(omp taskloop untied mergeable shared(__cancelled))
+        for (std::size_t __chunk = 0; __chunk < __policy.__n_chunks; ++__chunk)
+        {
+            if (oneapi::dpl::__omp_backend::__run_cancellable(__cancelled, [&]() {
+                    oneapi::dpl::__omp_backend::__process_chunk(__policy, __first, __chunk, __f);
+                }))
+            {
+                _PSTL_PRAGMA(omp cancel taskgroup)
+            }
+        }
+    }
+}
+
+// Static schedule of the chunks over the threads of the enclosing parallel region
+template <class _Index, class _Fp>
+void
+__parallel_for_static_body(_Index __first, _Index __last, _Fp __f, std::atomic<bool>& __cancelled,
+                           std::size_t __chunk_size)
+{
+    auto __policy = oneapi::dpl::__omp_backend::__chunk_partitioner(__first, __last, __chunk_size);
+
+    _PSTL_PRAGMA(omp for schedule(static))
     for (std::size_t __chunk = 0; __chunk < __policy.__n_chunks; ++__chunk)
     {
-        oneapi::dpl::__omp_backend::__process_chunk(__policy, __first, __chunk, __f);
+        if (oneapi::dpl::__omp_backend::__run_cancellable(__cancelled, [&]() {
+                oneapi::dpl::__omp_backend::__process_chunk(__policy, __first, __chunk, __f);
+            }))
+        {
+            _PSTL_PRAGMA(omp cancel for)
+        }
     }
 }
 
@@ -49,20 +95,43 @@ __parallel_for_body(_Index __first, _Index __last, _Fp __f)
 
 template <class _ExecutionPolicy, class _Index, class _Fp>
 void
-__parallel_for(oneapi::dpl::__internal::__omp_backend_tag, _ExecutionPolicy&&, _Index __first, _Index __last, _Fp __f)
+__parallel_for(oneapi::dpl::__internal::__omp_backend_tag, _ExecutionPolicy&& __exec, _Index __first, _Index __last,
+               _Fp __f)
 {
+    std::atomic<bool> __cancelled{false};
+    if (oneapi::dpl::__utils::__run_serial<oneapi::dpl::__utils::__loop_kind::__for>(
+            __exec, __last - __first, oneapi::dpl::__utils::__element_size<_Index>()))
+    {
+        // the loop is cancellable on its own, not as a part of the chunk of an enclosing loop run by the caller
+        oneapi::dpl::__omp_backend::__run_cancellable(__cancelled, [&]() { __f(__first, __last); });
+        return;
+    }
+
+    const std::size_t __chunk_size = oneapi::dpl::__omp_backend::__chunk_size(__exec);
+    const auto __partitioner = oneapi::dpl::__internal::__get_host_policy_params(__exec).__partitioner;
     if (omp_in_parallel())
     {
         // we don't create a nested parallel region in an existing parallel
         // region: just create tasks
-        oneapi::dpl::__omp_backend::__parallel_for_body(__first, __last, __f);
+        oneapi::dpl::__omp_backend::__parallel_for_body(__first, __last, __f, __cancelled, __chunk_size,
+                                                        __partitioner);
+    }
+    else if (__partitioner == oneapi::dpl::execution::partitioner::static_)
+    {
+        // the chunks are evenly distributed among the threads of a new parallel region
+        _PSTL_PRAGMA(omp parallel num_threads(__num_threads(__exec)) shared(__cancelled))
+        oneapi::dpl::__omp_backend::__parallel_for_static_body(__first, __last, __f, __cancelled, __chunk_size);
     }
     else
     {
         // in any case (nested or non-nested) one parallel region is created and
         // only one thread creates a set of tasks
-        _PSTL_PRAGMA(omp parallel)
-        _PSTL_PRAGMA(omp single nowait) { oneapi::dpl::__omp_backend::__parallel_for_body(__first, __last, __f); }
+        _PSTL_PRAGMA(omp parallel num_threads(__num_threads(__exec)) shared(__cancelled))
+        _PSTL_PRAGMA(omp single nowait)
+        {
+            oneapi::dpl::__omp_backend::__parallel_for_body(__first, __last, __f, __cancelled, __chunk_size,
+                                                            __partitioner);
+        }
     }
 }
 
@@ -44,7 +44,7 @@ __parallel_for_each_body(_ForwardIterator __first, _ForwardIterator __last, _Fp
 
 template <class _ExecutionPolicy, class _ForwardIterator, class _Fp>
 void
-__parallel_for_each(oneapi::dpl::__internal::__omp_backend_tag, _ExecutionPolicy&&, _ForwardIterator __first,
+__parallel_for_each(oneapi::dpl::__internal::__omp_backend_tag, _ExecutionPolicy&& __exec, _ForwardIterator __first,
                     _ForwardIterator __last, _Fp __f)
 {
     if (omp_in_parallel())
@@ -57,7 +57,7 @@ __parallel_for_each(oneapi::dpl::__internal::__omp_backend_tag, _ExecutionPolicy
     {
         // in any case (nested or non-nested) one parallel region is created and
         // only one thread creates a set of tasks
-        _PSTL_PRAGMA(omp parallel)
+        _PSTL_PRAGMA(omp parallel num_threads(__num_threads(__exec)))
         _PSTL_PRAGMA(omp single nowait) { oneapi::dpl::__omp_backend::__parallel_for_each_body(__first, __last, __f); }
     }
 }
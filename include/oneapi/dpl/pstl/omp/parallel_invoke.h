@@ -38,7 +38,7 @@ __parallel_invoke_body(_F1&& __f1, _F2&& __f2)
 
 template <class _ExecutionPolicy, typename _F1, typename _F2>
 void
-__parallel_invoke(oneapi::dpl::__internal::__omp_backend_tag, _ExecutionPolicy&&, _F1&& __f1, _F2&& __f2)
+__parallel_invoke(oneapi::dpl::__internal::__omp_backend_tag, _ExecutionPolicy&& __exec, _F1&& __f1, _F2&& __f2)
 {
     if (omp_in_parallel())
     {
@@ -46,7 +46,7 @@ __parallel_invoke(oneapi::dpl::__internal::__omp_backend_tag, _ExecutionPolicy&&
     }
     else
     {
-        _PSTL_PRAGMA(omp parallel)
+        _PSTL_PRAGMA(omp parallel num_threads(__num_threads(__exec)))
         _PSTL_PRAGMA(omp single nowait)
         oneapi::dpl::__omp_backend::__parallel_invoke_body(std::forward<_F1>(__f1), std::forward<_F2>(__f2));
     }
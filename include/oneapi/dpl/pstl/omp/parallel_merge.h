@@ -30,10 +30,11 @@ template <typename _RandomAccessIterator1, typename _RandomAccessIterator2, type
 void
 __parallel_merge_body(std::size_t __size_x, std::size_t __size_y, _RandomAccessIterator1 __xs,
                       _RandomAccessIterator1 __xe, _RandomAccessIterator2 __ys, _RandomAccessIterator2 __ye,
-                      _RandomAccessIterator3 __zs, _Compare __comp, _LeafMerge __leaf_merge)
+                      _RandomAccessIterator3 __zs, _Compare __comp, _LeafMerge __leaf_merge,
+                      std::size_t __chunk_size = __default_chunk_size)
 {
 
-    if (__size_x + __size_y <= oneapi::dpl::__omp_backend::__default_chunk_size)
+    if (__size_x + __size_y <= __chunk_size)
     {
         __leaf_merge(__xs, __xe, __ys, __ye, __zs, __comp);
         return;
@@ -56,14 +57,14 @@ __parallel_merge_body(std::size_t __size_x, std::size_t __size_y, _RandomAccessI
     auto __zm = __zs + (__xm - __xs) + (__ym - __ys);
 
     _PSTL_PRAGMA(omp task untied mergeable default(none)
-                     firstprivate(__xs, __xm, __ys, __ym, __zs, __comp, __leaf_merge))
+                     firstprivate(__xs, __xm, __ys, __ym, __zs, __comp, __leaf_merge, __chunk_size))
     oneapi::dpl::__omp_backend::__parallel_merge_body(__xm - __xs, __ym - __ys, __xs, __xm, __ys, __ym, __zs, __comp,
-                                                      __leaf_merge);
+                                                      __leaf_merge, __chunk_size);
 
     _PSTL_PRAGMA(omp task untied mergeable default(none)
-                     firstprivate(__xm, __xe, __ym, __ye, __zm, __comp, __leaf_merge))
+                     firstprivate(__xm, __xe, __ym, __ye, __zm, __comp, __leaf_merge, __chunk_size))
     oneapi::dpl::__omp_backend::__parallel_merge_body(__xe - __xm, __ye - __ym, __xm, __xe, __ym, __ye, __zm, __comp,
-                                                      __leaf_merge);
+                                                      __leaf_merge, __chunk_size);
 
     _PSTL_PRAGMA(omp taskwait)
 }
@@ -71,12 +72,13 @@ __parallel_merge_body(std::size_t __size_x, std::size_t __size_y, _RandomAccessI
 template <class _ExecutionPolicy, typename _RandomAccessIterator1, typename _RandomAccessIterator2,
           typename _RandomAccessIterator3, typename _Compare, typename _LeafMerge>
 void
-__parallel_merge(oneapi::dpl::__internal::__omp_backend_tag, _ExecutionPolicy&& /*__exec*/, _RandomAccessIterator1 __xs,
+__parallel_merge(oneapi::dpl::__internal::__omp_backend_tag, _ExecutionPolicy&& __exec, _RandomAccessIterator1 __xs,
                  _RandomAccessIterator1 __xe, _RandomAccessIterator2 __ys, _RandomAccessIterator2 __ye,
                  _RandomAccessIterator3 __zs, _Compare __comp, _LeafMerge __leaf_merge)
 {
     std::size_t __size_x = __xe - __xs;
     std::size_t __size_y = __ye - __ys;
+    const std::size_t __chunk_size = oneapi::dpl::__omp_backend::__leaf_size(__exec);
 
     /*
      * Run the merge in parallel by chunking it up. Use the smaller range (if any) as the iteration range, and the
@@ -86,15 +88,15 @@ __parallel_merge(oneapi::dpl::__internal::__omp_backend_tag, _ExecutionPolicy&&
     if (omp_in_parallel())
     {
         oneapi::dpl::__omp_backend::__parallel_merge_body(__size_x, __size_y, __xs, __xe, __ys, __ye, __zs, __comp,
-                                                          __leaf_merge);
+                                                          __leaf_merge, __chunk_size);
     }
     else
     {
-        _PSTL_PRAGMA(omp parallel)
+        _PSTL_PRAGMA(omp parallel num_threads(__num_threads(__exec)))
         {
             _PSTL_PRAGMA(omp single nowait)
             oneapi::dpl::__omp_backend::__parallel_merge_body(__size_x, __size_y, __xs, __xe, __ys, __ye, __zs, __comp,
-                                                              __leaf_merge);
+                                                              __leaf_merge, __chunk_size);
         }
     }
 }
@@ -28,9 +28,9 @@ namespace __omp_backend
 template <class _RandomAccessIterator, class _Value, typename _RealBody, typename _Reduction>
 _Value
 __parallel_reduce_body(_RandomAccessIterator __first, _RandomAccessIterator __last, _Value __identity,
-                       _RealBody __real_body, _Reduction __reduce)
+                       _RealBody __real_body, _Reduction __reduce, std::size_t __chunk_size = __default_chunk_size)
 {
-    if (__should_run_serial(__first, __last))
+    if (__should_run_serial(__first, __last, __chunk_size))
     {
         return __real_body(__first, __last, __identity);
     }
@@ -38,8 +38,8 @@ __parallel_reduce_body(_RandomAccessIterator __first, _RandomAccessIterator __la
     auto __middle = __first + ((__last - __first) / 2);
     _Value __v1(__identity), __v2(__identity);
     __parallel_invoke_body(
-        [&]() { __v1 = __parallel_reduce_body(__first, __middle, __identity, __real_body, __reduce); },
-        [&]() { __v2 = __parallel_reduce_body(__middle, __last, __identity, __real_body, __reduce); });
+        [&]() { __v1 = __parallel_reduce_body(__first, __middle, __identity, __real_body, __reduce, __chunk_size); },
+        [&]() { __v2 = __parallel_reduce_body(__middle, __last, __identity, __real_body, __reduce, __chunk_size); });
 
     return __reduce(__v1, __v2);
 }
@@ -52,26 +52,32 @@ __parallel_reduce_body(_RandomAccessIterator __first, _RandomAccessIterator __la
 
 template <class _ExecutionPolicy, class _RandomAccessIterator, class _Value, typename _RealBody, typename _Reduction>
 _Value
-__parallel_reduce(oneapi::dpl::__internal::__omp_backend_tag, _ExecutionPolicy&&, _RandomAccessIterator __first,
+__parallel_reduce(oneapi::dpl::__internal::__omp_backend_tag, _ExecutionPolicy&& __exec, _RandomAccessIterator __first,
                   _RandomAccessIterator __last, _Value __identity, _RealBody __real_body, _Reduction __reduction)
 {
+    if (oneapi::dpl::__utils::__run_serial<oneapi::dpl::__utils::__loop_kind::__reduce>(
+            __exec, __last - __first, oneapi::dpl::__utils::__element_size<_RandomAccessIterator>()))
+        return __first == __last ? __identity : __real_body(__first, __last, __identity);
+
+    const std::size_t __chunk_size = oneapi::dpl::__omp_backend::__chunk_size(__exec);
+
     // We don't create a nested parallel region in an existing parallel region:
     // just create tasks.
     if (omp_in_parallel())
     {
         return oneapi::dpl::__omp_backend::__parallel_reduce_body(__first, __last, __identity, __real_body,
-                                                                  __reduction);
+                                                                  __reduction, __chunk_size);
     }
 
     // In any case (nested or non-nested) one parallel region is created and only
     // one thread creates a set of tasks.
     _Value __res = __identity;
 
-    _PSTL_PRAGMA(omp parallel)
+    _PSTL_PRAGMA(omp parallel num_threads(__num_threads(__exec)))
     _PSTL_PRAGMA(omp single nowait)
     {
-        __res =
-            oneapi::dpl::__omp_backend::__parallel_reduce_body(__first, __last, __identity, __real_body, __reduction);
+        __res = oneapi::dpl::__omp_backend::__parallel_reduce_body(__first, __last, __identity, __real_body,
+                                                                   __reduction, __chunk_size);
     }
 
     return __res;
@@ -85,9 +85,11 @@ void
 __parallel_strict_scan_body(_ExecutionPolicy&& __exec, _Index __n, _Tp __initial, _Rp __reduce, _Cp __combine,
                             _Sp __scan, _Ap __apex)
 {
+    const auto __params = oneapi::dpl::__internal::__get_host_policy_params(__exec);
     _Index __p = omp_get_num_threads();
-    const _Index __slack = 4;
-    _Index __tilesize = (__n - 1) / (__slack * __p) + 1;
+    // The static partitioner asks for one tile per thread; otherwise tiles are oversubscribed for balancing
+    const _Index __slack = __params.__partitioner == oneapi::dpl::execution::partitioner::static_ ? 1 : 4;
+    _Index __tilesize = std::max<_Index>((__n - 1) / (__slack * __p) + 1, __params.__grainsize);
     _Index __m = (__n - 1) / __tilesize;
     __buffer<_ExecutionPolicy, _Tp> __buf(::std::forward<_ExecutionPolicy>(__exec), __m + 1);
     _Tp* __r = __buf.get();
@@ -112,7 +114,8 @@ void
 __parallel_strict_scan(oneapi::dpl::__internal::__omp_backend_tag, _ExecutionPolicy&& __exec, _Index __n, _Tp __initial,
                        _Rp __reduce, _Cp __combine, _Sp __scan, _Ap __apex)
 {
-    if (__n <= __default_chunk_size)
+    if (__n <= static_cast<_Index>(oneapi::dpl::__omp_backend::__chunk_size(__exec)) ||
+        oneapi::dpl::__utils::__run_serial<oneapi::dpl::__utils::__loop_kind::__scan>(__exec, __n, sizeof(_Tp)))
     {
         _Tp __sum = __initial;
         if (__n)
@@ -134,7 +137,7 @@ __parallel_strict_scan(oneapi::dpl::__internal::__omp_backend_tag, _ExecutionPol
     }
     else
     {
-        _PSTL_PRAGMA(omp parallel)
+        _PSTL_PRAGMA(omp parallel num_threads(__num_threads(__exec)))
         _PSTL_PRAGMA(omp single nowait)
         {
             oneapi::dpl::__omp_backend::__parallel_strict_scan_body(::std::forward<_ExecutionPolicy>(__exec), __n,
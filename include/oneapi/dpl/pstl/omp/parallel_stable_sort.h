@@ -16,6 +16,9 @@
 #ifndef _ONEDPL_INTERNAL_OMP_PARALLEL_STABLE_SORT_H
 #define _ONEDPL_INTERNAL_OMP_PARALLEL_STABLE_SORT_H
 
+#include <memory>
+#include <new>
+
 #include "util.h"
 #include "parallel_merge.h"
 
@@ -28,69 +31,67 @@ namespace __omp_backend
 
 namespace __sort_details
 {
-struct __move_value
+struct __construct_value
 {
-    template <typename _Iterator, typename _OutputIterator>
+    template <typename _Iterator, typename _ValueType>
     void
-    operator()(_Iterator __x, _OutputIterator __z) const
+    operator()(_Iterator __x, _ValueType* __z) const
+    {
+        ::new (static_cast<void*>(__z)) _ValueType(std::move(*__x));
+    }
+};
+
+struct __construct_range
+{
+    template <typename _Iterator, typename _ValueType>
+    _ValueType*
+    operator()(_Iterator __first1, _Iterator __last1, _ValueType* __d_first) const
     {
-        *__z = std::move(*__x);
+        return std::uninitialized_move(__first1, __last1, __d_first);
     }
 };
 
-template <typename _RandomAccessIterator, typename _OutputIterator>
-_OutputIterator
-__parallel_move_range(_RandomAccessIterator __first1, _RandomAccessIterator __last1, _OutputIterator __d_first)
+// Moves the merged values from the raw buffer back into the sequence, destroying them in the buffer
+template <typename _ValueType, typename _RandomAccessIterator>
+void
+__parallel_move_back(_ValueType* __first1, _ValueType* __last1, _RandomAccessIterator __d_first,
+                     std::size_t __chunk_size = __default_chunk_size)
 {
-    std::size_t __size = __last1 - __first1;
+    auto __move_back = [__first1, __d_first](_ValueType* __chunk_first, _ValueType* __chunk_last) {
+        std::move(__chunk_first, __chunk_last, __d_first + (__chunk_first - __first1));
+        std::destroy(__chunk_first, __chunk_last);
+    };
 
     // Perform serial moving of small chunks
 
-    if (__size <= __default_chunk_size)
+    if (static_cast<std::size_t>(__last1 - __first1) <= __chunk_size)
     {
-        return std::move(__first1, __last1, __d_first);
+        __move_back(__first1, __last1);
+        return;
     }
 
     // Perform parallel moving of larger chunks
-    auto __policy = oneapi::dpl::__omp_backend::__chunk_partitioner(__first1, __last1);
+    auto __policy = oneapi::dpl::__omp_backend::__chunk_partitioner(__first1, __last1, __chunk_size);
 
     _PSTL_PRAGMA(omp taskloop)
     for (std::size_t __chunk = 0; __chunk < __policy.__n_chunks; ++__chunk)
     {
-        oneapi::dpl::__omp_backend::__process_chunk(__policy, __first1, __chunk,
-                                                    [&](auto __chunk_first, auto __chunk_last) {
-                                                        auto __chunk_offset = __chunk_first - __first1;
-                                                        auto __output_it = __d_first + __chunk_offset;
-                                                        std::move(__chunk_first, __chunk_last, __output_it);
-                                                    });
+        oneapi::dpl::__omp_backend::__process_chunk(__policy, __first1, __chunk, __move_back);
     }
-
-    return __d_first + __size;
 }
-
-struct __move_range
-{
-    template <typename _RandomAccessIterator, typename _OutputIterator>
-    _OutputIterator
-    operator()(_RandomAccessIterator __first1, _RandomAccessIterator __last1, _OutputIterator __d_first) const
-    {
-        return oneapi::dpl::__omp_backend::__sort_details::__parallel_move_range(__first1, __last1, __d_first);
-    }
-};
 } // namespace __sort_details
 
-template <typename _RandomAccessIterator, typename _Compare, typename _LeafSort>
+// Sorts the halves of [__xs, __xe), merges them into the raw buffer __zs constructing the elements there, then
+// moves them back, so that the leaves are always sorted in place.
+template <typename _RandomAccessIterator, typename _ValueType, typename _Compare, typename _LeafSort>
 void
-__parallel_stable_sort_body(_RandomAccessIterator __xs, _RandomAccessIterator __xe, _Compare __comp,
-                            _LeafSort __leaf_sort)
+__parallel_stable_sort_body(_RandomAccessIterator __xs, _RandomAccessIterator __xe, _ValueType* __zs, _Compare __comp,
+                            _LeafSort __leaf_sort, std::size_t __chunk_size = __default_chunk_size)
 {
-    using _ValueType = typename std::iterator_traits<_RandomAccessIterator>::value_type;
-    using _VecType = typename std::vector<_ValueType>;
-    using _OutputIterator = typename _VecType::iterator;
-    using _MoveValue = oneapi::dpl::__omp_backend::__sort_details::__move_value;
-    using _MoveRange = oneapi::dpl::__omp_backend::__sort_details::__move_range;
+    using _ConstructValue = oneapi::dpl::__omp_backend::__sort_details::__construct_value;
+    using _ConstructRange = oneapi::dpl::__omp_backend::__sort_details::__construct_range;
 
-    if (__should_run_serial(__xs, __xe))
+    if (__should_run_serial(__xs, __xe, __chunk_size))
     {
         __leaf_sort(__xs, __xe, __comp);
     }
@@ -99,36 +100,36 @@ __parallel_stable_sort_body(_RandomAccessIterator __xs, _RandomAccessIterator __
         std::size_t __size = __xe - __xs;
         auto __mid = __xs + (__size / 2);
         oneapi::dpl::__omp_backend::__parallel_invoke_body(
-            [&]() { __parallel_stable_sort_body(__xs, __mid, __comp, __leaf_sort); },
-            [&]() { __parallel_stable_sort_body(__mid, __xe, __comp, __leaf_sort); });
+            [&]() { __parallel_stable_sort_body(__xs, __mid, __zs, __comp, __leaf_sort, __chunk_size); },
+            [&]() {
+                __parallel_stable_sort_body(__mid, __xe, __zs + (__mid - __xs), __comp, __leaf_sort, __chunk_size);
+            });
 
-        // Perform a parallel merge of the sorted ranges into __output_data.
-        _VecType __output_data(__size);
-        _MoveValue __move_value;
-        _MoveRange __move_range;
+        // Perform a parallel merge of the sorted ranges into the buffer.
         __utils::__serial_move_merge __merge(__size);
         oneapi::dpl::__omp_backend::__parallel_merge_body(
-            __mid - __xs, __xe - __mid, __xs, __mid, __mid, __xe, __output_data.begin(), __comp,
-            [&__merge, &__move_value, &__move_range](_RandomAccessIterator __as, _RandomAccessIterator __ae,
-                                                     _RandomAccessIterator __bs, _RandomAccessIterator __be,
-                                                     _OutputIterator __cs, _Compare __comp) {
-                __merge(__as, __ae, __bs, __be, __cs, __comp, __move_value, __move_value, __move_range, __move_range);
-            });
-
-        // Move the values from __output_data back in the original source range.
-        oneapi::dpl::__omp_backend::__sort_details::__parallel_move_range(__output_data.begin(), __output_data.end(),
-                                                                          __xs);
+            __mid - __xs, __xe - __mid, __xs, __mid, __mid, __xe, __zs, __comp,
+            [&__merge](_RandomAccessIterator __as, _RandomAccessIterator __ae, _RandomAccessIterator __bs,
+                       _RandomAccessIterator __be, _ValueType* __cs, _Compare __comp) {
+                __merge(__as, __ae, __bs, __be, __cs, __comp, _ConstructValue{}, _ConstructValue{}, _ConstructRange{},
+                        _ConstructRange{});
+            },
+            __chunk_size);
+
+        // Move the values from the buffer back in the original source range.
+        oneapi::dpl::__omp_backend::__sort_details::__parallel_move_back(__zs, __zs + __size, __xs, __chunk_size);
     }
 }
 
 template <class _ExecutionPolicy, typename _RandomAccessIterator, typename _Compare, typename _LeafSort>
 void
-__parallel_stable_sort(oneapi::dpl::__internal::__omp_backend_tag, _ExecutionPolicy&& /*__exec*/,
+__parallel_stable_sort(oneapi::dpl::__internal::__omp_backend_tag, _ExecutionPolicy&& __exec,
                        _RandomAccessIterator __xs, _RandomAccessIterator __xe, _Compare __comp, _LeafSort __leaf_sort,
                        std::size_t __nsort = 0)
 {
+    const std::size_t __chunk_size = oneapi::dpl::__omp_backend::__leaf_size(__exec);
     auto __count = static_cast<std::size_t>(__xe - __xs);
-    if (__count <= __default_chunk_size || __nsort < __count)
+    if (__count <= __chunk_size || __nsort < __count)
     {
         __leaf_sort(__xs, __xe, __comp);
         return;
@@ -137,11 +138,19 @@ __parallel_stable_sort(oneapi::dpl::__internal::__omp_backend_tag, _ExecutionPol
     // TODO: the partial sort implementation should
     // be shared with the other backends.
 
+    using _ValueType = typename std::iterator_traits<_RandomAccessIterator>::value_type;
+    // The merges go through the raw buffer of the whole sequence, which is taken from the scratch memory resource
+    // of the policy if any
+    __buffer<_ExecutionPolicy, _ValueType> __buf(__exec, __count);
+    if (!__buf)
+        throw std::bad_alloc();
+
     if (omp_in_parallel())
     {
         if (__count <= __nsort)
         {
-            oneapi::dpl::__omp_backend::__parallel_stable_sort_body(__xs, __xe, __comp, __leaf_sort);
+            oneapi::dpl::__omp_backend::__parallel_stable_sort_body(__xs, __xe, __buf.get(), __comp, __leaf_sort,
+                                                                    __chunk_size);
         }
         else
         {
@@ -150,11 +159,12 @@ __parallel_stable_sort(oneapi::dpl::__internal::__omp_backend_tag, _ExecutionPol
     }
     else
     {
-        _PSTL_PRAGMA(omp parallel)
+        _PSTL_PRAGMA(omp parallel num_threads(__num_threads(__exec)))
         _PSTL_PRAGMA(omp single nowait)
         if (__count <= __nsort)
         {
-            oneapi::dpl::__omp_backend::__parallel_stable_sort_body(__xs, __xe, __comp, __leaf_sort);
+            oneapi::dpl::__omp_backend::__parallel_stable_sort_body(__xs, __xe, __buf.get(), __comp, __leaf_sort,
+                                                                    __chunk_size);
         }
         else
         {
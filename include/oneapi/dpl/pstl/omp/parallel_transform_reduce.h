@@ -37,14 +37,14 @@ namespace __omp_backend
 template <class _RandomAccessIterator, class _UnaryOp, class _Value, class _Combiner, class _Reduction>
 _Value
 __transform_reduce_body(_RandomAccessIterator __first, _RandomAccessIterator __last, _UnaryOp __unary_op, _Value __init,
-                        _Combiner __combiner, _Reduction __reduction)
+                        _Combiner __combiner, _Reduction __reduction, std::size_t __chunk_size = __default_chunk_size)
 {
     const std::size_t __num_threads = omp_get_num_threads();
     const std::size_t __size = __last - __first;
 
     // Initial partition of the iteration space into chunks. If the range is too small,
     // this will result in a nonsense policy, so we check on the size as well below.
-    auto __policy = oneapi::dpl::__omp_backend::__chunk_partitioner(__first + __num_threads, __last);
+    auto __policy = oneapi::dpl::__omp_backend::__chunk_partitioner(__first + __num_threads, __last, __chunk_size);
 
     if (__size <= __num_threads || __policy.__n_chunks < 2)
     {
@@ -86,27 +86,32 @@ __transform_reduce_body(_RandomAccessIterator __first, _RandomAccessIterator __l
 template <class _ExecutionPolicy, class _RandomAccessIterator, class _UnaryOp, class _Value, class _Combiner,
           class _Reduction>
 _Value
-__parallel_transform_reduce(oneapi::dpl::__internal::__omp_backend_tag, _ExecutionPolicy&&,
+__parallel_transform_reduce(oneapi::dpl::__internal::__omp_backend_tag, _ExecutionPolicy&& __exec,
                             _RandomAccessIterator __first, _RandomAccessIterator __last, _UnaryOp __unary_op,
                             _Value __init, _Combiner __combiner, _Reduction __reduction)
 {
+    if (oneapi::dpl::__utils::__run_serial<oneapi::dpl::__utils::__loop_kind::__reduce>(
+            __exec, __last - __first, oneapi::dpl::__utils::__element_size<_RandomAccessIterator>()))
+        return __reduction(__first, __last, __init);
+
+    const std::size_t __chunk_size = oneapi::dpl::__omp_backend::__chunk_size(__exec);
     _Value __result = __init;
     if (omp_in_parallel())
     {
         // We don't create a nested parallel region in an existing parallel
         // region: just create tasks
         __result = oneapi::dpl::__omp_backend::__transform_reduce_body(__first, __last, __unary_op, __init, __combiner,
-                                                                       __reduction);
+                                                                       __reduction, __chunk_size);
     }
     else
     {
         // Create a parallel region, and a single thread will create tasks
         // for the region.
-        _PSTL_PRAGMA(omp parallel)
+        _PSTL_PRAGMA(omp parallel num_threads(__num_threads(__exec)))
         _PSTL_PRAGMA(omp single nowait)
         {
             __result = oneapi::dpl::__omp_backend::__transform_reduce_body(__first, __last, __unary_op, __init,
-                                                                           __combiner, __reduction);
+                                                                           __combiner, __reduction, __chunk_size);
         }
     }
 
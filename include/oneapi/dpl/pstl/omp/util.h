@@ -47,39 +47,147 @@ namespace __omp_backend
 //------------------------------------------------------------------------
 // use to cancel execution
 //------------------------------------------------------------------------
+
+// Cancellation flag of the loop whose chunk the calling thread executes, null outside of the loops
+inline std::atomic<bool>*&
+__current_cancellation_flag()
+{
+    static thread_local std::atomic<bool>* __flag = nullptr;
+    return __flag;
+}
+
+// Cancels the innermost loop executing the caller: its chunks not started yet are skipped
 inline void
 __cancel_execution(oneapi::dpl::__internal::__omp_backend_tag)
 {
-    // TODO: Figure out how to make cancellation work.
+    if (std::atomic<bool>* __flag = oneapi::dpl::__omp_backend::__current_cancellation_flag())
+        __flag->store(true, std::memory_order_relaxed);
+}
+
+// Makes __cancel_execution target the flag of a loop for its lifetime, restoring the flag of the enclosing loop on
+// exit, an exception included
+class __cancellation_scope
+{
+    std::atomic<bool>* _M_outer;
+
+  public:
+    explicit __cancellation_scope(std::atomic<bool>& __cancelled)
+        : _M_outer(oneapi::dpl::__omp_backend::__current_cancellation_flag())
+    {
+        oneapi::dpl::__omp_backend::__current_cancellation_flag() = &__cancelled;
+    }
+
+    __cancellation_scope(const __cancellation_scope&) = delete;
+    __cancellation_scope&
+    operator=(const __cancellation_scope&) = delete;
+
+    ~__cancellation_scope() { oneapi::dpl::__omp_backend::__current_cancellation_flag() = _M_outer; }
+};
+
+// Runs a chunk of a loop unless the loop has been cancelled, making __cancel_execution target the loop.
+// Returns whether the loop is cancelled.
+template <typename _Fp>
+bool
+__run_cancellable(std::atomic<bool>& __cancelled, _Fp __f)
+{
+    if (__cancelled.load(std::memory_order_relaxed))
+        return true;
+
+    oneapi::dpl::__omp_backend::__cancellation_scope __scope(__cancelled);
+    __f();
+    return __cancelled.load(std::memory_order_relaxed);
 }
 
 //------------------------------------------------------------------------
 // raw buffer
 //------------------------------------------------------------------------
 
+// Touches the pages of a large buffer from the threads processing the matching chunks under the static schedule
+struct __first_touch_placement
+{
+    template <typename _ExecutionPolicy>
+    void
+    operator()(const _ExecutionPolicy& __exec, void* __ptr, std::size_t __size) const;
+};
+
 template <typename _ExecutionPolicy, typename _Tp>
-using __buffer = oneapi::dpl::__utils::__buffer_impl<std::decay_t<_ExecutionPolicy>, _Tp, std::allocator>;
+using __buffer = oneapi::dpl::__utils::__buffer_impl<std::decay_t<_ExecutionPolicy>, _Tp, std::allocator,
+                                                     oneapi::dpl::__omp_backend::__first_touch_placement>;
 
 // Preliminary size of each chunk: requires further discussion
 constexpr std::size_t __default_chunk_size = 2048;
 
+// Chunk size requested through the policy tuning parameters, or the default one
+template <typename _ExecutionPolicy>
+constexpr std::size_t
+__chunk_size(const _ExecutionPolicy& __exec)
+{
+    const std::size_t __grainsize = oneapi::dpl::__internal::__get_host_policy_params(__exec).__grainsize;
+    return __grainsize ? __grainsize : __default_chunk_size;
+}
+
+// Size of the thread team requested through the policy tuning parameters, or the OpenMP default
+template <typename _ExecutionPolicy>
+int
+__num_threads(const _ExecutionPolicy& __exec)
+{
+    const std::size_t __n = oneapi::dpl::__internal::__get_host_policy_params(__exec).__num_threads;
+    return __n ? static_cast<int>(__n) : omp_get_max_threads();
+}
+
+// Number of the threads that can take part in an algorithm run with the policy; nested calls run in the team of
+// the enclosing parallel region
+template <typename _ExecutionPolicy>
+std::size_t
+__max_concurrency(oneapi::dpl::__internal::__omp_backend_tag, const _ExecutionPolicy& __exec)
+{
+    return omp_in_parallel() ? omp_get_num_threads() : oneapi::dpl::__omp_backend::__num_threads(__exec);
+}
+
+template <typename _ExecutionPolicy>
+void
+__first_touch_placement::operator()(const _ExecutionPolicy& __exec, void* __ptr, std::size_t __size) const
+{
+    // Inside of an existing parallel region the mapping of the chunks to the threads is not known
+    if (oneapi::dpl::__internal::__get_host_policy_params(__exec).__numa_placement !=
+            oneapi::dpl::execution::numa_placement::first_touch ||
+        __size < oneapi::dpl::__utils::__first_touch_min_size || omp_in_parallel())
+        return;
+
+    constexpr std::size_t __page_size = oneapi::dpl::__utils::__first_touch_page_size;
+    char* __bytes = static_cast<char*>(__ptr);
+    const std::size_t __n_pages = (__size - 1) / __page_size + 1;
+
+    _PSTL_PRAGMA(omp parallel for schedule(static) num_threads(__num_threads(__exec)))
+    for (std::size_t __i = 0; __i < __n_pages; ++__i)
+        __bytes[__i * __page_size] = 0;
+}
+
+// Leaf size of the recursive sort and merge, which may only be raised through the policy tuning parameters
+template <typename _ExecutionPolicy>
+constexpr std::size_t
+__leaf_size(const _ExecutionPolicy& __exec)
+{
+    return std::max(oneapi::dpl::__omp_backend::__chunk_size(__exec), __default_chunk_size);
+}
+
 // Convenience function to determine when we should run serial.
 template <typename _Iterator, std::enable_if_t<!std::is_integral_v<_Iterator>, bool> = true>
 constexpr auto
-__should_run_serial(_Iterator __first, _Iterator __last) -> bool
+__should_run_serial(_Iterator __first, _Iterator __last, std::size_t __chunk_size = __default_chunk_size) -> bool
 {
     using _difference_type = typename std::iterator_traits<_Iterator>::difference_type;
     auto __size = std::distance(__first, __last);
-    return __size <= static_cast<_difference_type>(__default_chunk_size);
+    return __size <= static_cast<_difference_type>(__chunk_size);
 }
 
 template <typename _Index, std::enable_if_t<std::is_integral_v<_Index>, bool> = true>
 constexpr auto
-__should_run_serial(_Index __first, _Index __last) -> bool
+__should_run_serial(_Index __first, _Index __last, std::size_t __chunk_size = __default_chunk_size) -> bool
 {
     using _difference_type = _Index;
     auto __size = __last - __first;
-    return __size <= static_cast<_difference_type>(__default_chunk_size);
+    return __size <= static_cast<_difference_type>(__chunk_size);
 }
 
 struct __chunk_metrics
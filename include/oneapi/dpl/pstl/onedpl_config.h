@@ -49,6 +49,50 @@
 #    define _ONEDPL_PREDEFINED_POLICIES 1
 #endif
 
+// Huge page backing of the large temporary buffers of the parallel host algorithms (Linux only)
+#if defined(ONEDPL_SCRATCH_HUGE_PAGES)
+#    define _ONEDPL_SCRATCH_HUGE_PAGES ONEDPL_SCRATCH_HUGE_PAGES
+#else
+#    define _ONEDPL_SCRATCH_HUGE_PAGES 0
+#endif
+#if __linux__ && __has_include(<sys/mman.h>)
+#    define _ONEDPL_HUGE_PAGES_AVAILABLE 1
+#endif
+
+// Streaming (non-temporal) stores of the large fills and copies of the vectorized host algorithms (x86 only)
+#if defined(ONEDPL_STREAMING_STORES)
+#    define _ONEDPL_STREAMING_STORES ONEDPL_STREAMING_STORES
+#else
+#    define _ONEDPL_STREAMING_STORES 0
+#endif
+// Destination size in bytes from which the stores are streaming; zero selects the size of the last level cache
+#if defined(ONEDPL_STREAMING_STORES_THRESHOLD)
+#    define _ONEDPL_STREAMING_STORES_THRESHOLD ONEDPL_STREAMING_STORES_THRESHOLD
+#else
+#    define _ONEDPL_STREAMING_STORES_THRESHOLD 0
+#endif
+#if (defined(__x86_64__) || defined(_M_X64) || (defined(__i386__) && defined(__SSE2__))) &&                            \
+    !defined(__SYCL_DEVICE_ONLY__) && __has_include(<emmintrin.h>)
+#    define _ONEDPL_STREAMING_STORES_AVAILABLE 1
+#endif
+
+// Data sizes in bytes below which the loops of the parallel host backends run on the calling thread
+#if defined(ONEDPL_SERIAL_CUTOFF_FOR)
+#    define _ONEDPL_SERIAL_CUTOFF_FOR ONEDPL_SERIAL_CUTOFF_FOR
+#else
+#    define _ONEDPL_SERIAL_CUTOFF_FOR 4096
+#endif
+#if defined(ONEDPL_SERIAL_CUTOFF_REDUCE)
+#    define _ONEDPL_SERIAL_CUTOFF_REDUCE ONEDPL_SERIAL_CUTOFF_REDUCE
+#else
+#    define _ONEDPL_SERIAL_CUTOFF_REDUCE 4096
+#endif
+#if defined(ONEDPL_SERIAL_CUTOFF_SCAN)
+#    define _ONEDPL_SERIAL_CUTOFF_SCAN ONEDPL_SERIAL_CUTOFF_SCAN
+#else
+#    define _ONEDPL_SERIAL_CUTOFF_SCAN 8192
+#endif
+
 // Check availability of parallel backends
 #if __has_include(<tbb/tbb.h>)
 #    define _ONEDPL_TBB_AVAILABLE 1
@@ -137,6 +181,13 @@
 #    define _ONEDPL_PRAGMA_FORCEINLINE
 #endif
 
+// Software prefetch hint (read access, high temporal locality); no-op where the builtin is not available
+#if defined(__GNUC__) || defined(__clang__)
+#    define _ONEDPL_PREFETCH(ADDR) __builtin_prefetch(ADDR)
+#else
+#    define _ONEDPL_PREFETCH(ADDR)
+#endif
+
 #if (__INTEL_LLVM_COMPILER >= 20230100 || __INTEL_COMPILER >= 1900)
 #    define _ONEDPL_PRAGMA_SIMD_SCAN(PRM) _ONEDPL_PRAGMA(omp simd reduction(inscan, PRM))
 #    define _ONEDPL_PRAGMA_SIMD_INCLUSIVE_SCAN(PRM) _ONEDPL_PRAGMA(omp scan inclusive(PRM))
@@ -16,8 +16,11 @@
 #define _ONEDPL_PARALLEL_BACKEND_H
 #include "onedpl_config.h"
 
-// Select a parallel backend
-#if ONEDPL_USE_TBB_BACKEND || (!defined(ONEDPL_USE_TBB_BACKEND) && !ONEDPL_USE_OPENMP_BACKEND && _ONEDPL_TBB_AVAILABLE)
+// Select a parallel backend; the std::thread one is used only if requested
+#if ONEDPL_USE_STD_THREAD_BACKEND
+#    define _ONEDPL_PAR_BACKEND_STD_THREAD 1
+#    include "parallel_backend_std_thread.h"
+#elif ONEDPL_USE_TBB_BACKEND || (!defined(ONEDPL_USE_TBB_BACKEND) && !ONEDPL_USE_OPENMP_BACKEND && _ONEDPL_TBB_AVAILABLE)
 #    define _ONEDPL_PAR_BACKEND_TBB 1
 #    include "parallel_backend_tbb.h"
 #elif ONEDPL_USE_OPENMP_BACKEND || (!defined(ONEDPL_USE_OPENMP_BACKEND) && _ONEDPL_OPENMP_AVAILABLE)
@@ -43,6 +46,8 @@ namespace dpl
 namespace __par_backend = __tbb_backend;
 #elif _ONEDPL_PAR_BACKEND_OPENMP
 namespace __par_backend = __omp_backend;
+#elif _ONEDPL_PAR_BACKEND_STD_THREAD
+namespace __par_backend = __std_thread_backend;
 #elif _ONEDPL_PAR_BACKEND_SERIAL
 namespace __par_backend = __serial_backend;
 #else
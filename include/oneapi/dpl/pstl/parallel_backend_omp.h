@@ -24,6 +24,12 @@
 
 #include "./omp/parallel_invoke.h"
 
+//------------------------------------------------------------------------
+// parallel_async
+//------------------------------------------------------------------------
+
+#include "./omp/parallel_async.h"
+
 //------------------------------------------------------------------------
 // parallel_for
 //------------------------------------------------------------------------
@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <future>
 #include <memory>
 #include <numeric>
 #include <utility>
@@ -42,6 +43,13 @@ __cancel_execution(oneapi::dpl::__internal::__serial_backend_tag)
 {
 }
 
+template <class _ExecutionPolicy>
+std::size_t
+__max_concurrency(oneapi::dpl::__internal::__serial_backend_tag, const _ExecutionPolicy&)
+{
+    return 1;
+}
+
 template <class _ExecutionPolicy, class _Index, class _Fp>
 void
 __parallel_for(oneapi::dpl::__internal::__serial_backend_tag, _ExecutionPolicy&&, _Index __first, _Index __last,
@@ -120,6 +128,18 @@ __parallel_invoke(oneapi::dpl::__internal::__serial_backend_tag, _ExecutionPolic
     ::std::forward<_F2>(__f2)();
 }
 
+// No thread runs __f besides the caller: it runs before the return, so that it runs even if the returned future
+// is never waited for, and its result or exception is stored in the future
+template <class _ExecutionPolicy, typename _Fp>
+::std::future<::std::invoke_result_t<_Fp&>>
+__parallel_async(oneapi::dpl::__internal::__serial_backend_tag, _ExecutionPolicy&&, _Fp __f)
+{
+    ::std::packaged_task<::std::invoke_result_t<_Fp&>()> __task(::std::move(__f));
+    auto __future = __task.get_future();
+    __task();
+    return __future;
+}
+
 template <class _ExecutionPolicy, class _ForwardIterator, class _Fp>
 void
 __parallel_for_each(oneapi::dpl::__internal::__serial_backend_tag, _ExecutionPolicy&&, _ForwardIterator __begin,
@@ -0,0 +1,671 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+// This header guard is used to check inclusion of std::thread backend.
+// Changing this macro may result in broken tests.
+#ifndef _ONEDPL_PARALLEL_BACKEND_STD_THREAD_H
+#define _ONEDPL_PARALLEL_BACKEND_STD_THREAD_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "parallel_backend_utils.h"
+#include "./std_thread/thread_pool.h"
+
+namespace oneapi
+{
+namespace dpl
+{
+namespace __std_thread_backend
+{
+
+template <typename _ExecutionPolicy, typename _Tp>
+using __buffer = oneapi::dpl::__utils::__buffer_impl<std::decay_t<_ExecutionPolicy>, _Tp, std::allocator>;
+
+//------------------------------------------------------------------------
+// use to cancel execution
+//------------------------------------------------------------------------
+
+// Cancellation flag of the loop whose chunk the calling thread executes, null outside of the loops
+inline std::atomic<bool>*&
+__current_cancellation_flag()
+{
+    static thread_local std::atomic<bool>* __flag = nullptr;
+    return __flag;
+}
+
+// Cancels the innermost loop executing the caller: its chunks not started yet are skipped
+inline void
+__cancel_execution(oneapi::dpl::__internal::__std_thread_backend_tag)
+{
+    if (std::atomic<bool>* __flag = __std_thread_backend::__current_cancellation_flag())
+        __flag->store(true, std::memory_order_relaxed);
+}
+
+// Makes __cancel_execution target the flag of a loop for its lifetime, restoring the flag of the enclosing loop on
+// exit, an exception included
+class __cancellation_scope
+{
+    std::atomic<bool>* _M_outer;
+
+  public:
+    explicit __cancellation_scope(std::atomic<bool>& __cancelled)
+        : _M_outer(__std_thread_backend::__current_cancellation_flag())
+    {
+        __std_thread_backend::__current_cancellation_flag() = &__cancelled;
+    }
+
+    __cancellation_scope(const __cancellation_scope&) = delete;
+    __cancellation_scope&
+    operator=(const __cancellation_scope&) = delete;
+
+    ~__cancellation_scope() { __std_thread_backend::__current_cancellation_flag() = _M_outer; }
+};
+
+// Runs a chunk of a loop unless the loop has been cancelled, making __cancel_execution target the loop
+template <typename _Fp>
+void
+__run_cancellable(std::atomic<bool>& __cancelled, _Fp __f)
+{
+    if (__cancelled.load(std::memory_order_relaxed))
+        return;
+
+    __std_thread_backend::__cancellation_scope __scope(__cancelled);
+    __f();
+}
+
+//------------------------------------------------------------------------
+// policy tuning parameters
+//------------------------------------------------------------------------
+
+// Leaf size of the recursive sort and merge, which may only be raised through the policy tuning parameters
+constexpr std::size_t __default_leaf_size = 2048;
+
+template <class _ExecutionPolicy>
+std::size_t
+__leaf_size(const _ExecutionPolicy& __exec)
+{
+    return std::max(oneapi::dpl::__internal::__get_host_policy_params(__exec).__grainsize, __default_leaf_size);
+}
+
+// Number of the threads to split the work among: the one requested through the policy, or the size of the pool
+template <class _ExecutionPolicy>
+std::size_t
+__num_threads(const _ExecutionPolicy& __exec)
+{
+    const std::size_t __n = oneapi::dpl::__internal::__get_host_policy_params(__exec).__num_threads;
+    return __n ? __n : __std_thread_backend::__get_thread_pool().__size();
+}
+
+// Number of the threads that can take part in an algorithm run with the policy
+template <class _ExecutionPolicy>
+std::size_t
+__max_concurrency(oneapi::dpl::__internal::__std_thread_backend_tag, const _ExecutionPolicy& __exec)
+{
+    return __std_thread_backend::__num_threads(__exec);
+}
+
+// Size of the chunks a loop over __n elements is split into. The simple partitioner splits down to the grain size.
+// Otherwise there are a few chunks per thread, the work stealing balancing the load, or one chunk per thread for
+// the static partitioner and if the number of threads is requested, so that no more threads take part.
+template <class _ExecutionPolicy, typename _Size>
+std::size_t
+__chunk_size(const _ExecutionPolicy& __exec, _Size __n)
+{
+    const auto __params = oneapi::dpl::__internal::__get_host_policy_params(__exec);
+    const std::size_t __grainsize = std::max<std::size_t>(__params.__grainsize, 1);
+    if (__params.__partitioner == oneapi::dpl::execution::partitioner::simple)
+        return __grainsize;
+
+    const std::size_t __slack =
+        __params.__partitioner == oneapi::dpl::execution::partitioner::static_ || __params.__num_threads ? 1 : 4;
+    const std::size_t __n_chunks = __slack * __std_thread_backend::__num_threads(__exec);
+    return std::max((static_cast<std::size_t>(__n) + __n_chunks - 1) / __n_chunks, __grainsize);
+}
+
+// Evaluation of __f(i, j) for the chunks [i, j) of [__first, __last), split in halves down to __chunk_size
+template <class _Index, class _Fp>
+void
+__parallel_for_chunks(_Index __first, _Index __last, std::size_t __chunk_size, _Fp& __f)
+{
+    if (static_cast<std::size_t>(__last - __first) <= __chunk_size)
+    {
+        __f(__first, __last);
+        return;
+    }
+    const _Index __middle = __first + (__last - __first) / 2;
+    __std_thread_backend::__parallel_invoke_body(
+        [&]() { __std_thread_backend::__parallel_for_chunks(__first, __middle, __chunk_size, __f); },
+        [&]() { __std_thread_backend::__parallel_for_chunks(__middle, __last, __chunk_size, __f); });
+}
+
+//------------------------------------------------------------------------
+// parallel_invoke
+//------------------------------------------------------------------------
+
+template <class _ExecutionPolicy, typename _F1, typename _F2>
+void
+__parallel_invoke(oneapi::dpl::__internal::__std_thread_backend_tag, _ExecutionPolicy&&, _F1&& __f1, _F2&& __f2)
+{
+    __std_thread_backend::__run_on_pool([&]() { __std_thread_backend::__parallel_invoke_body(__f1, __f2); });
+}
+
+//------------------------------------------------------------------------
+// parallel_async
+//------------------------------------------------------------------------
+
+// __f runs on a worker of the pool, where the algorithms it calls split their work as nested ones
+template <class _ExecutionPolicy, typename _Fp>
+std::future<std::invoke_result_t<_Fp&>>
+__parallel_async(oneapi::dpl::__internal::__std_thread_backend_tag, _ExecutionPolicy&&, _Fp __f)
+{
+    std::packaged_task<std::invoke_result_t<_Fp&>()> __task(std::move(__f));
+    auto __future = __task.get_future();
+    __std_thread_backend::__get_thread_pool().__enqueue(std::move(__task));
+    return __future;
+}
+
+//------------------------------------------------------------------------
+// parallel_for
+//------------------------------------------------------------------------
+
+//! Evaluation of brick f[i,j) for each subrange [i,j) of [first,last)
+template <class _ExecutionPolicy, class _Index, class _Fp>
+void
+__parallel_for(oneapi::dpl::__internal::__std_thread_backend_tag, _ExecutionPolicy&& __exec, _Index __first,
+               _Index __last, _Fp __f)
+{
+    std::atomic<bool> __cancelled{false};
+    if (oneapi::dpl::__utils::__run_serial<oneapi::dpl::__utils::__loop_kind::__for>(
+            __exec, __last - __first, oneapi::dpl::__utils::__element_size<_Index>()))
+    {
+        // the loop is cancellable on its own, not as a part of the chunk of an enclosing loop run by the caller
+        __std_thread_backend::__run_cancellable(__cancelled, [&]() { __f(__first, __last); });
+        return;
+    }
+
+    const std::size_t __chunk_size = __std_thread_backend::__chunk_size(__exec, __last - __first);
+    auto __body = [&__f, &__cancelled](_Index __i, _Index __j) {
+        __std_thread_backend::__run_cancellable(__cancelled, [&]() { __f(__i, __j); });
+    };
+    __std_thread_backend::__run_on_pool(
+        [&]() { __std_thread_backend::__parallel_for_chunks(__first, __last, __chunk_size, __body); });
+}
+
+//------------------------------------------------------------------------
+// parallel_for_each
+//------------------------------------------------------------------------
+
+template <class _ForwardIterator, class _Fp>
+void
+__parallel_for_each_body(_ForwardIterator __first, std::size_t __n, std::size_t __chunk_size, _Fp& __f)
+{
+    if (__n <= __chunk_size)
+    {
+        for (; __n > 0; --__n, ++__first)
+            __f(*__first);
+        return;
+    }
+    const std::size_t __half = __n / 2;
+    __std_thread_backend::__parallel_invoke_body(
+        [&]() { __std_thread_backend::__parallel_for_each_body(__first, __half, __chunk_size, __f); },
+        [&]() {
+            __std_thread_backend::__parallel_for_each_body(std::next(__first, __half), __n - __half, __chunk_size,
+                                                           __f);
+        });
+}
+
+template <class _ExecutionPolicy, class _ForwardIterator, class _Fp>
+void
+__parallel_for_each(oneapi::dpl::__internal::__std_thread_backend_tag, _ExecutionPolicy&& __exec,
+                    _ForwardIterator __first, _ForwardIterator __last, _Fp __f)
+{
+    const std::size_t __n = std::distance(__first, __last);
+    const std::size_t __chunk_size = __std_thread_backend::__chunk_size(__exec, __n);
+    __std_thread_backend::__run_on_pool(
+        [&]() { __std_thread_backend::__parallel_for_each_body(__first, __n, __chunk_size, __f); });
+}
+
+//------------------------------------------------------------------------
+// parallel_reduce
+//------------------------------------------------------------------------
+
+template <class _Index, class _Value, typename _RealBody, typename _Reduction>
+_Value
+__parallel_reduce_body(_Index __first, _Index __last, const _Value& __identity, const _RealBody& __real_body,
+                       const _Reduction& __reduction, std::size_t __chunk_size)
+{
+    if (static_cast<std::size_t>(__last - __first) <= __chunk_size)
+        return __real_body(__first, __last, __identity);
+
+    const _Index __middle = __first + (__last - __first) / 2;
+    _Value __v1(__identity), __v2(__identity);
+    __std_thread_backend::__parallel_invoke_body(
+        [&]() {
+            __v1 = __std_thread_backend::__parallel_reduce_body(__first, __middle, __identity, __real_body,
+                                                                __reduction, __chunk_size);
+        },
+        [&]() {
+            __v2 = __std_thread_backend::__parallel_reduce_body(__middle, __last, __identity, __real_body, __reduction,
+                                                                __chunk_size);
+        });
+    return __reduction(__v1, __v2);
+}
+
+//------------------------------------------------------------------------
+// Notation:
+//      r(i,j,init) returns reduction of init with reduction over [i,j)
+//      c(x,y) combines values x and y that were the result of r
+//------------------------------------------------------------------------
+
+template <class _ExecutionPolicy, class _Value, class _Index, typename _RealBody, typename _Reduction>
+_Value
+__parallel_reduce(oneapi::dpl::__internal::__std_thread_backend_tag, _ExecutionPolicy&& __exec, _Index __first,
+                  _Index __last, const _Value& __identity, const _RealBody& __real_body, const _Reduction& __reduction)
+{
+    if (__first == __last)
+        return __identity;
+    if (oneapi::dpl::__utils::__run_serial<oneapi::dpl::__utils::__loop_kind::__reduce>(
+            __exec, __last - __first, oneapi::dpl::__utils::__element_size<_Index>()))
+        return __real_body(__first, __last, __identity);
+
+    const std::size_t __chunk_size = __std_thread_backend::__chunk_size(__exec, __last - __first);
+    _Value __result(__identity);
+    __std_thread_backend::__run_on_pool([&]() {
+        __result = __std_thread_backend::__parallel_reduce_body(__first, __last, __identity, __real_body, __reduction,
+                                                                __chunk_size);
+    });
+    return __result;
+}
+
+//------------------------------------------------------------------------
+// parallel_transform_reduce
+//
+// Notation:
+//      r(i,j,init) returns reduction of init with reduction over [i,j)
+//      u(i) returns f(i,i+1,identity) for a hypothetical left identity element of r
+//      c(x,y) combines values x and y that were the result of r or u
+//------------------------------------------------------------------------
+
+// Every chunk starts from the value of its first element, so no identity element is needed
+template <class _Index, class _UnaryOp, class _Tp, class _BinaryOp, class _Reduce>
+_Tp
+__transform_reduce_body(_Index __first, _Index __last, _UnaryOp& __unary_op, _BinaryOp& __combine, _Reduce& __reduce,
+                        std::size_t __chunk_size)
+{
+    if (static_cast<std::size_t>(__last - __first) <= __chunk_size)
+        return __reduce(__first + 1, __last, _Tp(__unary_op(__first)));
+
+    const _Index __middle = __first + (__last - __first) / 2;
+    std::optional<_Tp> __v1, __v2;
+    __std_thread_backend::__parallel_invoke_body(
+        [&]() {
+            __v1.emplace(__std_thread_backend::__transform_reduce_body<_Index, _UnaryOp, _Tp>(
+                __first, __middle, __unary_op, __combine, __reduce, __chunk_size));
+        },
+        [&]() {
+            __v2.emplace(__std_thread_backend::__transform_reduce_body<_Index, _UnaryOp, _Tp>(
+                __middle, __last, __unary_op, __combine, __reduce, __chunk_size));
+        });
+    return __combine(std::move(*__v1), std::move(*__v2));
+}
+
+template <class _ExecutionPolicy, class _Index, class _UnaryOp, class _Tp, class _BinaryOp, class _Reduce>
+_Tp
+__parallel_transform_reduce(oneapi::dpl::__internal::__std_thread_backend_tag, _ExecutionPolicy&& __exec,
+                            _Index __first, _Index __last, _UnaryOp __unary_op, _Tp __init, _BinaryOp __combine,
+                            _Reduce __reduce)
+{
+    if (__first == __last ||
+        oneapi::dpl::__utils::__run_serial<oneapi::dpl::__utils::__loop_kind::__reduce>(
+            __exec, __last - __first, oneapi::dpl::__utils::__element_size<_Index>()))
+        return __reduce(__first, __last, __init);
+
+    const std::size_t __chunk_size = __std_thread_backend::__chunk_size(__exec, __last - __first);
+    __std_thread_backend::__run_on_pool([&]() {
+        __init = __combine(__init, __std_thread_backend::__transform_reduce_body<_Index, _UnaryOp, _Tp>(
+                                       __first, __last, __unary_op, __combine, __reduce, __chunk_size));
+    });
+    return __init;
+}
+
+//------------------------------------------------------------------------
+// parallel_scan
+//------------------------------------------------------------------------
+
+template <typename _Index>
+_Index
+__split(_Index __m)
+{
+    _Index __k = 1;
+    while (2 * __k < __m)
+        __k *= 2;
+    return __k;
+}
+
+template <typename _Index, typename _Tp, typename _Rp, typename _Cp>
+void
+__upsweep(_Index __i, _Index __m, _Index __tilesize, _Tp* __r, _Index __lastsize, _Rp __reduce, _Cp __combine)
+{
+    if (__m == 1)
+        __r[0] = __reduce(__i * __tilesize, __lastsize);
+    else
+    {
+        _Index __k = __split(__m);
+        __std_thread_backend::__parallel_invoke_body(
+            [=] { __std_thread_backend::__upsweep(__i, __k, __tilesize, __r, __tilesize, __reduce, __combine); },
+            [=] {
+                __std_thread_backend::__upsweep(__i + __k, __m - __k, __tilesize, __r + __k, __lastsize, __reduce,
+                                                __combine);
+            });
+        if (__m == 2 * __k)
+            __r[__m - 1] = __combine(__r[__k - 1], __r[__m - 1]);
+    }
+}
+
+template <typename _Index, typename _Tp, typename _Cp, typename _Sp>
+void
+__downsweep(_Index __i, _Index __m, _Index __tilesize, _Tp* __r, _Index __lastsize, _Tp __initial, _Cp __combine,
+            _Sp __scan)
+{
+    if (__m == 1)
+        __scan(__i * __tilesize, __lastsize, __initial);
+    else
+    {
+        const _Index __k = __split(__m);
+        __std_thread_backend::__parallel_invoke_body(
+            [=] {
+                __std_thread_backend::__downsweep(__i, __k, __tilesize, __r, __tilesize, __initial, __combine, __scan);
+            },
+            // Assumes that __combine never throws.
+            [=, &__combine] {
+                __std_thread_backend::__downsweep(__i + __k, __m - __k, __tilesize, __r + __k, __lastsize,
+                                                  __combine(__initial, __r[__k - 1]), __combine, __scan);
+            });
+    }
+}
+
+// Adapted from Intel(R) Cilk(TM) version from cilkpub.
+// Let i:len denote a counted interval of length n starting at i.  s denotes a generalized-sum value.
+// Expected actions of the functors are:
+//     reduce(i,len) -> s  -- return reduction value of i:len.
+//     combine(s1,s2) -> s -- return merged sum
+//     apex(s) -- do any processing necessary between reduce and scan.
+//     scan(i,len,initial) -- perform scan over i:len starting with initial.
+// The initial range 0:n is partitioned into consecutive subranges.
+// reduce and scan are each called exactly once per subrange.
+// Thus callers can rely upon side effects in reduce.
+// combine must not throw an exception.
+// apex is called exactly once, after all calls to reduce and before all calls to scan.
+// T must have a trivial constructor and destructor.
+template <class _ExecutionPolicy, typename _Index, typename _Tp, typename _Rp, typename _Cp, typename _Sp, typename _Ap>
+void
+__parallel_strict_scan(oneapi::dpl::__internal::__std_thread_backend_tag, _ExecutionPolicy&& __exec, _Index __n,
+                       _Tp __initial, _Rp __reduce, _Cp __combine, _Sp __scan, _Ap __apex)
+{
+    const _Index __tilesize = static_cast<_Index>(__std_thread_backend::__chunk_size(__exec, __n));
+    if (__n <= __tilesize ||
+        oneapi::dpl::__utils::__run_serial<oneapi::dpl::__utils::__loop_kind::__scan>(__exec, __n, sizeof(_Tp)))
+    {
+        _Tp __sum = __initial;
+        if (__n)
+            __sum = __combine(__sum, __reduce(_Index(0), __n));
+        __apex(__sum);
+        if (__n)
+            __scan(_Index(0), __n, __initial);
+        return;
+    }
+
+    const _Index __m = (__n - 1) / __tilesize;
+    __buffer<_ExecutionPolicy, _Tp> __buf(__exec, __m + 1);
+    _Tp* __r = __buf.get();
+    __std_thread_backend::__run_on_pool([&]() {
+        __std_thread_backend::__upsweep(_Index(0), _Index(__m + 1), __tilesize, __r, __n - __m * __tilesize, __reduce,
+                                        __combine);
+
+        std::size_t __k = __m + 1;
+        _Tp __t = __r[__k - 1];
+        while ((__k &= __k - 1))
+            __t = __combine(__r[__k - 1], __t);
+        __apex(__combine(__initial, __t));
+        __std_thread_backend::__downsweep(_Index(0), _Index(__m + 1), __tilesize, __r, __n - __m * __tilesize,
+                                          __initial, __combine, __scan);
+    });
+}
+
+// The sums of the tiles are reduced in parallel, their prefixes computed by the caller, and the tiles are
+// scanned from their prefixes in parallel. Unlike for the strict scan, _Tp may be any copyable type.
+template <class _ExecutionPolicy, class _Index, class _Up, class _Tp, class _Cp, class _Rp, class _Sp>
+_Tp
+__parallel_transform_scan(oneapi::dpl::__internal::__std_thread_backend_tag, _ExecutionPolicy&& __exec, _Index __n,
+                          _Up __u, _Tp __init, _Cp __combine, _Rp __brick_reduce, _Sp __scan)
+{
+    const std::size_t __tilesize = __std_thread_backend::__chunk_size(__exec, __n);
+    if (static_cast<std::size_t>(__n) <= __tilesize ||
+        oneapi::dpl::__utils::__run_serial<oneapi::dpl::__utils::__loop_kind::__scan>(__exec, __n, sizeof(_Tp)))
+        return __scan(_Index(0), __n, __init);
+
+    const std::size_t __m = (static_cast<std::size_t>(__n) - 1) / __tilesize + 1;
+    std::vector<std::optional<_Tp>> __sums(__m);
+    auto __tile_first = [__tilesize](std::size_t __tile) { return static_cast<_Index>(__tile * __tilesize); };
+    auto __tile_last = [__tilesize, __n](std::size_t __tile) {
+        return static_cast<_Index>(std::min((__tile + 1) * __tilesize, static_cast<std::size_t>(__n)));
+    };
+
+    auto __reduce_tiles = [&](std::size_t __first, std::size_t __last) {
+        for (std::size_t __tile = __first; __tile != __last; ++__tile)
+        {
+            const _Index __i = __tile_first(__tile);
+            __sums[__tile].emplace(__brick_reduce(__i + 1, __tile_last(__tile), __u(__i)));
+        }
+    };
+    // The last tile is only scanned
+    __std_thread_backend::__run_on_pool(
+        [&]() { __std_thread_backend::__parallel_for_chunks(std::size_t(0), __m - 1, 1, __reduce_tiles); });
+
+    // __sums[__tile] becomes the initial value of the tile
+    std::optional<_Tp> __prefix(std::move(__init));
+    for (std::size_t __tile = 0; __tile < __m; ++__tile)
+    {
+        std::optional<_Tp> __next;
+        if (__tile + 1 < __m)
+            __next.emplace(__combine(*__prefix, *__sums[__tile]));
+        __sums[__tile] = std::move(__prefix);
+        __prefix = std::move(__next);
+    }
+
+    std::optional<_Tp> __result;
+    auto __scan_tiles = [&](std::size_t __first, std::size_t __last) {
+        for (std::size_t __tile = __first; __tile != __last; ++__tile)
+        {
+            _Tp __sum = __scan(__tile_first(__tile), __tile_last(__tile), *__sums[__tile]);
+            if (__tile + 1 == __m)
+                __result.emplace(std::move(__sum));
+        }
+    };
+    __std_thread_backend::__run_on_pool(
+        [&]() { __std_thread_backend::__parallel_for_chunks(std::size_t(0), __m, 1, __scan_tiles); });
+    return std::move(*__result);
+}
+
+//------------------------------------------------------------------------
+// parallel_merge
+//------------------------------------------------------------------------
+
+template <typename _RandomAccessIterator1, typename _RandomAccessIterator2, typename _RandomAccessIterator3,
+          typename _Compare, typename _LeafMerge>
+void
+__parallel_merge_body(std::size_t __size_x, std::size_t __size_y, _RandomAccessIterator1 __xs,
+                      _RandomAccessIterator1 __xe, _RandomAccessIterator2 __ys, _RandomAccessIterator2 __ye,
+                      _RandomAccessIterator3 __zs, _Compare __comp, _LeafMerge& __leaf_merge, std::size_t __leaf_size)
+{
+    if (__size_x + __size_y <= __leaf_size)
+    {
+        __leaf_merge(__xs, __xe, __ys, __ye, __zs, __comp);
+        return;
+    }
+
+    // The larger range is split in halves, the smaller one at the matching position
+    _RandomAccessIterator1 __xm;
+    _RandomAccessIterator2 __ym;
+    if (__size_x < __size_y)
+    {
+        __ym = __ys + (__size_y / 2);
+        __xm = std::upper_bound(__xs, __xe, *__ym, __comp);
+    }
+    else
+    {
+        __xm = __xs + (__size_x / 2);
+        __ym = std::lower_bound(__ys, __ye, *__xm, __comp);
+    }
+    const _RandomAccessIterator3 __zm = __zs + (__xm - __xs) + (__ym - __ys);
+
+    __std_thread_backend::__parallel_invoke_body(
+        [&]() {
+            __std_thread_backend::__parallel_merge_body(__xm - __xs, __ym - __ys, __xs, __xm, __ys, __ym, __zs, __comp,
+                                                        __leaf_merge, __leaf_size);
+        },
+        [&]() {
+            __std_thread_backend::__parallel_merge_body(__xe - __xm, __ye - __ym, __xm, __xe, __ym, __ye, __zm, __comp,
+                                                        __leaf_merge, __leaf_size);
+        });
+}
+
+template <class _ExecutionPolicy, typename _RandomAccessIterator1, typename _RandomAccessIterator2,
+          typename _RandomAccessIterator3, typename _Compare, typename _LeafMerge>
+void
+__parallel_merge(oneapi::dpl::__internal::__std_thread_backend_tag, _ExecutionPolicy&& __exec,
+                 _RandomAccessIterator1 __xs, _RandomAccessIterator1 __xe, _RandomAccessIterator2 __ys,
+                 _RandomAccessIterator2 __ye, _RandomAccessIterator3 __zs, _Compare __comp, _LeafMerge __leaf_merge)
+{
+    const std::size_t __size_x = __xe - __xs;
+    const std::size_t __size_y = __ye - __ys;
+    const std::size_t __leaf_size = __std_thread_backend::__leaf_size(__exec);
+    if (__size_x + __size_y <= __leaf_size)
+    {
+        __leaf_merge(__xs, __xe, __ys, __ye, __zs, __comp);
+        return;
+    }
+
+    __std_thread_backend::__run_on_pool([&]() {
+        __std_thread_backend::__parallel_merge_body(__size_x, __size_y, __xs, __xe, __ys, __ye, __zs, __comp,
+                                                    __leaf_merge, __leaf_size);
+    });
+}
+
+//------------------------------------------------------------------------
+// parallel_stable_sort
+//------------------------------------------------------------------------
+
+// Sorts the halves of [__xs, __xe), merges them into the raw buffer __zs constructing the elements there, then
+// moves them back, so that the leaves are always sorted in place.
+// For a partial sort only the first __nsort elements of a range are sorted, and they are the smallest ones: so are
+// the first __nsort elements of each half, and only these are merged.
+template <typename _RandomAccessIterator, typename _ValueType, typename _Compare, typename _LeafSort>
+void
+__parallel_stable_sort_body(_RandomAccessIterator __xs, _RandomAccessIterator __xe, _ValueType* __zs, _Compare __comp,
+                            _LeafSort& __leaf_sort, std::size_t __leaf_size, std::size_t __nsort)
+{
+    const std::size_t __n = __xe - __xs;
+    if (__n <= __leaf_size)
+    {
+        __leaf_sort(__xs, __xe, __comp);
+        return;
+    }
+
+    const _RandomAccessIterator __xm = __xs + __n / 2;
+    __std_thread_backend::__parallel_invoke_body(
+        [&]() {
+            __std_thread_backend::__parallel_stable_sort_body(__xs, __xm, __zs, __comp, __leaf_sort, __leaf_size,
+                                                              __nsort);
+        },
+        [&]() {
+            __std_thread_backend::__parallel_stable_sort_body(__xm, __xe, __zs + (__xm - __xs), __comp, __leaf_sort,
+                                                              __leaf_size, __nsort);
+        });
+
+    const std::size_t __kx = std::min<std::size_t>(__nsort, __xm - __xs);
+    const std::size_t __ky = std::min<std::size_t>(__nsort, __xe - __xm);
+    const std::size_t __nmerge = __kx + __ky;
+
+    auto __construct_value = [](_RandomAccessIterator __x, _ValueType* __z) {
+        ::new (static_cast<void*>(__z)) _ValueType(std::move(*__x));
+    };
+    auto __construct_range = [](_RandomAccessIterator __first, _RandomAccessIterator __last, _ValueType* __z) {
+        return std::uninitialized_move(__first, __last, __z);
+    };
+    auto __leaf_merge = [__nmerge, __construct_value, __construct_range](
+                            _RandomAccessIterator __as, _RandomAccessIterator __ae, _RandomAccessIterator __bs,
+                            _RandomAccessIterator __be, _ValueType* __cs, _Compare __comp) {
+        oneapi::dpl::__utils::__serial_move_merge __merge(__nmerge);
+        __merge(__as, __ae, __bs, __be, __cs, __comp, __construct_value, __construct_value, __construct_range,
+                __construct_range);
+    };
+    __std_thread_backend::__parallel_merge_body(__kx, __ky, __xs, __xs + __kx, __xm, __xm + __ky, __zs, __comp,
+                                                __leaf_merge, __leaf_size);
+
+    // The unsorted elements of the first half lying where the merged ones go take the places emptied in the
+    // second half
+    const std::size_t __displaced = std::min<std::size_t>(__xm - __xs - __kx, __ky);
+    std::move(__xs + __kx, __xs + __kx + __displaced, __xm + __ky - __displaced);
+
+    auto __move_back = [__xs, __zs](std::size_t __i, std::size_t __j) {
+        std::move(__zs + __i, __zs + __j, __xs + __i);
+        std::destroy(__zs + __i, __zs + __j);
+    };
+    __std_thread_backend::__parallel_for_chunks(std::size_t(0), __nmerge, __leaf_size, __move_back);
+}
+
+template <class _ExecutionPolicy, typename _RandomAccessIterator, typename _Compare, typename _LeafSort>
+void
+__parallel_stable_sort(oneapi::dpl::__internal::__std_thread_backend_tag, _ExecutionPolicy&& __exec,
+                       _RandomAccessIterator __xs, _RandomAccessIterator __xe, _Compare __comp, _LeafSort __leaf_sort,
+                       std::size_t __nsort = 0)
+{
+    using _ValueType = typename std::iterator_traits<_RandomAccessIterator>::value_type;
+
+    const std::size_t __leaf_size = __std_thread_backend::__leaf_size(__exec);
+    const std::size_t __n = __xe - __xs;
+    if (__nsort == 0 || __nsort > __n)
+        __nsort = __n;
+    if (__n <= __leaf_size)
+    {
+        __leaf_sort(__xs, __xe, __comp);
+        return;
+    }
+
+    __buffer<_ExecutionPolicy, _ValueType> __buf(__exec, __n);
+    if (!__buf)
+        throw std::bad_alloc();
+    __std_thread_backend::__run_on_pool([&]() {
+        __std_thread_backend::__parallel_stable_sort_body(__xs, __xe, __buf.get(), __comp, __leaf_sort, __leaf_size,
+                                                          __nsort);
+    });
+}
+
+} // namespace __std_thread_backend
+} // namespace dpl
+} // namespace oneapi
+
+#endif // _ONEDPL_PARALLEL_BACKEND_STD_THREAD_H
@@ -20,6 +20,11 @@
 
 #include <cassert>
 #include <algorithm>
+#include <future>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <type_traits>
 
 #include "parallel_backend_utils.h"
@@ -54,20 +59,162 @@ namespace __tbb_backend
 not an initialize array, because initialization/destruction
 would make the span be at least O(N). */
 // tbb::allocator can improve performance in some cases.
+struct __first_touch_placement;
 template <typename _ExecutionPolicy, typename _Tp>
-using __buffer = oneapi::dpl::__utils::__buffer_impl<std::decay_t<_ExecutionPolicy>, _Tp, tbb::tbb_allocator>;
+using __buffer = oneapi::dpl::__utils::__buffer_impl<std::decay_t<_ExecutionPolicy>, _Tp, tbb::tbb_allocator,
+                                                     __tbb_backend::__first_touch_placement>;
 
 // Wrapper for tbb::task
+// A loop below the serial cutoff runs outside of any task, and then there is nothing to cancel
 inline void
 __cancel_execution(oneapi::dpl::__internal::__tbb_backend_tag)
 {
 #if TBB_INTERFACE_VERSION <= 12000
     tbb::task::self().group()->cancel_group_execution();
 #else
-    tbb::task::current_context()->cancel_group_execution();
+    if (tbb::task_group_context* __context = tbb::task::current_context())
+        __context->cancel_group_execution();
 #endif
 }
 
+//------------------------------------------------------------------------
+// policy tuning parameters
+//------------------------------------------------------------------------
+
+// Grain size requested through the policy, bounded from below by the minimum the caller can handle
+template <class _ExecutionPolicy>
+::std::size_t
+__grainsize(const _ExecutionPolicy& __exec, ::std::size_t __min_grainsize = 1)
+{
+    return ::std::max(oneapi::dpl::__internal::__get_host_policy_params(__exec).__grainsize, __min_grainsize);
+}
+
+// Leaf size of the recursive sort and merge: a larger grain size requested through the policy raises the cut-off,
+// while smaller ones are ignored since the splitting of those algorithms relies on sufficiently large leaves
+template <class _ExecutionPolicy>
+::std::size_t
+__cut_off(const _ExecutionPolicy& __exec, ::std::size_t __default_cut_off)
+{
+    return __tbb_backend::__grainsize(__exec, __default_cut_off);
+}
+
+// Calls __f with the TBB partitioner requested through the policy
+template <class _ExecutionPolicy, typename _Fp>
+auto
+__invoke_with_partitioner(const _ExecutionPolicy& __exec, _Fp __f)
+{
+    switch (oneapi::dpl::__internal::__get_host_policy_params(__exec).__partitioner)
+    {
+    case oneapi::dpl::execution::partitioner::simple:
+        return __f(tbb::simple_partitioner());
+    case oneapi::dpl::execution::partitioner::static_:
+        return __f(tbb::static_partitioner());
+    default:
+        return __f(tbb::auto_partitioner());
+    }
+}
+
+// Calls __f inside the arena the policy is bound to
+template <typename _Fp>
+auto
+__invoke_in_arena(const oneapi::dpl::execution::__host_policy_params& __params, _Fp __f) -> decltype(__f())
+{
+    using _Tp = decltype(__f());
+    if constexpr (::std::is_void_v<_Tp>)
+    {
+        __params.__arena_execute(
+            __params.__arena, [](void* __context) { (*static_cast<_Fp*>(__context))(); }, &__f);
+    }
+    else
+    {
+        ::std::optional<_Tp> __result;
+        auto __body = [&__result, &__f]() { __result.emplace(__f()); };
+        __params.__arena_execute(
+            __params.__arena, [](void* __context) { (*static_cast<decltype(__body)*>(__context))(); }, &__body);
+        return ::std::move(*__result);
+    }
+}
+
+// Arena limited to __num_threads threads, shared by the calls requesting that number. The arenas are created on
+// first use and never destroyed, since the algorithms may be called until the exit of the program.
+inline tbb::task_arena&
+__arena_with_concurrency(int __num_threads)
+{
+    // The consecutive calls of a thread usually request the same number
+    static thread_local ::std::pair<int, tbb::task_arena*> __last{0, nullptr};
+    if (__last.first != __num_threads)
+    {
+        static ::std::mutex __mutex;
+        static auto* __arenas = new ::std::map<int, tbb::task_arena>;
+        ::std::lock_guard<::std::mutex> __lock(__mutex);
+        __last = {__num_threads, &__arenas->try_emplace(__num_threads, __num_threads).first->second};
+    }
+    return *__last.second;
+}
+
+// Runs __f isolated inside the arena requested through the policy: the one it is bound to, the shared one
+// limited to the requested number of threads, or the arena of the calling thread
+template <class _ExecutionPolicy, typename _Fp>
+auto
+__isolate_in_arena(const _ExecutionPolicy& __exec, _Fp __f) -> decltype(__f())
+{
+    const auto __params = oneapi::dpl::__internal::__get_host_policy_params(__exec);
+    auto __isolated = [&__f]() { return tbb::this_task_arena::isolate(__f); };
+    if (__params.__arena)
+        return __tbb_backend::__invoke_in_arena(__params, __isolated);
+
+    // Nested calls are already running in an arena of the requested concurrency
+    const int __num_threads = static_cast<int>(__params.__num_threads);
+    if (__num_threads > 0 && __num_threads != tbb::this_task_arena::max_concurrency())
+    {
+        return __tbb_backend::__arena_with_concurrency(__num_threads).execute(__isolated);
+    }
+    return __isolated();
+}
+
+// Number of the threads that can take part in an algorithm run with the policy: the concurrency of the arena
+// __isolate_in_arena runs it in
+template <class _ExecutionPolicy>
+std::size_t
+__max_concurrency(oneapi::dpl::__internal::__tbb_backend_tag, const _ExecutionPolicy& __exec)
+{
+    const auto __params = oneapi::dpl::__internal::__get_host_policy_params(__exec);
+    if (__params.__arena)
+        return __tbb_backend::__invoke_in_arena(__params, []() { return tbb::this_task_arena::max_concurrency(); });
+    return __params.__num_threads ? __params.__num_threads : tbb::this_task_arena::max_concurrency();
+}
+
+//------------------------------------------------------------------------
+// NUMA placement of the temporary buffers
+//------------------------------------------------------------------------
+
+// Touches the pages of a large buffer from the threads processing the matching chunks under static partitioning
+struct __first_touch_placement
+{
+    template <class _ExecutionPolicy>
+    void
+    operator()(const _ExecutionPolicy& __exec, void* __ptr, ::std::size_t __size) const
+    {
+        if (oneapi::dpl::__internal::__get_host_policy_params(__exec).__numa_placement !=
+                oneapi::dpl::execution::numa_placement::first_touch ||
+            __size < __utils::__first_touch_min_size)
+            return;
+
+        constexpr ::std::size_t __page_size = __utils::__first_touch_page_size;
+        char* __bytes = static_cast<char*>(__ptr);
+        const ::std::size_t __n_pages = (__size - 1) / __page_size + 1;
+        __tbb_backend::__isolate_in_arena(__exec, [__bytes, __n_pages]() {
+            tbb::parallel_for(
+                tbb::blocked_range<::std::size_t>(0, __n_pages),
+                [__bytes](const tbb::blocked_range<::std::size_t>& __r) {
+                    for (::std::size_t __i = __r.begin(); __i != __r.end(); ++__i)
+                        __bytes[__i * __page_size] = 0;
+                },
+                tbb::static_partitioner());
+        });
+    }
+};
+
 //------------------------------------------------------------------------
 // parallel_for
 //------------------------------------------------------------------------
@@ -92,10 +239,22 @@ class __parallel_for_body
 // wrapper over tbb::parallel_for
 template <class _ExecutionPolicy, class _Index, class _Fp>
 void
-__parallel_for(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPolicy&&, _Index __first, _Index __last, _Fp __f)
+__parallel_for(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPolicy&& __exec, _Index __first, _Index __last,
+               _Fp __f)
 {
-    tbb::this_task_arena::isolate([=]() {
-        tbb::parallel_for(tbb::blocked_range<_Index>(__first, __last), __parallel_for_body<_Index, _Fp>(__f));
+    if (oneapi::dpl::__utils::__run_serial<oneapi::dpl::__utils::__loop_kind::__for>(
+            __exec, __last - __first, oneapi::dpl::__utils::__element_size<_Index>()))
+    {
+        __f(__first, __last);
+        return;
+    }
+
+    const ::std::size_t __grain = __tbb_backend::__grainsize(__exec);
+    __tbb_backend::__invoke_with_partitioner(__exec, [=](const auto& __partitioner) {
+        __tbb_backend::__isolate_in_arena(__exec, [=, &__partitioner]() {
+            tbb::parallel_for(tbb::blocked_range<_Index>(__first, __last, __grain),
+                              __parallel_for_body<_Index, _Fp>(__f), __partitioner);
+        });
     });
 }
 
@@ -103,16 +262,23 @@ __parallel_for(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPolicy&&, _
 // wrapper over tbb::parallel_reduce
 template <class _ExecutionPolicy, class _Value, class _Index, typename _RealBody, typename _Reduction>
 _Value
-__parallel_reduce(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPolicy&&, _Index __first, _Index __last,
+__parallel_reduce(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPolicy&& __exec, _Index __first, _Index __last,
                   const _Value& __identity, const _RealBody& __real_body, const _Reduction& __reduction)
 {
-    return tbb::this_task_arena::isolate([__first, __last, &__identity, &__real_body, &__reduction]() -> _Value {
-        return tbb::parallel_reduce(
-            tbb::blocked_range<_Index>(__first, __last), __identity,
-            [__real_body](const tbb::blocked_range<_Index>& __r, const _Value& __value) -> _Value {
-                return __real_body(__r.begin(), __r.end(), __value);
-            },
-            __reduction);
+    if (oneapi::dpl::__utils::__run_serial<oneapi::dpl::__utils::__loop_kind::__reduce>(
+            __exec, __last - __first, oneapi::dpl::__utils::__element_size<_Index>()))
+        return __first == __last ? __identity : __real_body(__first, __last, __identity);
+
+    const ::std::size_t __grain = __tbb_backend::__grainsize(__exec);
+    return __tbb_backend::__invoke_with_partitioner(__exec, [&](const auto& __partitioner) -> _Value {
+        return __tbb_backend::__isolate_in_arena(__exec, [&]() -> _Value {
+            return tbb::parallel_reduce(
+                tbb::blocked_range<_Index>(__first, __last, __grain), __identity,
+                [__real_body](const tbb::blocked_range<_Index>& __r, const _Value& __value) -> _Value {
+                    return __real_body(__r.begin(), __r.end(), __value);
+                },
+                __reduction, __partitioner);
+        });
     });
 }
 
@@ -184,13 +350,21 @@ struct __par_trans_red_body
 
 template <class _ExecutionPolicy, class _Index, class _Up, class _Tp, class _Cp, class _Rp>
 _Tp
-__parallel_transform_reduce(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPolicy&&, _Index __first,
+__parallel_transform_reduce(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPolicy&& __exec, _Index __first,
                             _Index __last, _Up __u, _Tp __init, _Cp __combine, _Rp __brick_reduce)
 {
+    if (oneapi::dpl::__utils::__run_serial<oneapi::dpl::__utils::__loop_kind::__reduce>(
+            __exec, __last - __first, oneapi::dpl::__utils::__element_size<_Index>()))
+        return __brick_reduce(__first, __last, __init);
+
     __tbb_backend::__par_trans_red_body<_Index, _Up, _Tp, _Cp, _Rp> __body(__u, __init, __combine, __brick_reduce);
-    // The grain size of 3 is used in order to provide minimum 2 elements for each body
-    tbb::this_task_arena::isolate(
-        [__first, __last, &__body]() { tbb::parallel_reduce(tbb::blocked_range<_Index>(__first, __last, 3), __body); });
+    // The grain size of at least 3 is used in order to provide minimum 2 elements for each body
+    const ::std::size_t __grain = __tbb_backend::__grainsize(__exec, 3);
+    __tbb_backend::__invoke_with_partitioner(__exec, [&](const auto& __partitioner) {
+        __tbb_backend::__isolate_in_arena(__exec, [&]() {
+            tbb::parallel_reduce(tbb::blocked_range<_Index>(__first, __last, __grain), __body, __partitioner);
+        });
+    });
     return __body.sum();
 }
 
@@ -356,12 +530,17 @@ void
 __parallel_strict_scan(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPolicy&& __exec, _Index __n, _Tp __initial,
                        _Rp __reduce, _Cp __combine, _Sp __scan, _Ap __apex)
 {
-    tbb::this_task_arena::isolate([=, &__combine]() {
-        if (__n > 1)
+    const _Index __grain = __tbb_backend::__grainsize(__exec);
+    const auto __partitioner = oneapi::dpl::__internal::__get_host_policy_params(__exec).__partitioner;
+    const bool __serial =
+        oneapi::dpl::__utils::__run_serial<oneapi::dpl::__utils::__loop_kind::__scan>(__exec, __n, sizeof(_Tp));
+    __tbb_backend::__isolate_in_arena(__exec, [=, &__combine]() {
+        if (__n > 1 && !__serial)
         {
             _Index __p = tbb::this_task_arena::max_concurrency();
-            const _Index __slack = 4;
-            _Index __tilesize = (__n - 1) / (__slack * __p) + 1;
+            // The static partitioner asks for one tile per thread; otherwise tiles are oversubscribed for balancing
+            const _Index __slack = __partitioner == oneapi::dpl::execution::partitioner::static_ ? 1 : 4;
+            _Index __tilesize = ::std::max<_Index>((__n - 1) / (__slack * __p) + 1, __grain);
             _Index __m = (__n - 1) / __tilesize;
             __tbb_backend::__buffer<_ExecutionPolicy, _Tp> __buf(__exec, __m + 1);
             _Tp* __r = __buf.get();
@@ -381,7 +560,7 @@ __parallel_strict_scan(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPol
                                        __combine, __scan);
             return;
         }
-        // Fewer than 2 elements in sequence, or out of memory.  Handle has single block.
+        // Fewer than 2 elements in sequence, or below the serial cutoff.  Handle has single block.
         _Tp __sum = __initial;
         if (__n)
             __sum = __combine(__sum, __reduce(_Index(0), __n));
@@ -393,12 +572,21 @@ __parallel_strict_scan(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPol
 
 template <class _ExecutionPolicy, class _Index, class _Up, class _Tp, class _Cp, class _Rp, class _Sp>
 _Tp
-__parallel_transform_scan(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPolicy&&, _Index __n, _Up __u,
+__parallel_transform_scan(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPolicy&& __exec, _Index __n, _Up __u,
                           _Tp __init, _Cp __combine, _Rp __brick_reduce, _Sp __scan)
 {
+    if (oneapi::dpl::__utils::__run_serial<oneapi::dpl::__utils::__loop_kind::__scan>(__exec, __n, sizeof(_Tp)))
+        return __scan(_Index(0), __n, __init);
+
     __trans_scan_body<_Index, _Up, _Tp, _Cp, _Rp, _Sp> __body(__u, __init, __combine, __brick_reduce, __scan);
-    auto __range = tbb::blocked_range<_Index>(0, __n);
-    tbb::this_task_arena::isolate([__range, &__body]() { tbb::parallel_scan(__range, __body); });
+    auto __range = tbb::blocked_range<_Index>(0, __n, __tbb_backend::__grainsize(__exec));
+    // tbb::parallel_scan supports only the auto and simple partitioners
+    if (oneapi::dpl::__internal::__get_host_policy_params(__exec).__partitioner ==
+        oneapi::dpl::execution::partitioner::simple)
+        __tbb_backend::__isolate_in_arena(
+            __exec, [__range, &__body]() { tbb::parallel_scan(__range, __body, tbb::simple_partitioner()); });
+    else
+        __tbb_backend::__isolate_in_arena(__exec, [__range, &__body]() { tbb::parallel_scan(__range, __body); });
     return __body.sum();
 }
 
@@ -1106,13 +1294,14 @@ class __stable_sort_func
     _LeafSort _M_leaf_sort;
     bool _M_root;
     _SizeType _M_nsort; //zero or number of elements to be sorted for partial_sort alforithm
+    _SizeType _M_sort_cut_off;
 
   public:
     __stable_sort_func(_RandomAccessIterator1 __xs, _RandomAccessIterator1 __xe, _RandomAccessIterator2 __zs,
                        bool __root, _Compare __comp, _LeafSort __leaf_sort, _SizeType __nsort,
-                       _RandomAccessIterator1 __x_beg, _RandomAccessIterator2 __z_beg)
+                       _RandomAccessIterator1 __x_beg, _RandomAccessIterator2 __z_beg, _SizeType __sort_cut_off)
         : _M_xs(__xs), _M_xe(__xe), _M_x_beg(__x_beg), _M_zs(__zs), _M_z_beg(__z_beg), _M_comp(__comp),
-          _M_leaf_sort(__leaf_sort), _M_root(__root), _M_nsort(__nsort)
+          _M_leaf_sort(__leaf_sort), _M_root(__root), _M_nsort(__nsort), _M_sort_cut_off(__sort_cut_off)
     {
     }
 
@@ -1134,8 +1323,7 @@ __stable_sort_func<_RandomAccessIterator1, _RandomAccessIterator2, _Compare, _Le
 
     const _SizeType __n = _M_xe - _M_xs;
     const _SizeType __nmerge = ::std::min(_M_nsort, __n);
-    const _SizeType __sort_cut_off = _ONEDPL_STABLE_SORT_CUT_OFF;
-    if (__n <= __sort_cut_off)
+    if (__n <= _M_sort_cut_off)
     {
         _M_leaf_sort(_M_xs, _M_xe, _M_comp);
         assert(!_M_root);
@@ -1151,7 +1339,8 @@ __stable_sort_func<_RandomAccessIterator1, _RandomAccessIterator2, _Compare, _Le
     auto __parent = __self->make_continuation(::std::move(__m));
     __parent->set_ref_count(2);
     auto __right = __self->make_child_of(
-        __parent, __stable_sort_func(__xm, _M_xe, __zm, false, _M_comp, _M_leaf_sort, _M_nsort, _M_x_beg, _M_z_beg));
+        __parent, __stable_sort_func(__xm, _M_xe, __zm, false, _M_comp, _M_leaf_sort, _M_nsort, _M_x_beg, _M_z_beg,
+                                     _M_sort_cut_off));
     __self->spawn(__right);
     __self->recycle_as_child_of(__parent);
     _M_root = false;
@@ -1166,18 +1355,18 @@ __parallel_stable_sort(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPol
                        _RandomAccessIterator __xs, _RandomAccessIterator __xe, _Compare __comp, _LeafSort __leaf_sort,
                        ::std::size_t __nsort)
 {
-    tbb::this_task_arena::isolate([=, &__nsort]() {
+    const ::std::size_t __sort_cut_off = __tbb_backend::__cut_off(__exec, _ONEDPL_STABLE_SORT_CUT_OFF);
+    __tbb_backend::__isolate_in_arena(__exec, [=, &__nsort]() {
         //sorting based on task tree and parallel merge
         typedef typename ::std::iterator_traits<_RandomAccessIterator>::value_type _ValueType;
         typedef typename ::std::iterator_traits<_RandomAccessIterator>::difference_type _DifferenceType;
         const _DifferenceType __n = __xe - __xs;
 
-        const _DifferenceType __sort_cut_off = _ONEDPL_STABLE_SORT_CUT_OFF;
-        if (__n > __sort_cut_off)
+        if (__n > static_cast<_DifferenceType>(__sort_cut_off))
         {
             __tbb_backend::__buffer<_ExecutionPolicy, _ValueType> __buf(__exec, __n);
             __root_task<__stable_sort_func<_RandomAccessIterator, _ValueType*, _Compare, _LeafSort>> __root{
-                __xs, __xe, __buf.get(), true, __comp, __leaf_sort, __nsort, __xs, __buf.get()};
+                __xs, __xe, __buf.get(), true, __comp, __leaf_sort, __nsort, __xs, __buf.get(), __sort_cut_off};
             __task::spawn_root_and_wait(__root);
             return;
         }
@@ -1198,12 +1387,14 @@ class __merge_func_static
     _RandomAccessIterator3 _M_zs;
     _Compare _M_comp;
     _LeafMerge _M_leaf_merge;
+    ::std::size_t _M_merge_cut_off;
 
   public:
     __merge_func_static(_RandomAccessIterator1 __xs, _RandomAccessIterator1 __xe, _RandomAccessIterator2 __ys,
                         _RandomAccessIterator2 __ye, _RandomAccessIterator3 __zs, _Compare __comp,
-                        _LeafMerge __leaf_merge)
-        : _M_xs(__xs), _M_xe(__xe), _M_ys(__ys), _M_ye(__ye), _M_zs(__zs), _M_comp(__comp), _M_leaf_merge(__leaf_merge)
+                        _LeafMerge __leaf_merge, ::std::size_t __merge_cut_off)
+        : _M_xs(__xs), _M_xe(__xe), _M_ys(__ys), _M_ye(__ye), _M_zs(__zs), _M_comp(__comp), _M_leaf_merge(__leaf_merge),
+          _M_merge_cut_off(__merge_cut_off)
     {
     }
 
@@ -1222,8 +1413,7 @@ operator()(__task* __self)
     typedef typename ::std::iterator_traits<_RandomAccessIterator2>::difference_type _DifferenceType2;
     typedef typename ::std::common_type_t<_DifferenceType1, _DifferenceType2> _SizeType;
     const _SizeType __n = (_M_xe - _M_xs) + (_M_ye - _M_ys);
-    const _SizeType __merge_cut_off = _ONEDPL_MERGE_CUT_OFF;
-    if (__n <= __merge_cut_off)
+    if (__n <= static_cast<_SizeType>(_M_merge_cut_off))
     {
         _M_leaf_merge(_M_xs, _M_xe, _M_ys, _M_ye, _M_zs, _M_comp);
         return nullptr;
@@ -1243,7 +1433,8 @@ operator()(__task* __self)
     }
     const _RandomAccessIterator3 __zm = _M_zs + ((__xm - _M_xs) + (__ym - _M_ys));
     auto __right = __self->make_additional_child_of(
-        __self->parent(), __merge_func_static(__xm, _M_xe, __ym, _M_ye, __zm, _M_comp, _M_leaf_merge));
+        __self->parent(),
+        __merge_func_static(__xm, _M_xe, __ym, _M_ye, __zm, _M_comp, _M_leaf_merge, _M_merge_cut_off));
     __self->spawn(__right);
     __self->recycle_as_continuation();
     _M_xe = __xm;
@@ -1255,7 +1446,7 @@ operator()(__task* __self)
 template <class _ExecutionPolicy, typename _RandomAccessIterator1, typename _RandomAccessIterator2,
           typename _RandomAccessIterator3, typename _Compare, typename _LeafMerge>
 void
-__parallel_merge(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPolicy&&, _RandomAccessIterator1 __xs,
+__parallel_merge(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPolicy&& __exec, _RandomAccessIterator1 __xs,
                  _RandomAccessIterator1 __xe, _RandomAccessIterator2 __ys, _RandomAccessIterator2 __ye,
                  _RandomAccessIterator3 __zs, _Compare __comp, _LeafMerge __leaf_merge)
 {
@@ -1263,19 +1454,19 @@ __parallel_merge(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPolicy&&,
     typedef typename ::std::iterator_traits<_RandomAccessIterator2>::difference_type _DifferenceType2;
     typedef typename ::std::common_type_t<_DifferenceType1, _DifferenceType2> _SizeType;
     const _SizeType __n = (__xe - __xs) + (__ye - __ys);
-    const _SizeType __merge_cut_off = _ONEDPL_MERGE_CUT_OFF;
-    if (__n <= __merge_cut_off)
+    const ::std::size_t __merge_cut_off = __tbb_backend::__cut_off(__exec, _ONEDPL_MERGE_CUT_OFF);
+    if (__n <= static_cast<_SizeType>(__merge_cut_off))
     {
         // Fall back on serial merge
         __leaf_merge(__xs, __xe, __ys, __ye, __zs, __comp);
     }
     else
     {
-        tbb::this_task_arena::isolate([=]() {
+        __tbb_backend::__isolate_in_arena(__exec, [=]() {
             typedef __merge_func_static<_RandomAccessIterator1, _RandomAccessIterator2, _RandomAccessIterator3,
                                         _Compare, _LeafMerge>
                 _TaskType;
-            __root_task<_TaskType> __root{__xs, __xe, __ys, __ye, __zs, __comp, __leaf_merge};
+            __root_task<_TaskType> __root{__xs, __xe, __ys, __ye, __zs, __comp, __leaf_merge, __merge_cut_off};
             __task::spawn_root_and_wait(__root);
         });
     }
@@ -1287,11 +1478,31 @@ __parallel_merge(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPolicy&&,
 
 template <class _ExecutionPolicy, typename _F1, typename _F2>
 void
-__parallel_invoke(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPolicy&&, _F1&& __f1, _F2&& __f2)
+__parallel_invoke(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPolicy&& __exec, _F1&& __f1, _F2&& __f2)
 {
     //TODO: a version of tbb::this_task_arena::isolate with variadic arguments pack should be added in the future
-    tbb::this_task_arena::isolate(
-        [&]() { tbb::parallel_invoke(::std::forward<_F1>(__f1), ::std::forward<_F2>(__f2)); });
+    __tbb_backend::__isolate_in_arena(
+        __exec, [&]() { tbb::parallel_invoke(::std::forward<_F1>(__f1), ::std::forward<_F2>(__f2)); });
+}
+
+//------------------------------------------------------------------------
+// parallel_async
+//------------------------------------------------------------------------
+
+// Enqueues __f into the arena of the calling thread, which does not wait for it: the result is delivered
+// through the returned future
+template <class _ExecutionPolicy, typename _Fp>
+::std::future<::std::invoke_result_t<_Fp&>>
+__parallel_async(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPolicy&&, _Fp __f)
+{
+    auto __task = ::std::make_shared<::std::packaged_task<::std::invoke_result_t<_Fp&>()>>(::std::move(__f));
+    auto __future = __task->get_future();
+#if TBB_INTERFACE_VERSION > 12000
+    tbb::this_task_arena::enqueue([__task]() { (*__task)(); });
+#else
+    tbb::task_arena(tbb::task_arena::attach()).enqueue([__task]() { (*__task)(); });
+#endif
+    return __future;
 }
 
 //------------------------------------------------------------------------
@@ -1300,10 +1511,10 @@ __parallel_invoke(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPolicy&&
 
 template <class _ExecutionPolicy, class _ForwardIterator, class _Fp>
 void
-__parallel_for_each(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPolicy&&, _ForwardIterator __begin,
+__parallel_for_each(oneapi::dpl::__internal::__tbb_backend_tag, _ExecutionPolicy&& __exec, _ForwardIterator __begin,
                     _ForwardIterator __end, _Fp __f)
 {
-    tbb::this_task_arena::isolate([&]() { tbb::parallel_for_each(__begin, __end, __f); });
+    __tbb_backend::__isolate_in_arena(__exec, [&]() { tbb::parallel_for_each(__begin, __end, __f); });
 }
 
 } // namespace __tbb_backend
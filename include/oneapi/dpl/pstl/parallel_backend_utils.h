@@ -19,8 +19,18 @@
 #include <iterator>
 #include <utility>
 #include <cassert>
+#include <cstdlib>
+#include <type_traits>
 #include "utils.h"
 #include "memory_fwd.h"
+#include "scratch_memory_resource.h"
+
+#if __linux__ && __has_include(<unistd.h>)
+#    include <unistd.h>
+#    if defined(_SC_LEVEL3_CACHE_SIZE)
+#        define _ONEDPL_STREAMING_STORES_QUERY_CACHE 1
+#    endif
+#endif
 
 namespace oneapi
 {
@@ -30,13 +40,29 @@ namespace __utils
 {
 
 //------------------------------------------------------------------------
-// raw buffer (with specified _TAllocator)
+// raw buffer (from the scratch memory resource of the policy, or with specified _TAllocator)
 //------------------------------------------------------------------------
 
-template <typename _ExecutionPolicy, typename _Tp, template <typename _T> typename _TAllocator>
+// Page placement of a freshly obtained buffer: none, its pages land where the algorithm first writes to them
+struct __default_page_placement
+{
+    template <typename _ExecutionPolicy>
+    void
+    operator()(const _ExecutionPolicy&, void*, ::std::size_t) const
+    {
+    }
+};
+
+// Minimal size of a buffer whose pages are first touched in parallel
+constexpr ::std::size_t __first_touch_min_size = 1 << 20;
+constexpr ::std::size_t __first_touch_page_size = 4096;
+
+template <typename _ExecutionPolicy, typename _Tp, template <typename _T> typename _TAllocator,
+          typename _PagePlacement = __default_page_placement>
 class __buffer_impl
 {
     _TAllocator<_Tp> _M_allocator;
+    oneapi::dpl::scratch_memory_resource* _M_resource = nullptr;
     _Tp* _M_ptr = nullptr;
     const ::std::size_t _M_buf_size = 0;
 
@@ -44,11 +70,22 @@ class __buffer_impl
     void
     operator=(const __buffer_impl&) = delete;
 
+    _Tp*
+    __allocate(const ::std::size_t __n)
+    {
+        if (_M_resource)
+            return static_cast<_Tp*>(_M_resource->allocate(__n * sizeof(_Tp), alignof(_Tp)));
+        return _M_allocator.allocate(__n);
+    }
+
   public:
     //! Try to obtain buffer of given size to store objects of _Tp type
-    __buffer_impl(_ExecutionPolicy /*__exec*/, const ::std::size_t __n)
-        : _M_allocator(), _M_ptr(_M_allocator.allocate(__n)), _M_buf_size(__n)
+    __buffer_impl(_ExecutionPolicy __exec, const ::std::size_t __n)
+        : _M_allocator(), _M_resource(oneapi::dpl::__internal::__get_scratch_resource(__exec, __n * sizeof(_Tp))),
+          _M_ptr(__allocate(__n)), _M_buf_size(__n)
     {
+        if (_M_ptr)
+            _PagePlacement{}(__exec, _M_ptr, __n * sizeof(_Tp));
     }
     //! True if buffer was successfully obtained, zero otherwise.
     operator bool() const { return _M_ptr != nullptr; }
@@ -59,9 +96,118 @@ class __buffer_impl
         return _M_ptr;
     }
     //! Destroy buffer
-    ~__buffer_impl() { _M_allocator.deallocate(_M_ptr, _M_buf_size); }
+    ~__buffer_impl()
+    {
+        if (_M_resource)
+            _M_resource->deallocate(_M_ptr, _M_buf_size * sizeof(_Tp), alignof(_Tp));
+        else
+            _M_allocator.deallocate(_M_ptr, _M_buf_size);
+    }
+};
+
+//------------------------------------------------------------------------
+// serial cutoff
+//------------------------------------------------------------------------
+
+// Loops of the parallel backends, whose dispatch costs differ
+enum class __loop_kind
+{
+    __for,    // __parallel_for
+    __reduce, // __parallel_reduce, __parallel_transform_reduce
+    __scan    // __parallel_strict_scan, __parallel_transform_scan
 };
 
+// Size set by the environment variable __name, or __default if the variable is not set or not a number
+inline ::std::size_t
+__size_from_env(const char* __name, ::std::size_t __default)
+{
+    const char* __value = ::std::getenv(__name);
+    if (!__value || !*__value)
+        return __default;
+    char* __end = nullptr;
+    const unsigned long long __size = ::std::strtoull(__value, &__end, 10);
+    return *__end == '\0' ? static_cast<::std::size_t>(__size) : __default;
+}
+
+// Cutoff in bytes of a loop kind, the compile-time one unless overridden by the environment;
+// 0 disables running the loops on the calling thread
+inline ::std::size_t
+__serial_cutoff_bytes(__loop_kind __kind)
+{
+    static const ::std::size_t __cutoffs[] = {
+        __size_from_env("ONEDPL_SERIAL_CUTOFF_FOR", _ONEDPL_SERIAL_CUTOFF_FOR),
+        __size_from_env("ONEDPL_SERIAL_CUTOFF_REDUCE", _ONEDPL_SERIAL_CUTOFF_REDUCE),
+        __size_from_env("ONEDPL_SERIAL_CUTOFF_SCAN", _ONEDPL_SERIAL_CUTOFF_SCAN)};
+    return __cutoffs[static_cast<int>(__kind)];
+}
+
+// Size of an element of the sequence iterated over by an index: the value type of an iterator,
+// or the index itself for the loops over integers
+template <typename _Index>
+constexpr ::std::size_t
+__element_size()
+{
+    if constexpr (::std::is_integral_v<_Index>)
+        return sizeof(_Index);
+    else
+    {
+        using _ValueType = typename ::std::iterator_traits<_Index>::value_type;
+        if constexpr (::std::is_void_v<_ValueType>)
+            return 1;
+        else
+            return sizeof(_ValueType);
+    }
+}
+
+// Whether a loop over __n elements of __element_size bytes costs less run by the calling thread than dispatched
+// to the parallel backend: the data size, scaled by the cost hint of the policy, is below the cutoff of the loop
+template <__loop_kind _Kind, typename _ExecutionPolicy, typename _Size>
+bool
+__run_serial(const _ExecutionPolicy& __exec, _Size __n, ::std::size_t __element_size)
+{
+    const ::std::size_t __cost = oneapi::dpl::__internal::__get_host_policy_params(__exec).__cost_hint;
+    return static_cast<::std::size_t>(__n) < __serial_cutoff_bytes(_Kind) / __element_size / __cost;
+}
+
+//------------------------------------------------------------------------
+// streaming stores
+//------------------------------------------------------------------------
+
+// Size of the last level cache, or 32 MiB if it cannot be queried
+inline ::std::size_t
+__last_level_cache_size()
+{
+    static const ::std::size_t __size = []() -> ::std::size_t {
+#if _ONEDPL_STREAMING_STORES_QUERY_CACHE
+        const long __bytes = ::sysconf(_SC_LEVEL3_CACHE_SIZE);
+        if (__bytes > 0)
+            return static_cast<::std::size_t>(__bytes);
+#endif
+        return ::std::size_t(32) << 20;
+    }();
+    return __size;
+}
+
+// Whether the stores to a destination of __bytes bytes bypass the caches: as forced or disabled by the policy, or,
+// if enabled by ONEDPL_STREAMING_STORES, for the destinations from the threshold on. The threshold set by
+// the environment variable ONEDPL_STREAMING_STORES_THRESHOLD overrides the compile-time one.
+template <typename _ExecutionPolicy>
+bool
+__use_streaming_stores(const _ExecutionPolicy& __exec, ::std::size_t __bytes)
+{
+    using oneapi::dpl::execution::streaming_stores;
+
+    const streaming_stores __mode = oneapi::dpl::__internal::__get_host_policy_params(__exec).__streaming_stores;
+    if (__mode != streaming_stores::default_)
+        return __mode == streaming_stores::enabled;
+    if (!_ONEDPL_STREAMING_STORES)
+        return false;
+
+    static const ::std::size_t __threshold =
+        __size_from_env("ONEDPL_STREAMING_STORES_THRESHOLD", _ONEDPL_STREAMING_STORES_THRESHOLD);
+    return __bytes >= (__threshold ? __threshold : __last_level_cache_size());
+}
+
 //! Destroy sequence [xs,xe)
 struct __serial_destroy
 {
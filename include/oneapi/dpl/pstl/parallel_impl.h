@@ -17,6 +17,8 @@
 #define _ONEDPL_PARALLEL_IMPL_H
 
 #include <atomic>
+#include <algorithm>
+#include <type_traits>
 // This header defines the minimum set of parallel routines required to support Parallel STL,
 // implemented on top of Intel(R) Threading Building Blocks (Intel(R) TBB) library
 
@@ -30,8 +32,30 @@ namespace __internal
 //------------------------------------------------------------------------
 // parallel_find
 //-----------------------------------------------------------------------
+
+// Minimal number of elements of a block searched by a worker of __parallel_find
+constexpr ::std::size_t __find_min_block_size = 1024;
+
+// Policy running one task per index of a short range of worker indices, spread evenly over the threads;
+// each index stands for a lot of work, so the range is never run by the calling thread alone
+template <class _ExecutionPolicy>
+decltype(auto)
+__policy_per_worker(_ExecutionPolicy&& __exec)
+{
+    using _Policy = ::std::decay_t<_ExecutionPolicy>;
+    if constexpr (::std::is_base_of_v<oneapi::dpl::execution::__host_policy_tuning<_Policy>, _Policy>)
+        return __exec.with(oneapi::dpl::execution::grainsize(1), oneapi::dpl::execution::partitioner::static_,
+                           oneapi::dpl::execution::cost_hint(::std::size_t(-1)));
+    else
+        return ::std::forward<_ExecutionPolicy>(__exec);
+}
+
 /** Return extremum value returned by brick f[i,j) for subranges [i,j) of [first,last)
-Each f[i,j) must return a value in [i,j). */
+Each f[i,j) must return a value in [i,j).
+The workers claim blocks from a shared counter in the order of the search: from the front for the first extremum,
+from the back for the last one. A worker stops at the first block which cannot improve on the extremum found so far.
+The block size grows with the distance searched, so the work done is proportional to the distance of the result
+rather than to the size of the range. */
 template <class _IsVector, class _ExecutionPolicy, class _Index, class _Brick, class _IsFirst>
 _Index
 __parallel_find(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec, _Index __first, _Index __last, _Brick __f,
@@ -45,27 +69,62 @@ __parallel_find(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec, _Index __f
 
     constexpr auto __comp = ::std::conditional_t<_IsFirst::value, __pstl_less, __pstl_greater>{};
 
+    const _DifferenceType __min_block = ::std::max<_DifferenceType>(
+        __find_min_block_size, oneapi::dpl::__internal::__get_host_policy_params(__exec).__grainsize);
+    if (__n <= __min_block)
+        return __f(__first, __last);
+
+    // Enough workers to occupy every thread of the arena the search runs in; the surplus ones find no blocks left
+    const _DifferenceType __n_workers =
+        ::std::max<_DifferenceType>(1, __par_backend::__max_concurrency(__backend_tag{}, __exec));
+    // The last blocks are kept small enough to balance the load
+    const _DifferenceType __max_block = ::std::max<_DifferenceType>(__min_block, __n / (8 * __n_workers));
+
     ::std::atomic<_DifferenceType> __extremum(__initial_dist);
-    // TODO: find out what is better here: parallel_for or parallel_reduce
-    __par_backend::__parallel_for(__backend_tag{}, ::std::forward<_ExecutionPolicy>(__exec), __first, __last,
-                                  [__comp, __f, __first, &__extremum](_Index __i, _Index __j) {
-                                      // See "Reducing Contention Through Priority Updates", PPoPP '13, for discussion of
-                                      // why using a shared variable scales fairly well in this situation.
-                                      if (__comp(__i - __first, __extremum))
-                                      {
-                                          _Index __res = __f(__i, __j);
-                                          // If not '__last' returned then we found what we want so put this to extremum
-                                          if (__res != __j)
-                                          {
-                                              const _DifferenceType __k = __res - __first;
-                                              for (_DifferenceType __old = __extremum; __comp(__k, __old);
-                                                   __old = __extremum)
-                                              {
-                                                  __extremum.compare_exchange_weak(__old, __k);
-                                              }
-                                          }
-                                      }
-                                  });
+    // Distance from the start of the search to the next unclaimed block
+    ::std::atomic<_DifferenceType> __next(0);
+
+    auto __search = [&]() {
+        _DifferenceType __begin = __next.load(::std::memory_order_relaxed);
+        for (;;)
+        {
+            _DifferenceType __end;
+            do
+            {
+                if (__begin >= __n)
+                    return;
+                const _DifferenceType __size =
+                    ::std::min(::std::max(__begin / __n_workers, __min_block), __max_block);
+                __end = __begin + ::std::min(__size, __n - __begin);
+            } while (!__next.compare_exchange_weak(__begin, __end, ::std::memory_order_relaxed));
+
+            // The blocks are claimed in the order of the search, so once a block cannot improve on the extremum,
+            // neither can the following ones
+            const _DifferenceType __nearest = _IsFirst::value ? __begin : __n - 1 - __begin;
+            if (!__comp(__nearest, __extremum.load(::std::memory_order_relaxed)))
+                return;
+
+            const _Index __i = _IsFirst::value ? __first + __begin : __last - __end;
+            const _Index __j = _IsFirst::value ? __first + __end : __last - __begin;
+            _Index __res = __f(__i, __j);
+            // If not '__j' returned then we found what we want so put this to extremum
+            if (__res != __j)
+            {
+                // See "Reducing Contention Through Priority Updates", PPoPP '13, for discussion of
+                // why using a shared variable scales fairly well in this situation.
+                const _DifferenceType __k = __res - __first;
+                for (_DifferenceType __old = __extremum; __comp(__k, __old); __old = __extremum)
+                {
+                    __extremum.compare_exchange_weak(__old, __k);
+                }
+            }
+            __begin = __next.load(::std::memory_order_relaxed);
+        }
+    };
+    __par_backend::__parallel_for(__backend_tag{},
+                                  __internal::__policy_per_worker(::std::forward<_ExecutionPolicy>(__exec)),
+                                  _DifferenceType(0), __n_workers,
+                                  [&__search](_DifferenceType, _DifferenceType) { __search(); });
     return __extremum != __initial_dist ? __first + __extremum : __last;
 }
 
@@ -73,6 +132,8 @@ __parallel_find(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec, _Index __f
 // parallel_or
 //------------------------------------------------------------------------
 //! Return true if brick f[i,j) returns true for some subrange [i,j) of [first,last)
+// A brick called with the whole range has no other chunks to cancel: the loop may be run by the calling thread below
+// the serial cutoff, within a chunk of an enclosing loop, which the cancellation would then target instead.
 template <class _IsVector, class _ExecutionPolicy, class _Index, class _Brick>
 bool
 __parallel_or(__parallel_tag<_IsVector> __tag, _ExecutionPolicy&& __exec, _Index __first, _Index __last, _Brick __f)
@@ -81,11 +142,12 @@ __parallel_or(__parallel_tag<_IsVector> __tag, _ExecutionPolicy&& __exec, _Index
 
     ::std::atomic<bool> __found(false);
     __par_backend::__parallel_for(__backend_tag{}, ::std::forward<_ExecutionPolicy>(__exec), __first, __last,
-                                  [__f, &__found](_Index __i, _Index __j) {
+                                  [__f, &__found, __first, __last](_Index __i, _Index __j) {
                                       if (!__found.load(::std::memory_order_relaxed) && __f(__i, __j))
                                       {
                                           __found.store(true, ::std::memory_order_relaxed);
-                                          __par_backend::__cancel_execution(__backend_tag{});
+                                          if (__i != __first || __j != __last)
+                                              __par_backend::__cancel_execution(__backend_tag{});
                                       }
                                   });
     return __found;
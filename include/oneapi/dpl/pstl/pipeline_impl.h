@@ -0,0 +1,593 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_PIPELINE_IMPL_H
+#define _ONEDPL_PIPELINE_IMPL_H
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "algorithm_fwd.h"
+#include "numeric_fwd.h"
+#include "execution_impl.h"
+#include "parallel_backend.h"
+#include "utils.h"
+
+namespace oneapi
+{
+namespace dpl
+{
+namespace __internal
+{
+
+//------------------------------------------------------------------------
+// element-wise stages of a pipeline
+//------------------------------------------------------------------------
+
+// The stages of a pipeline are fused into a single callable over an input element. __apply computes the value of
+// each transform once, tests each filter on the value of the transforms preceding it, and passes the value of the
+// last stage to a continuation when the element passes the filters. __test only tells whether the element passes
+// the filters, without computing the transforms following the last filter. Without filters, the stages are also
+// a unary operation giving the value of the element.
+struct __pipeline_source
+{
+    static constexpr bool __is_filtered = false;
+
+    template <typename _Tp>
+    using __result_t = _Tp;
+
+    template <typename _Tp, typename _Continuation>
+    void
+    __apply(_Tp&& __x, _Continuation&& __k) const
+    {
+        __k(::std::forward<_Tp>(__x));
+    }
+
+    template <typename _Tp>
+    constexpr bool
+    __test(const _Tp&) const
+    {
+        return true;
+    }
+
+    template <typename _Tp>
+    _Tp&&
+    operator()(_Tp&& __x) const
+    {
+        return ::std::forward<_Tp>(__x);
+    }
+};
+
+template <typename _Stages, typename _Function>
+class __pipeline_transform
+{
+    _Stages _M_stages;
+    mutable _Function _M_f;
+
+  public:
+    static constexpr bool __is_filtered = _Stages::__is_filtered;
+
+    template <typename _Tp>
+    using __result_t = ::std::invoke_result_t<_Function&, typename _Stages::template __result_t<_Tp>>;
+
+    __pipeline_transform(_Stages __stages, _Function __f) : _M_stages(::std::move(__stages)), _M_f(::std::move(__f))
+    {
+    }
+
+    template <typename _Tp, typename _Continuation>
+    void
+    __apply(_Tp&& __x, _Continuation&& __k) const
+    {
+        _M_stages.__apply(::std::forward<_Tp>(__x),
+                          [this, &__k](auto&& __v) { __k(_M_f(::std::forward<decltype(__v)>(__v))); });
+    }
+
+    template <typename _Tp>
+    bool
+    __test(const _Tp& __x) const
+    {
+        return _M_stages.__test(__x);
+    }
+
+    template <typename _Tp>
+    decltype(auto)
+    operator()(_Tp&& __x) const
+    {
+        return _M_f(_M_stages(::std::forward<_Tp>(__x)));
+    }
+};
+
+template <typename _Stages, typename _Predicate>
+class __pipeline_filter
+{
+    _Stages _M_stages;
+    mutable _Predicate _M_pred;
+
+  public:
+    static constexpr bool __is_filtered = true;
+
+    template <typename _Tp>
+    using __result_t = typename _Stages::template __result_t<_Tp>;
+
+    __pipeline_filter(_Stages __stages, _Predicate __pred)
+        : _M_stages(::std::move(__stages)), _M_pred(::std::move(__pred))
+    {
+    }
+
+    template <typename _Tp, typename _Continuation>
+    void
+    __apply(_Tp&& __x, _Continuation&& __k) const
+    {
+        _M_stages.__apply(::std::forward<_Tp>(__x), [this, &__k](auto&& __v) {
+            if (_M_pred(__v))
+                __k(::std::forward<decltype(__v)>(__v));
+        });
+    }
+
+    template <typename _Tp>
+    bool
+    __test(const _Tp& __x) const
+    {
+        bool __passed = false;
+        _M_stages.__apply(__x, [this, &__passed](const auto& __v) { __passed = _M_pred(__v); });
+        return __passed;
+    }
+};
+
+// The elements rejected by the filters have no value to contribute, and the operation has no known identity:
+// a partial sum stays empty until it meets an element passing the filters.
+template <typename _Tp, typename _BinaryOperation, typename _Up>
+void
+__pipeline_accumulate(::std::optional<_Tp>& __partial, _BinaryOperation& __binary_op, _Up&& __v)
+{
+    if (__partial)
+        *__partial = __binary_op(*__partial, ::std::forward<_Up>(__v));
+    else
+        __partial.emplace(::std::forward<_Up>(__v));
+}
+
+template <typename _Tp, typename _BinaryOperation>
+::std::optional<_Tp>
+__pipeline_combine(const ::std::optional<_Tp>& __x, const ::std::optional<_Tp>& __y, _BinaryOperation& __binary_op)
+{
+    if (!__x)
+        return __y;
+    if (!__y)
+        return __x;
+    return _Tp(__binary_op(*__x, *__y));
+}
+
+//------------------------------------------------------------------------
+// reduce
+//------------------------------------------------------------------------
+
+template <class _RandomAccessIterator, class _Stages, class _Tp, class _BinaryOperation>
+::std::optional<_Tp>
+__brick_pipeline_reduce(_RandomAccessIterator __first, _RandomAccessIterator __last, const _Stages& __stages,
+                        ::std::optional<_Tp> __partial, _BinaryOperation __binary_op) noexcept
+{
+    for (; __first != __last; ++__first)
+        __stages.__apply(*__first, [&__partial, &__binary_op](auto&& __v) {
+            __internal::__pipeline_accumulate(__partial, __binary_op, ::std::forward<decltype(__v)>(__v));
+        });
+    return __partial;
+}
+
+template <class _Tag, class _ExecutionPolicy, class _RandomAccessIterator, class _Stages, class _Tp,
+          class _BinaryOperation>
+_Tp
+__pipeline_filtered_reduce(_Tag, _ExecutionPolicy&&, _RandomAccessIterator __first, _RandomAccessIterator __last,
+                           _Stages __stages, _Tp __init, _BinaryOperation __binary_op) noexcept
+{
+    static_assert(__is_serial_tag_v<_Tag>);
+
+    return *__internal::__brick_pipeline_reduce(__first, __last, __stages, ::std::optional<_Tp>(__init), __binary_op);
+}
+
+template <class _IsVector, class _ExecutionPolicy, class _RandomAccessIterator, class _Stages, class _Tp,
+          class _BinaryOperation>
+_Tp
+__pipeline_filtered_reduce(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec, _RandomAccessIterator __first,
+                           _RandomAccessIterator __last, _Stages __stages, _Tp __init, _BinaryOperation __binary_op)
+{
+    using __backend_tag = typename __parallel_tag<_IsVector>::__backend_tag;
+    using _Partial = ::std::optional<_Tp>;
+
+    return __internal::__except_handler([&]() {
+        const _Partial __sum = __par_backend::__parallel_transform_reduce(
+            __backend_tag{}, ::std::forward<_ExecutionPolicy>(__exec), __first, __last,
+            [__stages](_RandomAccessIterator __i) -> _Partial {
+                _Partial __partial;
+                __stages.__apply(*__i,
+                                 [&__partial](auto&& __v) { __partial.emplace(::std::forward<decltype(__v)>(__v)); });
+                return __partial;
+            },
+            _Partial{},
+            [__binary_op](const _Partial& __x, const _Partial& __y) {
+                return __internal::__pipeline_combine(__x, __y, __binary_op);
+            },
+            [__stages, __binary_op](_RandomAccessIterator __i, _RandomAccessIterator __j, _Partial __partial) {
+                return __internal::__brick_pipeline_reduce(__i, __j, __stages, __partial, __binary_op);
+            });
+        return __sum ? _Tp(__binary_op(__init, *__sum)) : __init;
+    });
+}
+
+template <class _Tag, class _ExecutionPolicy, class _RandomAccessIterator, class _Stages, class _Tp,
+          class _BinaryOperation>
+_Tp
+__pattern_pipeline_reduce(_Tag __tag, _ExecutionPolicy&& __exec, _RandomAccessIterator __first,
+                          _RandomAccessIterator __last, _Stages __stages, _Tp __init, _BinaryOperation __binary_op)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    // Without filters, the transforms are the unary operation of the vectorized transform_reduce brick
+    if constexpr (!_Stages::__is_filtered)
+        return __internal::__pattern_transform_reduce(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first, __last,
+                                                      __init, __binary_op, __stages);
+    else
+        return __internal::__pipeline_filtered_reduce(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first,
+                                                      __last, __stages, __init, __binary_op);
+}
+
+//------------------------------------------------------------------------
+// copy
+//------------------------------------------------------------------------
+
+template <class _RandomAccessIterator1, class _RandomAccessIterator2, class _Stages>
+_RandomAccessIterator2
+__brick_pipeline_copy(_RandomAccessIterator1 __first, _RandomAccessIterator1 __last, _RandomAccessIterator2 __result,
+                      const _Stages& __stages) noexcept
+{
+    for (; __first != __last; ++__first)
+        __stages.__apply(*__first, [&__result](auto&& __v) {
+            *__result = ::std::forward<decltype(__v)>(__v);
+            ++__result;
+        });
+    return __result;
+}
+
+template <class _Tag, class _ExecutionPolicy, class _RandomAccessIterator1, class _RandomAccessIterator2,
+          class _Stages>
+_RandomAccessIterator2
+__pipeline_filtered_copy(_Tag, _ExecutionPolicy&&, _RandomAccessIterator1 __first, _RandomAccessIterator1 __last,
+                         _RandomAccessIterator2 __result, _Stages __stages) noexcept
+{
+    static_assert(__is_serial_tag_v<_Tag>);
+
+    return __internal::__brick_pipeline_copy(__first, __last, __result, __stages);
+}
+
+// The compaction of copy_if: the reduction counts the elements passing the filters, up to the last filter, and the
+// scan writes the values of the elements passing them from the offset of its subrange, without a mask buffer.
+template <class _IsVector, class _ExecutionPolicy, class _RandomAccessIterator1, class _RandomAccessIterator2,
+          class _Stages>
+_RandomAccessIterator2
+__pipeline_filtered_copy(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec, _RandomAccessIterator1 __first,
+                         _RandomAccessIterator1 __last, _RandomAccessIterator2 __result, _Stages __stages)
+{
+    using __backend_tag = typename __parallel_tag<_IsVector>::__backend_tag;
+
+    typedef typename ::std::iterator_traits<_RandomAccessIterator1>::difference_type _DifferenceType;
+    const _DifferenceType __n = __last - __first;
+    if (__n < 2)
+        return __internal::__brick_pipeline_copy(__first, __last, __result, __stages);
+
+    return __internal::__except_handler([&__exec, __n, __first, __result, __stages]() {
+        _DifferenceType __m{};
+        __par_backend::__parallel_strict_scan(
+            __backend_tag{}, ::std::forward<_ExecutionPolicy>(__exec), __n, _DifferenceType(0),
+            [=](_DifferenceType __i, _DifferenceType __len) { // Reduce
+                return _DifferenceType(::std::count_if(__first + __i, __first + (__i + __len),
+                                                       [&__stages](const auto& __x) { return __stages.__test(__x); }));
+            },
+            ::std::plus<_DifferenceType>(),                                              // Combine
+            [=](_DifferenceType __i, _DifferenceType __len, _DifferenceType __initial) { // Scan
+                __internal::__brick_pipeline_copy(__first + __i, __first + (__i + __len), __result + __initial,
+                                                  __stages);
+            },
+            [&__m](_DifferenceType __total) { __m = __total; });
+        return __result + __m;
+    });
+}
+
+template <class _Tag, class _ExecutionPolicy, class _RandomAccessIterator1, class _RandomAccessIterator2,
+          class _Stages>
+_RandomAccessIterator2
+__pattern_pipeline_copy(_Tag __tag, _ExecutionPolicy&& __exec, _RandomAccessIterator1 __first,
+                        _RandomAccessIterator1 __last, _RandomAccessIterator2 __result, _Stages __stages)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    if constexpr (!_Stages::__is_filtered)
+        return __internal::__pattern_walk2(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first, __last, __result,
+                                           oneapi::dpl::__internal::__transform_functor<_Stages>(__stages));
+    else
+        return __internal::__pipeline_filtered_copy(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first, __last,
+                                                     __result, __stages);
+}
+
+//------------------------------------------------------------------------
+// scan
+//------------------------------------------------------------------------
+
+// Writes the scan of the values passing the filters, from the sum of the values preceding them, which is empty
+// for an inclusive scan without an initial value until the first value passing the filters. Returns the end of
+// the output and the sum of the values.
+template <class _RandomAccessIterator1, class _RandomAccessIterator2, class _Stages, class _Tp,
+          class _BinaryOperation, class _Inclusive>
+::std::pair<_RandomAccessIterator2, ::std::optional<_Tp>>
+__brick_pipeline_scan(_RandomAccessIterator1 __first, _RandomAccessIterator1 __last, _RandomAccessIterator2 __result,
+                      const _Stages& __stages, ::std::optional<_Tp> __sum, _BinaryOperation __binary_op,
+                      _Inclusive) noexcept
+{
+    for (; __first != __last; ++__first)
+        __stages.__apply(*__first, [&__result, &__sum, &__binary_op](auto&& __v) {
+            if constexpr (_Inclusive::value)
+            {
+                __internal::__pipeline_accumulate(__sum, __binary_op, ::std::forward<decltype(__v)>(__v));
+                *__result = *__sum;
+            }
+            else
+            {
+                *__result = *__sum;
+                *__sum = __binary_op(*__sum, ::std::forward<decltype(__v)>(__v));
+            }
+            ++__result;
+        });
+    return ::std::make_pair(__result, ::std::move(__sum));
+}
+
+template <class _Tag, class _ExecutionPolicy, class _RandomAccessIterator1, class _RandomAccessIterator2,
+          class _Stages, class _Tp, class _BinaryOperation, class _Inclusive>
+_RandomAccessIterator2
+__pipeline_filtered_scan(_Tag, _ExecutionPolicy&&, _RandomAccessIterator1 __first, _RandomAccessIterator1 __last,
+                         _RandomAccessIterator2 __result, _Stages __stages, ::std::optional<_Tp> __init,
+                         _BinaryOperation __binary_op, _Inclusive) noexcept
+{
+    static_assert(__is_serial_tag_v<_Tag>);
+
+    return __internal::__brick_pipeline_scan(__first, __last, __result, __stages, __init, __binary_op, _Inclusive())
+        .first;
+}
+
+// The compaction is fused with the scan: the partial sum of a subrange is the number of its elements passing the
+// filters and the sum of their values, so that the scan writes the values of a subrange from its offset in the
+// output, starting from the sum of the preceding values. An inclusive scan without an initial value is seeded by
+// the first value passing the filters, wherever its subrange is. The values may be of any copyable type, so the
+// partial sums go through __parallel_transform_scan.
+template <class _IsVector, class _ExecutionPolicy, class _RandomAccessIterator1, class _RandomAccessIterator2,
+          class _Stages, class _Tp, class _BinaryOperation, class _Inclusive>
+_RandomAccessIterator2
+__pipeline_filtered_scan(__parallel_tag<_IsVector>, _ExecutionPolicy&& __exec, _RandomAccessIterator1 __first,
+                         _RandomAccessIterator1 __last, _RandomAccessIterator2 __result, _Stages __stages,
+                         ::std::optional<_Tp> __init, _BinaryOperation __binary_op, _Inclusive)
+{
+    using __backend_tag = typename __parallel_tag<_IsVector>::__backend_tag;
+
+    typedef typename ::std::iterator_traits<_RandomAccessIterator1>::difference_type _DifferenceType;
+    using _Partial = ::std::pair<_DifferenceType, ::std::optional<_Tp>>;
+
+    const _DifferenceType __n = __last - __first;
+    if (__n < 2)
+        return __internal::__brick_pipeline_scan(__first, __last, __result, __stages, __init, __binary_op,
+                                                 _Inclusive())
+            .first;
+
+    return __internal::__except_handler([&]() {
+        const _Partial __total = __par_backend::__parallel_transform_scan(
+            __backend_tag{}, ::std::forward<_ExecutionPolicy>(__exec), __n,
+            [__first, __stages](_DifferenceType __i) {
+                _Partial __partial(0, ::std::nullopt);
+                __stages.__apply(__first[__i], [&__partial](auto&& __v) {
+                    __partial.first = 1;
+                    __partial.second.emplace(::std::forward<decltype(__v)>(__v));
+                });
+                return __partial;
+            },
+            _Partial(0, __init),
+            [__binary_op](const _Partial& __x, const _Partial& __y) { // Combine
+                return _Partial(__x.first + __y.first,
+                                __internal::__pipeline_combine(__x.second, __y.second, __binary_op));
+            },
+            [__first, __stages, __binary_op](_DifferenceType __i, _DifferenceType __j, _Partial __partial) { // Reduce
+                ::std::for_each(__first + __i, __first + __j, [&](const auto& __x) {
+                    __stages.__apply(__x, [&](auto&& __v) {
+                        ++__partial.first;
+                        __internal::__pipeline_accumulate(__partial.second, __binary_op,
+                                                          ::std::forward<decltype(__v)>(__v));
+                    });
+                });
+                return __partial;
+            },
+            [__first, __result, __stages, __binary_op](_DifferenceType __i, _DifferenceType __j,
+                                                       _Partial __initial) { // Scan
+                auto [__end, __sum] =
+                    __internal::__brick_pipeline_scan(__first + __i, __first + __j, __result + __initial.first,
+                                                      __stages, ::std::move(__initial.second), __binary_op,
+                                                      _Inclusive());
+                return _Partial(__end - __result, ::std::move(__sum));
+            });
+        return __result + __total.first;
+    });
+}
+
+// Without filters, the transforms are the unary operation of transform_scan, and an inclusive scan without an
+// initial value is seeded by the value of the first element.
+template <class _Tag, class _ExecutionPolicy, class _RandomAccessIterator1, class _RandomAccessIterator2,
+          class _Stages, class _Tp, class _BinaryOperation, class _Inclusive>
+_RandomAccessIterator2
+__pattern_pipeline_scan(_Tag __tag, _ExecutionPolicy&& __exec, _RandomAccessIterator1 __first,
+                        _RandomAccessIterator1 __last, _RandomAccessIterator2 __result, _Stages __stages,
+                        ::std::optional<_Tp> __init, _BinaryOperation __binary_op, _Inclusive)
+{
+    static_assert(__is_host_dispatch_tag_v<_Tag>);
+
+    if constexpr (_Stages::__is_filtered)
+        return __internal::__pipeline_filtered_scan(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first, __last,
+                                                     __result, __stages, __init, __binary_op, _Inclusive());
+    else
+    {
+        if (!__init)
+        {
+            if (__first == __last)
+                return __result;
+            *__result = __init.emplace(__stages(*__first));
+            ++__first;
+            ++__result;
+        }
+        return __internal::__pattern_transform_scan(__tag, ::std::forward<_ExecutionPolicy>(__exec), __first, __last,
+                                                    __result, __stages, *__init, __binary_op, _Inclusive());
+    }
+}
+
+//------------------------------------------------------------------------
+// pipeline
+//------------------------------------------------------------------------
+
+template <typename _ExecutionPolicy, typename _RandomAccessIterator, typename _Stages>
+class __pipeline
+{
+    using __value_type = ::std::decay_t<
+        typename _Stages::template __result_t<typename ::std::iterator_traits<_RandomAccessIterator>::reference>>;
+
+    _ExecutionPolicy _M_exec;
+    _RandomAccessIterator _M_first;
+    _RandomAccessIterator _M_last;
+    _Stages _M_stages;
+
+  public:
+    __pipeline(_ExecutionPolicy __exec, _RandomAccessIterator __first, _RandomAccessIterator __last, _Stages __stages)
+        : _M_exec(::std::move(__exec)), _M_first(__first), _M_last(__last), _M_stages(::std::move(__stages))
+    {
+    }
+
+    // Element-wise stages
+
+    template <typename _Function>
+    __pipeline<_ExecutionPolicy, _RandomAccessIterator, __pipeline_transform<_Stages, _Function>>
+    transform(_Function __f) const
+    {
+        return {_M_exec, _M_first, _M_last, __pipeline_transform<_Stages, _Function>(_M_stages, ::std::move(__f))};
+    }
+
+    template <typename _Predicate>
+    __pipeline<_ExecutionPolicy, _RandomAccessIterator, __pipeline_filter<_Stages, _Predicate>>
+    filter(_Predicate __pred) const
+    {
+        return {_M_exec, _M_first, _M_last, __pipeline_filter<_Stages, _Predicate>(_M_stages, ::std::move(__pred))};
+    }
+
+    // Terminal algorithms
+
+    template <typename _Tp, typename _BinaryOperation>
+    _Tp
+    reduce(_Tp __init, _BinaryOperation __binary_op) const
+    {
+        const auto __dispatch_tag = oneapi::dpl::__internal::__select_backend(_M_exec, _M_first);
+
+        return oneapi::dpl::__internal::__pattern_pipeline_reduce(__dispatch_tag, _M_exec, _M_first, _M_last,
+                                                                  _M_stages, __init, __binary_op);
+    }
+
+    template <typename _Tp>
+    _Tp
+    reduce(_Tp __init) const
+    {
+        return reduce(__init, ::std::plus<_Tp>());
+    }
+
+    __value_type
+    reduce() const
+    {
+        return reduce(__value_type{}, ::std::plus<__value_type>());
+    }
+
+    template <typename _OutputIterator>
+    _OutputIterator
+    copy(_OutputIterator __result) const
+    {
+        const auto __dispatch_tag = oneapi::dpl::__internal::__select_backend(_M_exec, _M_first, __result);
+
+        return oneapi::dpl::__internal::__pattern_pipeline_copy(__dispatch_tag, _M_exec, _M_first, _M_last, __result,
+                                                                _M_stages);
+    }
+
+    template <typename _OutputIterator, typename _BinaryOperation>
+    _OutputIterator
+    inclusive_scan(_OutputIterator __result, _BinaryOperation __binary_op) const
+    {
+        const auto __dispatch_tag = oneapi::dpl::__internal::__select_backend(_M_exec, _M_first, __result);
+
+        return oneapi::dpl::__internal::__pattern_pipeline_scan(__dispatch_tag, _M_exec, _M_first, _M_last, __result,
+                                                                _M_stages, ::std::optional<__value_type>(),
+                                                                __binary_op, /*inclusive=*/::std::true_type());
+    }
+
+    template <typename _OutputIterator>
+    _OutputIterator
+    inclusive_scan(_OutputIterator __result) const
+    {
+        return inclusive_scan(__result, ::std::plus<__value_type>());
+    }
+
+    template <typename _OutputIterator, typename _Tp, typename _BinaryOperation>
+    _OutputIterator
+    exclusive_scan(_OutputIterator __result, _Tp __init, _BinaryOperation __binary_op) const
+    {
+        const auto __dispatch_tag = oneapi::dpl::__internal::__select_backend(_M_exec, _M_first, __result);
+
+        return oneapi::dpl::__internal::__pattern_pipeline_scan(__dispatch_tag, _M_exec, _M_first, _M_last, __result,
+                                                                _M_stages, ::std::optional<_Tp>(__init), __binary_op,
+                                                                /*inclusive=*/::std::false_type());
+    }
+
+    template <typename _OutputIterator, typename _Tp>
+    _OutputIterator
+    exclusive_scan(_OutputIterator __result, _Tp __init) const
+    {
+        return exclusive_scan(__result, __init, ::std::plus<_Tp>());
+    }
+};
+
+} // namespace __internal
+
+namespace experimental
+{
+
+// A pipeline fuses its element-wise stages, transform and filter, into the brick of its terminal algorithm,
+// so that the input is traversed once, and no intermediate sequence is stored.
+template <typename _ExecutionPolicy, typename _RandomAccessIterator>
+oneapi::dpl::__internal::__pipeline<::std::decay_t<_ExecutionPolicy>, _RandomAccessIterator,
+                                    oneapi::dpl::__internal::__pipeline_source>
+pipeline(_ExecutionPolicy&& __exec, _RandomAccessIterator __first, _RandomAccessIterator __last)
+{
+    static_assert(oneapi::dpl::__internal::__is_host_execution_policy<::std::decay_t<_ExecutionPolicy>>::value,
+                  "A pipeline supports the host execution policies only");
+    static_assert(oneapi::dpl::__internal::__is_random_access_iterator_v<_RandomAccessIterator>,
+                  "A pipeline requires random access iterators");
+
+    return {::std::forward<_ExecutionPolicy>(__exec), __first, __last, oneapi::dpl::__internal::__pipeline_source()};
+}
+
+} // namespace experimental
+} // namespace dpl
+} // namespace oneapi
+
+#endif // _ONEDPL_PIPELINE_IMPL_H
@@ -21,19 +21,53 @@
 
 #if _ONEDPL_BACKEND_SYCL
 #    include "hetero/dpcpp/utils_ranges_sycl.h"
+#else
+#    include "utils_ranges.h"
 #endif
 
 namespace oneapi
 {
 namespace dpl
 {
+#if !_ONEDPL_BACKEND_SYCL
+namespace __ranges
+{
+
+// Without SYCL there are no buffers to wrap: a container is referred to by a view, and the other ranges are passed
+// to the host patterns as is
+struct all_host_view_fn
+{
+    template <typename _R>
+    decltype(auto)
+    operator()(_R&& __r) const
+    {
+        if constexpr (::std::is_invocable_v<decltype(__nanorange::nano::views::all), _R>)
+            return __nanorange::nano::views::all(::std::forward<_R>(__r));
+        else
+            return ::std::forward<_R>(__r);
+    }
+};
+
+namespace views
+{
+inline constexpr all_host_view_fn all;
+inline constexpr all_host_view_fn all_read;
+inline constexpr all_host_view_fn all_write;
+inline constexpr all_host_view_fn host_all;
+} // namespace views
+
+} // namespace __ranges
+#endif // !_ONEDPL_BACKEND_SYCL
+
 namespace experimental
 {
 namespace ranges
 {
 
 //custom views
+#if _ONEDPL_BACKEND_SYCL
 using oneapi::dpl::__ranges::all_view;
+#endif
 using oneapi::dpl::__ranges::guard_view;
 using oneapi::dpl::__ranges::zip_view;
 
@@ -0,0 +1,353 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_SCRATCH_MEMORY_RESOURCE_H
+#define _ONEDPL_SCRATCH_MEMORY_RESOURCE_H
+
+#include "onedpl_config.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
+
+#if _ONEDPL_HUGE_PAGES_AVAILABLE
+#    include <sys/mman.h>
+#endif
+
+#include "execution_defs.h"
+
+namespace oneapi
+{
+namespace dpl
+{
+
+// Extension: source of the temporary memory of the parallel host algorithms.
+// The interface mirrors std::pmr::memory_resource, so adapting a polymorphic memory resource takes a few lines.
+class scratch_memory_resource
+{
+  public:
+    virtual ~scratch_memory_resource() = default;
+
+    void*
+    allocate(::std::size_t __bytes, ::std::size_t __alignment = alignof(::std::max_align_t))
+    {
+        return do_allocate(__bytes, __alignment);
+    }
+
+    void
+    deallocate(void* __p, ::std::size_t __bytes, ::std::size_t __alignment = alignof(::std::max_align_t))
+    {
+        do_deallocate(__p, __bytes, __alignment);
+    }
+
+  private:
+    virtual void*
+    do_allocate(::std::size_t __bytes, ::std::size_t __alignment) = 0;
+    virtual void
+    do_deallocate(void* __p, ::std::size_t __bytes, ::std::size_t __alignment) = 0;
+};
+
+namespace __internal
+{
+
+// Aligned global operator new and delete
+class __new_delete_scratch_resource final : public oneapi::dpl::scratch_memory_resource
+{
+    void*
+    do_allocate(::std::size_t __bytes, ::std::size_t __alignment) override
+    {
+        return ::operator new(__bytes, ::std::align_val_t(__alignment));
+    }
+    void
+    do_deallocate(void* __p, ::std::size_t __bytes, ::std::size_t __alignment) override
+    {
+        ::operator delete(__p, __bytes, ::std::align_val_t(__alignment));
+    }
+};
+
+inline oneapi::dpl::scratch_memory_resource*
+__new_delete_resource() noexcept
+{
+    static __new_delete_scratch_resource __resource;
+    return &__resource;
+}
+
+// Null selects the allocator of the parallel backend
+inline ::std::atomic<oneapi::dpl::scratch_memory_resource*> __default_scratch_resource{nullptr};
+
+} // namespace __internal
+
+// Extension: thread-safe resource keeping the deallocated blocks for reuse, so that repeated calls of
+// the algorithms get warm memory which is already faulted in.
+// Block sizes are rounded up to one of eight size classes per power of two, and the blocks of a class are
+// reused by any request of that class and alignment.
+class scratch_pool_resource : public scratch_memory_resource
+{
+  public:
+    explicit scratch_pool_resource(::std::size_t __max_cached_bytes = ::std::size_t(-1),
+                                   scratch_memory_resource* __upstream = oneapi::dpl::__internal::__new_delete_resource())
+        : _M_upstream(__upstream), _M_max_cached_bytes(__max_cached_bytes)
+    {
+    }
+
+    scratch_pool_resource(const scratch_pool_resource&) = delete;
+    scratch_pool_resource&
+    operator=(const scratch_pool_resource&) = delete;
+
+    ~scratch_pool_resource() override { release(); }
+
+    //! Return all the cached blocks to the upstream resource
+    void
+    release()
+    {
+        ::std::lock_guard<::std::mutex> __lock(_M_mutex);
+        for (auto& [__key, __blocks] : _M_free_blocks)
+            for (void* __p : __blocks)
+                _M_upstream->deallocate(__p, __key.first, __key.second);
+        _M_free_blocks.clear();
+        _M_cached_bytes = 0;
+    }
+
+    ::std::size_t
+    cached_bytes() const
+    {
+        ::std::lock_guard<::std::mutex> __lock(_M_mutex);
+        return _M_cached_bytes;
+    }
+
+    scratch_memory_resource*
+    upstream_resource() const
+    {
+        return _M_upstream;
+    }
+
+  private:
+    static ::std::size_t
+    __size_class(::std::size_t __bytes)
+    {
+        constexpr ::std::size_t __min_block_size = 256;
+        if (__bytes <= __min_block_size)
+            return __min_block_size;
+        ::std::size_t __octave = __min_block_size;
+        while (__octave < __bytes / 2)
+            __octave *= 2;
+        const ::std::size_t __step = __octave / 8;
+        return (__bytes + __step - 1) / __step * __step;
+    }
+
+    void*
+    do_allocate(::std::size_t __bytes, ::std::size_t __alignment) override
+    {
+        const ::std::size_t __size = __size_class(__bytes);
+        {
+            ::std::lock_guard<::std::mutex> __lock(_M_mutex);
+            auto __it = _M_free_blocks.find({__size, __alignment});
+            if (__it != _M_free_blocks.end() && !__it->second.empty())
+            {
+                void* __p = __it->second.back();
+                __it->second.pop_back();
+                _M_cached_bytes -= __size;
+                return __p;
+            }
+        }
+        try
+        {
+            return _M_upstream->allocate(__size, __alignment);
+        }
+        catch (const ::std::bad_alloc&)
+        {
+            // The cached blocks of the other size classes may be what the upstream resource lacks
+            release();
+            return _M_upstream->allocate(__size, __alignment);
+        }
+    }
+
+    void
+    do_deallocate(void* __p, ::std::size_t __bytes, ::std::size_t __alignment) override
+    {
+        const ::std::size_t __size = __size_class(__bytes);
+        {
+            ::std::lock_guard<::std::mutex> __lock(_M_mutex);
+            if (_M_cached_bytes + __size <= _M_max_cached_bytes)
+            {
+                try
+                {
+                    _M_free_blocks[{__size, __alignment}].push_back(__p);
+                    _M_cached_bytes += __size;
+                    return;
+                }
+                catch (const ::std::bad_alloc&)
+                {
+                    // No memory for the bookkeeping: hand the block back
+                }
+            }
+        }
+        _M_upstream->deallocate(__p, __size, __alignment);
+    }
+
+    scratch_memory_resource* _M_upstream;
+    const ::std::size_t _M_max_cached_bytes;
+    ::std::size_t _M_cached_bytes = 0;
+    // (size class, alignment) -> free blocks
+    ::std::map<::std::pair<::std::size_t, ::std::size_t>, ::std::vector<void*>> _M_free_blocks;
+    mutable ::std::mutex _M_mutex;
+};
+
+// Extension: resource backing every block by whole 2 MiB pages mapped from the operating system, which cuts
+// the TLB misses of the algorithms streaming through large buffers. The blocks are 2 MiB aligned and advised
+// for transparent huge pages; a resource constructed with true takes the pages from the huge page pool
+// reserved for hugetlbfs (vm.nr_hugepages) first.
+// Every block is mapped and unmapped, so use it as the upstream of a scratch_pool_resource to reuse them.
+// Outside of Linux the blocks are obtained with the global operator new.
+class huge_page_resource : public scratch_memory_resource
+{
+  public:
+    static constexpr ::std::size_t page_size = ::std::size_t(2) << 20;
+
+    explicit huge_page_resource(bool __reserved = false) : _M_reserved(__reserved) {}
+
+    bool
+    reserved() const
+    {
+        return _M_reserved;
+    }
+
+  private:
+    static ::std::size_t
+    __mapping_size(::std::size_t __bytes)
+    {
+        return (__bytes + page_size - 1) / page_size * page_size;
+    }
+
+    void*
+    do_allocate(::std::size_t __bytes, ::std::size_t __alignment) override
+    {
+#if _ONEDPL_HUGE_PAGES_AVAILABLE
+        if (__alignment <= page_size)
+        {
+            const ::std::size_t __size = __mapping_size(__bytes);
+#    if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+            if (_M_reserved)
+            {
+                // 2 MiB pages whatever the default huge page size is, so that the unmapped length matches
+                void* __p = ::mmap(nullptr, __size, PROT_READ | PROT_WRITE,
+                                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | (21 << MAP_HUGE_SHIFT), -1, 0);
+                if (__p != MAP_FAILED)
+                    return __p;
+                // The reserved pool is exhausted: fall back to transparent huge pages
+            }
+#    endif
+            // Map one page more and unmap the ends to get a 2 MiB aligned range
+            void* __p = ::mmap(nullptr, __size + page_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+            if (__p == MAP_FAILED)
+                throw ::std::bad_alloc();
+            const ::std::uintptr_t __begin = reinterpret_cast<::std::uintptr_t>(__p);
+            const ::std::uintptr_t __aligned = (__begin + page_size - 1) & ~::std::uintptr_t(page_size - 1);
+            if (__aligned != __begin)
+                ::munmap(__p, __aligned - __begin);
+            ::munmap(reinterpret_cast<void*>(__aligned + __size), page_size - (__aligned - __begin));
+#    if defined(MADV_HUGEPAGE)
+            // Only a hint: a kernel with transparent huge pages disabled keeps the base pages
+            ::madvise(reinterpret_cast<void*>(__aligned), __size, MADV_HUGEPAGE);
+#    endif
+            return reinterpret_cast<void*>(__aligned);
+        }
+#endif
+        return oneapi::dpl::__internal::__new_delete_resource()->allocate(__bytes, __alignment);
+    }
+
+    void
+    do_deallocate(void* __p, ::std::size_t __bytes, ::std::size_t __alignment) override
+    {
+#if _ONEDPL_HUGE_PAGES_AVAILABLE
+        if (__alignment <= page_size)
+        {
+            ::munmap(__p, __mapping_size(__bytes));
+            return;
+        }
+#endif
+        oneapi::dpl::__internal::__new_delete_resource()->deallocate(__p, __bytes, __alignment);
+    }
+
+    bool _M_reserved;
+};
+
+namespace __internal
+{
+
+// Minimal size of a temporary buffer backed by huge pages, when enabled by the policy or ONEDPL_SCRATCH_HUGE_PAGES
+constexpr ::std::size_t __huge_page_min_size = ::std::size_t(16) << 20;
+
+// Total size of the huge page blocks kept mapped for the next calls
+constexpr ::std::size_t __huge_page_max_cached_bytes = ::std::size_t(1) << 30;
+
+// The blocks are cached, so that the repeated calls do not pay for mapping and faulting in the pages
+inline oneapi::dpl::scratch_memory_resource*
+__huge_page_scratch_resource() noexcept
+{
+    static oneapi::dpl::huge_page_resource __upstream;
+    static oneapi::dpl::scratch_pool_resource __pool(__huge_page_max_cached_bytes, &__upstream);
+    return &__pool;
+}
+
+// Resource a temporary buffer of __bytes bytes of an algorithm is obtained from: the one of the policy,
+// the process-wide default, huge pages for a large buffer if enabled, or null for the allocator of
+// the parallel backend
+template <typename _ExecutionPolicy>
+oneapi::dpl::scratch_memory_resource*
+__get_scratch_resource(const _ExecutionPolicy& __exec, ::std::size_t __bytes)
+{
+    const oneapi::dpl::execution::__host_policy_params __params =
+        oneapi::dpl::__internal::__get_host_policy_params(__exec);
+    if (__params.__scratch_resource)
+        return __params.__scratch_resource;
+    if (oneapi::dpl::scratch_memory_resource* __resource = __default_scratch_resource.load(::std::memory_order_acquire))
+        return __resource;
+#if _ONEDPL_HUGE_PAGES_AVAILABLE
+    const bool __huge_pages =
+        __params.__huge_pages == oneapi::dpl::execution::huge_pages::enabled ||
+        (__params.__huge_pages == oneapi::dpl::execution::huge_pages::default_ && _ONEDPL_SCRATCH_HUGE_PAGES);
+    if (__huge_pages && __bytes >= __huge_page_min_size)
+        return __huge_page_scratch_resource();
+#endif
+    return nullptr;
+}
+
+} // namespace __internal
+
+// Extension: set the resource the temporary buffers of the parallel host algorithms are obtained from
+// when the policy does not specify one. Null restores the allocator of the parallel backend.
+// Returns the previous default resource.
+inline scratch_memory_resource*
+set_default_scratch_resource(scratch_memory_resource* __resource) noexcept
+{
+    return oneapi::dpl::__internal::__default_scratch_resource.exchange(__resource, ::std::memory_order_acq_rel);
+}
+
+inline scratch_memory_resource*
+get_default_scratch_resource() noexcept
+{
+    return oneapi::dpl::__internal::__default_scratch_resource.load(::std::memory_order_acquire);
+}
+
+} // namespace dpl
+} // namespace oneapi
+
+#endif // _ONEDPL_SCRATCH_MEMORY_RESOURCE_H
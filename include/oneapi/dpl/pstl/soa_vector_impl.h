@@ -0,0 +1,205 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_SOA_VECTOR_IMPL_H
+#define _ONEDPL_SOA_VECTOR_IMPL_H
+
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "iterator_impl.h"
+
+namespace oneapi
+{
+namespace dpl
+{
+
+// A sequence of records stored as one contiguous column per field. The iterators are zip_iterators over the
+// columns, so every algorithm accepts them, and the algorithms moving whole records (copy_if, unique_copy and the
+// values of sort_by_key) process the columns one by one.
+template <typename... _Ts>
+class soa_vector
+{
+    static_assert(sizeof...(_Ts) > 0, "Cannot instantiate soa_vector with empty template parameter pack");
+    static_assert((!::std::is_same_v<::std::remove_cv_t<_Ts>, bool> && ...),
+                  "The columns of soa_vector cannot be of type bool, as std::vector<bool> has no contiguous storage");
+
+    using __columns_type = ::std::tuple<::std::vector<_Ts>...>;
+    using __indices = ::std::index_sequence_for<_Ts...>;
+
+    __columns_type _M_columns;
+
+    template <typename _Iterator, typename _Columns, ::std::size_t... _Ip>
+    static _Iterator
+    __make_iterator(_Columns& __columns, ::std::size_t __pos, ::std::index_sequence<_Ip...>)
+    {
+        return _Iterator(::std::get<_Ip>(__columns).data() + __pos...);
+    }
+
+    template <typename _Function, ::std::size_t... _Ip>
+    void
+    __for_each_column(_Function __f, ::std::index_sequence<_Ip...>)
+    {
+        (__f(::std::get<_Ip>(_M_columns)), ...);
+    }
+
+  public:
+    using value_type = ::std::tuple<_Ts...>;
+    using size_type = ::std::size_t;
+    using difference_type = ::std::ptrdiff_t;
+    using iterator = zip_iterator<_Ts*...>;
+    using const_iterator = zip_iterator<const _Ts*...>;
+    using reference = typename ::std::iterator_traits<iterator>::reference;
+    using const_reference = typename ::std::iterator_traits<const_iterator>::reference;
+
+    template <::std::size_t _Ip>
+    using column_type = ::std::vector<::std::tuple_element_t<_Ip, value_type>>;
+
+    soa_vector() = default;
+
+    explicit soa_vector(size_type __n) : _M_columns(::std::vector<_Ts>(__n)...) {}
+
+    soa_vector(size_type __n, const _Ts&... __values) : _M_columns(::std::vector<_Ts>(__n, __values)...) {}
+
+    size_type
+    size() const
+    {
+        return ::std::get<0>(_M_columns).size();
+    }
+
+    bool
+    empty() const
+    {
+        return size() == 0;
+    }
+
+    void
+    resize(size_type __n)
+    {
+        __for_each_column([__n](auto& __column) { __column.resize(__n); }, __indices{});
+    }
+
+    void
+    reserve(size_type __n)
+    {
+        __for_each_column([__n](auto& __column) { __column.reserve(__n); }, __indices{});
+    }
+
+    void
+    clear()
+    {
+        __for_each_column([](auto& __column) { __column.clear(); }, __indices{});
+    }
+
+    void
+    push_back(const _Ts&... __values)
+    {
+        ::std::apply([&](auto&... __column) { (__column.push_back(__values), ...); }, _M_columns);
+    }
+
+    void
+    pop_back()
+    {
+        __for_each_column([](auto& __column) { __column.pop_back(); }, __indices{});
+    }
+
+    void
+    swap(soa_vector& __other)
+    {
+        _M_columns.swap(__other._M_columns);
+    }
+
+    // The storage of one field of the records
+    template <::std::size_t _Ip>
+    column_type<_Ip>&
+    column()
+    {
+        return ::std::get<_Ip>(_M_columns);
+    }
+
+    template <::std::size_t _Ip>
+    const column_type<_Ip>&
+    column() const
+    {
+        return ::std::get<_Ip>(_M_columns);
+    }
+
+    iterator
+    begin()
+    {
+        return __make_iterator<iterator>(_M_columns, 0, __indices{});
+    }
+
+    iterator
+    end()
+    {
+        return __make_iterator<iterator>(_M_columns, size(), __indices{});
+    }
+
+    const_iterator
+    begin() const
+    {
+        return __make_iterator<const_iterator>(_M_columns, 0, __indices{});
+    }
+
+    const_iterator
+    end() const
+    {
+        return __make_iterator<const_iterator>(_M_columns, size(), __indices{});
+    }
+
+    const_iterator
+    cbegin() const
+    {
+        return begin();
+    }
+
+    const_iterator
+    cend() const
+    {
+        return end();
+    }
+
+    reference operator[](size_type __i) { return begin()[__i]; }
+
+    const_reference operator[](size_type __i) const { return begin()[__i]; }
+
+    friend bool
+    operator==(const soa_vector& __x, const soa_vector& __y)
+    {
+        return __x._M_columns == __y._M_columns;
+    }
+
+    friend bool
+    operator!=(const soa_vector& __x, const soa_vector& __y)
+    {
+        return !(__x == __y);
+    }
+};
+
+template <typename... _Ts>
+void
+swap(soa_vector<_Ts...>& __x, soa_vector<_Ts...>& __y)
+{
+    __x.swap(__y);
+}
+
+} // namespace dpl
+} // namespace oneapi
+
+#endif // _ONEDPL_SOA_VECTOR_IMPL_H
@@ -0,0 +1,584 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_INTERNAL_STD_THREAD_THREAD_POOL_H
+#define _ONEDPL_INTERNAL_STD_THREAD_THREAD_POOL_H
+
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#    include <sched.h>
+#endif
+
+namespace oneapi
+{
+namespace dpl
+{
+namespace __std_thread_backend
+{
+
+//------------------------------------------------------------------------
+// tasks
+//------------------------------------------------------------------------
+
+class __task
+{
+  public:
+    virtual void
+    __execute() = 0;
+
+  protected:
+    ~__task() = default;
+};
+
+// The second branch of a fork-join, run by the forking worker unless another one steals it first
+template <typename _Fp>
+class __join_task final : public __task
+{
+    _Fp& _M_f;
+    std::exception_ptr _M_error;
+    std::atomic<bool> _M_done{false};
+
+  public:
+    explicit __join_task(_Fp& __f) : _M_f(__f) {}
+
+    void
+    __execute() override
+    {
+        try
+        {
+            _M_f();
+        }
+        catch (...)
+        {
+            _M_error = std::current_exception();
+        }
+        _M_done.store(true, std::memory_order_release);
+    }
+
+    bool
+    __done() const
+    {
+        return _M_done.load(std::memory_order_acquire);
+    }
+
+    void
+    __rethrow() const
+    {
+        if (_M_error)
+            std::rethrow_exception(_M_error);
+    }
+};
+
+// Work submitted by a thread outside of the pool, which sleeps until a worker has run it
+template <typename _Fp>
+class __blocking_task final : public __task
+{
+    _Fp& _M_f;
+    std::exception_ptr _M_error;
+    std::mutex _M_mutex;
+    std::condition_variable _M_finished;
+    bool _M_done = false;
+
+  public:
+    explicit __blocking_task(_Fp& __f) : _M_f(__f) {}
+
+    void
+    __execute() override
+    {
+        try
+        {
+            _M_f();
+        }
+        catch (...)
+        {
+            _M_error = std::current_exception();
+        }
+        std::lock_guard<std::mutex> __lock(_M_mutex);
+        _M_done = true;
+        _M_finished.notify_one();
+    }
+
+    void
+    __wait()
+    {
+        std::unique_lock<std::mutex> __lock(_M_mutex);
+        _M_finished.wait(__lock, [this] { return _M_done; });
+        if (_M_error)
+            std::rethrow_exception(_M_error);
+    }
+};
+
+// Work nobody waits for in the pool, which owns it
+template <typename _Fp>
+class __detached_task final : public __task
+{
+    _Fp _M_f;
+
+  public:
+    explicit __detached_task(_Fp __f) : _M_f(std::move(__f)) {}
+
+    void
+    __execute() override
+    {
+        _M_f();
+        delete this;
+    }
+};
+
+//------------------------------------------------------------------------
+// work-stealing deque
+//------------------------------------------------------------------------
+
+// Chase-Lev deque of a bounded capacity: the owning worker pushes and pops the newest tasks at the bottom,
+// the thieves take the oldest ones, the largest pieces of the recursive splitting, from the top.
+// The fork-join depth stays far below the capacity; a full deque makes the owner run the task itself.
+class __work_stealing_deque
+{
+    static constexpr std::int64_t __capacity = std::int64_t(1) << 12;
+    static constexpr std::int64_t __mask = __capacity - 1;
+
+    alignas(64) std::atomic<std::int64_t> _M_top{0};
+    alignas(64) std::atomic<std::int64_t> _M_bottom{0};
+    alignas(64) std::atomic<__task*> _M_tasks[__capacity];
+
+  public:
+    // Owner only: returns false if the deque is full
+    bool
+    __push(__task* __t)
+    {
+        const std::int64_t __b = _M_bottom.load(std::memory_order_relaxed);
+        // A stale top only underestimates the free room, so a slot a thief may still read is never overwritten
+        if (__b - _M_top.load(std::memory_order_acquire) >= __capacity)
+            return false;
+        _M_tasks[__b & __mask].store(__t, std::memory_order_relaxed);
+        _M_bottom.store(__b + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Owner only: the newest task, or null if the deque is empty or the thieves have taken the last one
+    __task*
+    __pop()
+    {
+        const std::int64_t __b = _M_bottom.load(std::memory_order_relaxed) - 1;
+        _M_bottom.store(__b, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        std::int64_t __t = _M_top.load(std::memory_order_relaxed);
+        if (__t > __b)
+        {
+            _M_bottom.store(__b + 1, std::memory_order_relaxed);
+            return nullptr;
+        }
+        __task* __result = _M_tasks[__b & __mask].load(std::memory_order_relaxed);
+        if (__t == __b)
+        {
+            // The last task is raced for with the thieves
+            if (!_M_top.compare_exchange_strong(__t, __t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+                __result = nullptr;
+            _M_bottom.store(__b + 1, std::memory_order_relaxed);
+        }
+        return __result;
+    }
+
+    // Any thread: the oldest task, or null if the deque is empty or another thread has won the race for it
+    __task*
+    __steal()
+    {
+        std::int64_t __t = _M_top.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const std::int64_t __b = _M_bottom.load(std::memory_order_acquire);
+        if (__t >= __b)
+            return nullptr;
+        __task* __result = _M_tasks[__t & __mask].load(std::memory_order_relaxed);
+        if (!_M_top.compare_exchange_strong(__t, __t + 1, std::memory_order_seq_cst, std::memory_order_relaxed))
+            return nullptr;
+        return __result;
+    }
+
+    bool
+    __empty() const
+    {
+        return _M_bottom.load(std::memory_order_seq_cst) <= _M_top.load(std::memory_order_seq_cst);
+    }
+};
+
+//------------------------------------------------------------------------
+// configuration
+//------------------------------------------------------------------------
+
+// Number of the worker threads: ONEDPL_STD_THREAD_NUM_THREADS if set to a positive number, or else
+// the number of the hardware threads
+inline std::size_t
+__num_threads_from_env()
+{
+    if (const char* __value = std::getenv("ONEDPL_STD_THREAD_NUM_THREADS"))
+    {
+        char* __end = nullptr;
+        const unsigned long __n = std::strtoul(__value, &__end, 10);
+        if (*__value && *__end == '\0' && __n > 0)
+            return __n;
+    }
+    const unsigned __hw = std::thread::hardware_concurrency();
+    return __hw ? __hw : 1;
+}
+
+// CPUs the workers are pinned to, worker i to the i-th CPU modulo the length of the list, from
+// ONEDPL_STD_THREAD_AFFINITY: "compact" lists the CPUs the process may run on in order, a comma-separated
+// list of CPU numbers is taken as is. If unset, or where pinning is not supported, the OS places the workers.
+inline std::vector<int>
+__affinity_from_env()
+{
+    std::vector<int> __cpus;
+#if defined(__linux__) && defined(CPU_SETSIZE)
+    const char* __value = std::getenv("ONEDPL_STD_THREAD_AFFINITY");
+    if (!__value || !*__value)
+        return __cpus;
+
+    if (std::strcmp(__value, "compact") == 0)
+    {
+        cpu_set_t __set;
+        CPU_ZERO(&__set);
+        if (sched_getaffinity(0, sizeof(__set), &__set) == 0)
+        {
+            for (int __cpu_index = 0; __cpu_index < CPU_SETSIZE; ++__cpu_index)
+                if (CPU_ISSET(__cpu_index, &__set))
+                    __cpus.push_back(__cpu_index);
+        }
+        return __cpus;
+    }
+
+    for (const char* __p = __value; *__p;)
+    {
+        char* __end = nullptr;
+        const long __cpu_index = std::strtol(__p, &__end, 10);
+        if (__end == __p || __cpu_index < 0 || __cpu_index >= CPU_SETSIZE || (*__end != ',' && *__end != '\0'))
+            return {}; // a malformed list is ignored as a whole
+        __cpus.push_back(static_cast<int>(__cpu_index));
+        __p = *__end ? __end + 1 : __end;
+    }
+#endif
+    return __cpus;
+}
+
+inline void
+__pin_current_thread(int __cpu_index)
+{
+#if defined(__linux__) && defined(CPU_SETSIZE)
+    cpu_set_t __set;
+    CPU_ZERO(&__set);
+    CPU_SET(__cpu_index, &__set);
+    // On failure, e.g. for a CPU outside of the cgroup of the process, the OS keeps placing the thread
+    sched_setaffinity(0, sizeof(__set), &__set);
+#else
+    (void)__cpu_index;
+#endif
+}
+
+//------------------------------------------------------------------------
+// thread pool
+//------------------------------------------------------------------------
+
+// Index of the worker the calling thread is, or -1 for the threads outside of the pool
+inline int&
+__current_worker()
+{
+    static thread_local int __index = -1;
+    return __index;
+}
+
+// Work-stealing pool of std::thread workers, one deque each. The threads outside of the pool submit their work
+// into a shared queue and sleep until it is done; the workers fork on their own deques and, while joining,
+// run the tasks they steal from the others. Idle workers spin briefly, then sleep until new work is pushed.
+class __thread_pool
+{
+    static constexpr int __spin_count = 64;
+
+    const std::size_t _M_size;
+    std::unique_ptr<__work_stealing_deque[]> _M_deques;
+    std::vector<std::thread> _M_threads;
+
+    std::mutex _M_mutex;
+    std::condition_variable _M_wake;
+    std::deque<__task*> _M_submitted;   // guarded by _M_mutex
+    std::uint64_t _M_epoch = 0;         // guarded by _M_mutex, changed to wake the sleeping workers
+    bool _M_stop = false;               // guarded by _M_mutex
+    std::atomic<std::size_t> _M_submitted_count{0};
+    std::atomic<int> _M_sleeping{0};
+
+    __task*
+    __take_submitted()
+    {
+        if (_M_submitted_count.load(std::memory_order_relaxed) == 0)
+            return nullptr;
+        std::lock_guard<std::mutex> __lock(_M_mutex);
+        if (_M_submitted.empty())
+            return nullptr;
+        __task* __t = _M_submitted.front();
+        _M_submitted.pop_front();
+        _M_submitted_count.fetch_sub(1, std::memory_order_relaxed);
+        return __t;
+    }
+
+    // Steals from the other workers, visited from a pseudo-random one
+    __task*
+    __steal(std::size_t __thief, std::uint32_t& __seed)
+    {
+        __seed ^= __seed << 13;
+        __seed ^= __seed >> 17;
+        __seed ^= __seed << 5;
+        const std::size_t __start = __seed % _M_size;
+        for (std::size_t __i = 0; __i < _M_size; ++__i)
+        {
+            const std::size_t __victim = (__start + __i) % _M_size;
+            if (__victim != __thief)
+                if (__task* __t = _M_deques[__victim].__steal())
+                    return __t;
+        }
+        return nullptr;
+    }
+
+    __task*
+    __find_task(std::size_t __index, std::uint32_t& __seed)
+    {
+        if (__task* __t = _M_deques[__index].__pop())
+            return __t;
+        if (__task* __t = __take_submitted())
+            return __t;
+        return __steal(__index, __seed);
+    }
+
+    bool
+    __has_work() const
+    {
+        if (_M_submitted_count.load(std::memory_order_seq_cst) != 0)
+            return true;
+        for (std::size_t __i = 0; __i < _M_size; ++__i)
+            if (!_M_deques[__i].__empty())
+                return true;
+        return false;
+    }
+
+    void
+    __wake_one()
+    {
+        // Pairs with the fence of a worker going to sleep: either it sees the new task, or it is counted here
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (_M_sleeping.load(std::memory_order_relaxed) > 0)
+        {
+            {
+                std::lock_guard<std::mutex> __lock(_M_mutex);
+                ++_M_epoch;
+            }
+            _M_wake.notify_one();
+        }
+    }
+
+    void
+    __run_worker(std::size_t __index, int __cpu)
+    {
+        oneapi::dpl::__std_thread_backend::__current_worker() = static_cast<int>(__index);
+        if (__cpu >= 0)
+            oneapi::dpl::__std_thread_backend::__pin_current_thread(__cpu);
+
+        std::uint32_t __seed = static_cast<std::uint32_t>(__index) * 2654435761u + 1;
+        for (;;)
+        {
+            __task* __t = nullptr;
+            for (int __i = 0; __i < __spin_count && !__t; ++__i)
+            {
+                __t = __find_task(__index, __seed);
+                if (!__t)
+                    std::this_thread::yield();
+            }
+            if (__t)
+            {
+                __t->__execute();
+                continue;
+            }
+
+            std::unique_lock<std::mutex> __lock(_M_mutex);
+            _M_sleeping.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+            if (!_M_stop && !__has_work())
+            {
+                const std::uint64_t __epoch = _M_epoch;
+                _M_wake.wait(__lock, [this, __epoch] { return _M_epoch != __epoch || _M_stop; });
+            }
+            _M_sleeping.fetch_sub(1, std::memory_order_relaxed);
+            // The submitted work nobody waits for, e.g. of the asynchronous algorithms, still runs at exit
+            if (_M_stop && _M_submitted.empty())
+                return;
+        }
+    }
+
+  public:
+    explicit __thread_pool(std::size_t __size) : _M_size(__size), _M_deques(new __work_stealing_deque[__size])
+    {
+        const std::vector<int> __cpus = oneapi::dpl::__std_thread_backend::__affinity_from_env();
+        _M_threads.reserve(_M_size);
+        for (std::size_t __i = 0; __i < _M_size; ++__i)
+        {
+            const int __cpu = __cpus.empty() ? -1 : __cpus[__i % __cpus.size()];
+            _M_threads.emplace_back([this, __i, __cpu] { __run_worker(__i, __cpu); });
+        }
+    }
+
+    __thread_pool(const __thread_pool&) = delete;
+    __thread_pool&
+    operator=(const __thread_pool&) = delete;
+
+    ~__thread_pool()
+    {
+        {
+            std::lock_guard<std::mutex> __lock(_M_mutex);
+            _M_stop = true;
+        }
+        _M_wake.notify_all();
+        for (std::thread& __worker : _M_threads)
+            __worker.join();
+    }
+
+    std::size_t
+    __size() const
+    {
+        return _M_size;
+    }
+
+    // Runs __f1 and __f2, possibly in parallel, on the worker __index
+    template <typename _F1, typename _F2>
+    void
+    __fork_join(std::size_t __index, _F1& __f1, _F2& __f2)
+    {
+        __join_task<_F2> __second(__f2);
+        if (!_M_deques[__index].__push(&__second))
+        {
+            __f1();
+            __f2();
+            return;
+        }
+        __wake_one();
+
+        std::exception_ptr __error;
+        try
+        {
+            __f1();
+        }
+        catch (...)
+        {
+            __error = std::current_exception();
+        }
+
+        // The thieves take the oldest tasks first, so the bottom one is either __second or the deque is empty
+        __task* __t = _M_deques[__index].__pop();
+        assert(__t == nullptr || __t == &__second);
+        if (__t)
+        {
+            __second.__execute();
+        }
+        else
+        {
+            std::uint32_t __seed = static_cast<std::uint32_t>(reinterpret_cast<std::uintptr_t>(&__second) >> 4) | 1;
+            while (!__second.__done())
+            {
+                if (__task* __stolen = __steal(__index, __seed))
+                    __stolen->__execute();
+                else
+                    std::this_thread::yield();
+            }
+        }
+
+        if (__error)
+            std::rethrow_exception(__error);
+        __second.__rethrow();
+    }
+
+    // Runs __f on a worker and waits for it
+    template <typename _Fp>
+    void
+    __execute(_Fp& __f)
+    {
+        __blocking_task<_Fp> __root(__f);
+        __submit(&__root);
+        __root.__wait();
+    }
+
+    // Runs __f on a worker without waiting for it
+    template <typename _Fp>
+    void
+    __enqueue(_Fp __f)
+    {
+        __submit(new __detached_task<_Fp>(std::move(__f)));
+    }
+
+    void
+    __submit(__task* __t)
+    {
+        {
+            std::lock_guard<std::mutex> __lock(_M_mutex);
+            _M_submitted.push_back(__t);
+            _M_submitted_count.fetch_add(1, std::memory_order_relaxed);
+            ++_M_epoch;
+        }
+        _M_wake.notify_one();
+    }
+};
+
+// The pool is started by the first algorithm using it
+inline __thread_pool&
+__get_thread_pool()
+{
+    static __thread_pool __pool(oneapi::dpl::__std_thread_backend::__num_threads_from_env());
+    return __pool;
+}
+
+// Runs __f on the pool and waits for it; nested calls from the workers run in place
+template <typename _Fp>
+void
+__run_on_pool(_Fp __f)
+{
+    if (oneapi::dpl::__std_thread_backend::__current_worker() >= 0)
+        __f();
+    else
+        oneapi::dpl::__std_thread_backend::__get_thread_pool().__execute(__f);
+}
+
+// Runs __f1 and __f2, possibly in parallel; called on a worker
+template <typename _F1, typename _F2>
+void
+__parallel_invoke_body(_F1&& __f1, _F2&& __f2)
+{
+    const int __index = oneapi::dpl::__std_thread_backend::__current_worker();
+    assert(__index >= 0);
+    oneapi::dpl::__std_thread_backend::__get_thread_pool().__fork_join(static_cast<std::size_t>(__index), __f1, __f2);
+}
+
+} // namespace __std_thread_backend
+} // namespace dpl
+} // namespace oneapi
+
+#endif // _ONEDPL_INTERNAL_STD_THREAD_THREAD_POOL_H
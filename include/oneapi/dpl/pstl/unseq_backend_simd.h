@@ -20,6 +20,13 @@
 
 #include "utils.h"
 
+#if _ONEDPL_STREAMING_STORES_AVAILABLE
+#    include <algorithm>
+#    include <cstdint>
+#    include <cstring>
+#    include <emmintrin.h>
+#endif
+
 // This header defines the minimum set of vector routines required
 // to support Parallel STL.
 namespace oneapi
@@ -879,6 +886,85 @@ __simd_remove_if(_RandomAccessIterator __first, _DifferenceType __n, _UnaryPredi
     }
     return __current + __cnt;
 }
+
+#if _ONEDPL_STREAMING_STORES_AVAILABLE
+//------------------------------------------------------------------------
+// streaming stores
+//------------------------------------------------------------------------
+
+// The elements a 16-byte store of the streaming fill consists of
+template <typename _Tp>
+inline constexpr bool __is_stream_fillable_v = ::std::is_trivially_copyable_v<_Tp> && 16 % sizeof(_Tp) == 0;
+
+// The 16-byte aligned blocks of the destination are written by non-temporal stores, which bypass the caches and
+// the read for ownership of the lines; the unaligned head and tail are written by ordinary stores. The stores are
+// weakly ordered, so they are fenced before the work is reported done to another thread.
+inline void
+__stream_copy_bytes(const char* __src, ::std::size_t __size, char* __dst) noexcept
+{
+    ::std::size_t __i = (16 - reinterpret_cast<::std::uintptr_t>(__dst) % 16) % 16;
+    if (__i > __size)
+        __i = __size;
+    ::std::memcpy(__dst, __src, __i);
+    for (; __i + 64 <= __size; __i += 64)
+    {
+        const __m128i __b0 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__src + __i));
+        const __m128i __b1 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__src + __i + 16));
+        const __m128i __b2 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__src + __i + 32));
+        const __m128i __b3 = _mm_loadu_si128(reinterpret_cast<const __m128i*>(__src + __i + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(__dst + __i), __b0);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(__dst + __i + 16), __b1);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(__dst + __i + 32), __b2);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(__dst + __i + 48), __b3);
+    }
+    for (; __i + 16 <= __size; __i += 16)
+        _mm_stream_si128(reinterpret_cast<__m128i*>(__dst + __i),
+                         _mm_loadu_si128(reinterpret_cast<const __m128i*>(__src + __i)));
+    ::std::memcpy(__dst + __i, __src + __i, __size - __i);
+    _mm_sfence();
+}
+
+template <typename _Tp>
+_Tp*
+__simd_stream_copy_n(const _Tp* __first, ::std::size_t __n, _Tp* __result) noexcept
+{
+    static_assert(::std::is_trivially_copyable_v<_Tp>);
+
+    __stream_copy_bytes(reinterpret_cast<const char*>(__first), __n * sizeof(_Tp), reinterpret_cast<char*>(__result));
+    return __result + __n;
+}
+
+// The 16-byte boundaries of the destination fall between two elements if the elements are aligned to their size;
+// otherwise the ordinary stores are used.
+template <typename _Tp>
+_Tp*
+__simd_stream_fill_n(_Tp* __first, ::std::size_t __n, const _Tp& __value) noexcept
+{
+    static_assert(__is_stream_fillable_v<_Tp>);
+
+    constexpr ::std::size_t __per_block = 16 / sizeof(_Tp);
+    const ::std::uintptr_t __address = reinterpret_cast<::std::uintptr_t>(__first);
+    ::std::size_t __i = 0;
+    if (__address % sizeof(_Tp) == 0)
+    {
+        __i = ::std::min(__n, (16 - __address % 16) % 16 / sizeof(_Tp));
+        for (::std::size_t __j = 0; __j < __i; ++__j)
+            ::std::memcpy(__first + __j, &__value, sizeof(_Tp));
+
+        alignas(16) char __pattern[16];
+        for (::std::size_t __k = 0; __k < __per_block; ++__k)
+            ::std::memcpy(__pattern + __k * sizeof(_Tp), &__value, sizeof(_Tp));
+        const __m128i __block = _mm_load_si128(reinterpret_cast<const __m128i*>(__pattern));
+        for (; __i + __per_block <= __n; __i += __per_block)
+            _mm_stream_si128(reinterpret_cast<__m128i*>(__first + __i), __block);
+        _mm_sfence();
+    }
+    for (; __i < __n; ++__i)
+        ::std::memcpy(__first + __i, &__value, sizeof(_Tp));
+    return __first + __n;
+}
+#endif // _ONEDPL_STREAMING_STORES_AVAILABLE
+
 } // namespace __unseq_backend
 } // namespace dpl
 } // namespace oneapi
@@ -24,6 +24,8 @@
 #include <tuple>
 #include <utility>
 #include <climits>
+#include <memory>
+#include <vector>
 
 #if _ONEDPL_BACKEND_SYCL
 #    include "hetero/dpcpp/sycl_defs.h"
@@ -765,6 +767,49 @@ struct __is_iterator_type<_T, std::void_t<typename std::iterator_traits<_T>::dif
 template <typename _T>
 static constexpr bool __is_iterator_type_v = __is_iterator_type<_T>::value;
 
+// Iterators to the elements stored contiguously in memory: pointers, C++20 contiguous iterators, and otherwise
+// the iterators of std::vector (but for bool)
+template <typename _Iterator, typename = void>
+struct __is_contiguous_iterator : ::std::is_pointer<_Iterator>
+{
+};
+
+#if _ONEDPL_CPP20_CONCEPTS_PRESENT
+template <typename _Iterator>
+struct __is_contiguous_iterator<_Iterator, ::std::enable_if_t<::std::contiguous_iterator<_Iterator>>>
+    : ::std::true_type
+{
+};
+#else
+template <typename _Iterator>
+struct __is_contiguous_iterator<
+    _Iterator, ::std::enable_if_t<!::std::is_pointer_v<_Iterator> &&
+                                  ::std::is_object_v<typename ::std::iterator_traits<_Iterator>::value_type> &&
+                                  !::std::is_same_v<typename ::std::iterator_traits<_Iterator>::value_type, bool>>>
+{
+  private:
+    using _ValueType = typename ::std::iterator_traits<_Iterator>::value_type;
+
+  public:
+    static constexpr bool value = ::std::is_same_v<_Iterator, typename ::std::vector<_ValueType>::iterator> ||
+                                  ::std::is_same_v<_Iterator, typename ::std::vector<_ValueType>::const_iterator>;
+};
+#endif
+
+template <typename _Iterator>
+inline constexpr bool __is_contiguous_iterator_v = __is_contiguous_iterator<_Iterator>::value;
+
+// Address of the element a contiguous iterator points to; the iterator must be dereferenceable
+template <typename _Iterator>
+auto
+__to_address(_Iterator __it) noexcept
+{
+    if constexpr (::std::is_pointer_v<_Iterator>)
+        return __it;
+    else
+        return ::std::addressof(*__it);
+}
+
 } // namespace __internal
 } // namespace dpl
 } // namespace oneapi
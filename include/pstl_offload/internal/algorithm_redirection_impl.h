@@ -20,11 +20,13 @@
 #include <oneapi/dpl/algorithm>
 
 #include "usm_memory_replacement.h"
+#include "offload_heuristic.h"
 
 namespace std
 {
 
-// All the algorithms below get the policy from static __offload_policy_holder object.
+// All the algorithms below get the policy from static __offload_policy_holder object,
+// unless the sequence is too short to be worth the offload (see offload_heuristic.h).
 // They needs to be explicitly marked static because, otherwise, function templates behave
 // like inline that can result in using only one device in all translation units no matter which
 // PSTL offload option argument was used for the particular translation unit compilation
@@ -34,9 +36,9 @@ static bool
 any_of(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
        _Predicate __pred)
 {
-    return oneapi::dpl::any_of(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__any_of, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::any_of(__policy, __first, __last, __pred); });
 }
 
 template <class _ForwardIterator, class _Predicate>
@@ -44,9 +46,9 @@ static bool
 all_of(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
        _Predicate __pred)
 {
-    return oneapi::dpl::all_of(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__all_of, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::all_of(__policy, __first, __last, __pred); });
 }
 
 template <class _ForwardIterator, class _Predicate>
@@ -54,9 +56,9 @@ static bool
 none_of(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
         _Predicate __pred)
 {
-    return oneapi::dpl::none_of(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__none_of, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::none_of(__policy, __first, __last, __pred); });
 }
 
 template <class _ForwardIterator, class _Function>
@@ -64,18 +66,18 @@ static void
 for_each(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
          _Function __f)
 {
-    oneapi::dpl::for_each(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __f);
+    ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__for_each, __first, __last,
+        [&](const auto& __policy) { oneapi::dpl::for_each(__policy, __first, __last, __f); });
 }
 
 template <class _ForwardIterator, class _Size, class _Function>
 static void
 for_each_n(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _Size __n, _Function __f)
 {
-    oneapi::dpl::for_each_n(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __n, __f);
+    ::__pstl_offload::__offload_or_host_n(
+        ::__pstl_offload::__offload_algorithm::__for_each_n, __first, __n,
+        [&](const auto& __policy) { oneapi::dpl::for_each_n(__policy, __first, __n, __f); });
 }
 
 template <class _ForwardIterator, class _Predicate>
@@ -83,9 +85,9 @@ static _ForwardIterator
 find_if(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
         _Predicate __pred)
 {
-    return oneapi::dpl::find_if(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__find_if, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::find_if(__policy, __first, __last, __pred); });
 }
 
 template <class _ForwardIterator, class _Predicate>
@@ -93,9 +95,9 @@ static _ForwardIterator
 find_if_not(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
             _Predicate __pred)
 {
-    return oneapi::dpl::find_if_not(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__find_if_not, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::find_if_not(__policy, __first, __last, __pred); });
 }
 
 template <class _ForwardIterator, class _Tp>
@@ -103,9 +105,9 @@ static _ForwardIterator
 find(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
      const _Tp& __value)
 {
-    return oneapi::dpl::find(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __value);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__find, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::find(__policy, __first, __last, __value); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _BinaryPredicate>
@@ -113,9 +115,11 @@ static _ForwardIterator1
 find_end(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
          _ForwardIterator2 __s_first, _ForwardIterator2 __s_last, _BinaryPredicate __pred)
 {
-    return oneapi::dpl::find_end(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __s_first, __s_last, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__find_end, __first, __last,
+        [&](const auto& __policy) {
+            return oneapi::dpl::find_end(__policy, __first, __last, __s_first, __s_last, __pred);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2>
@@ -123,9 +127,9 @@ static _ForwardIterator1
 find_end(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
          _ForwardIterator2 __s_first, _ForwardIterator2 __s_last)
 {
-    return oneapi::dpl::find_end(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __s_first, __s_last);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__find_end, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::find_end(__policy, __first, __last, __s_first, __s_last); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _BinaryPredicate>
@@ -133,9 +137,11 @@ static _ForwardIterator1
 find_first_of(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
               _ForwardIterator2 __s_first, _ForwardIterator2 __s_last, _BinaryPredicate __pred)
 {
-    return oneapi::dpl::find_first_of(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __s_first, __s_last, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__find_first_of, __first, __last,
+        [&](const auto& __policy) {
+            return oneapi::dpl::find_first_of(__policy, __first, __last, __s_first, __s_last, __pred);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2>
@@ -143,18 +149,20 @@ static _ForwardIterator1
 find_first_of(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
               _ForwardIterator2 __s_first, _ForwardIterator2 __s_last)
 {
-    return oneapi::dpl::find_first_of(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __s_first, __s_last);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__find_first_of, __first, __last,
+        [&](const auto& __policy) {
+            return oneapi::dpl::find_first_of(__policy, __first, __last, __s_first, __s_last);
+        });
 }
 
 template <class _ForwardIterator>
 static _ForwardIterator
 adjacent_find(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last)
 {
-    return oneapi::dpl::adjacent_find(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__adjacent_find, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::adjacent_find(__policy, __first, __last); });
 }
 
 template <class _ForwardIterator, class _BinaryPredicate>
@@ -162,9 +170,9 @@ static _ForwardIterator
 adjacent_find(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
               _BinaryPredicate __pred)
 {
-    return oneapi::dpl::adjacent_find(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__adjacent_find, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::adjacent_find(__policy, __first, __last, __pred); });
 }
 
 template <class _ForwardIterator, class _Tp>
@@ -172,9 +180,9 @@ static typename iterator_traits<_ForwardIterator>::difference_type
 count(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
       const _Tp& __value)
 {
-    return oneapi::dpl::count(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __value);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__count, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::count(__policy, __first, __last, __value); });
 }
 
 template <class _ForwardIterator, class _Predicate>
@@ -182,9 +190,9 @@ static typename iterator_traits<_ForwardIterator>::difference_type
 count_if(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
          _Predicate __pred)
 {
-    return oneapi::dpl::count_if(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__count_if, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::count_if(__policy, __first, __last, __pred); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _BinaryPredicate>
@@ -192,9 +200,11 @@ static _ForwardIterator1
 search(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
        _ForwardIterator2 __s_first, _ForwardIterator2 __s_last, _BinaryPredicate __pred)
 {
-    return oneapi::dpl::search(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __s_first, __s_last, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__search, __first, __last,
+        [&](const auto& __policy) {
+            return oneapi::dpl::search(__policy, __first, __last, __s_first, __s_last, __pred);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2>
@@ -202,9 +212,9 @@ static _ForwardIterator1
 search(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
        _ForwardIterator2 __s_first, _ForwardIterator2 __s_last)
 {
-    return oneapi::dpl::search(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __s_first, __s_last);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__search, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::search(__policy, __first, __last, __s_first, __s_last); });
 }
 
 template <class _ForwardIterator, class _Size, class _Tp, class _BinaryPredicate>
@@ -212,9 +222,11 @@ static _ForwardIterator
 search_n(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
          _Size __count, const _Tp& __value, _BinaryPredicate __pred)
 {
-    return oneapi::dpl::search_n(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __count, __value, __pred);
+    return ::__pstl_offload::__offload_or_host_n(
+        ::__pstl_offload::__offload_algorithm::__search_n, __first, __last,
+        [&](const auto& __policy) {
+            return oneapi::dpl::search_n(__policy, __first, __last, __count, __value, __pred);
+        });
 }
 
 template <class _ForwardIterator, class _Size, class _Tp>
@@ -222,9 +234,9 @@ static _ForwardIterator
 search_n(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
          _Size __count, const _Tp& __value)
 {
-    return oneapi::dpl::search_n(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __count, __value);
+    return ::__pstl_offload::__offload_or_host_n(
+        ::__pstl_offload::__offload_algorithm::__search_n, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::search_n(__policy, __first, __last, __count, __value); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2>
@@ -232,18 +244,18 @@ static _ForwardIterator2
 copy(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
      _ForwardIterator2 __result)
 {
-    return oneapi::dpl::copy(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __result);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__copy, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::copy(__policy, __first, __last, __result); });
 }
 
 template <class _ForwardIterator1, class _Size, class _ForwardIterator2>
 static _ForwardIterator2
 copy_n(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _Size __n, _ForwardIterator2 __result)
 {
-    return oneapi::dpl::copy_n(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __n, __result);
+    return ::__pstl_offload::__offload_or_host_n(
+        ::__pstl_offload::__offload_algorithm::__copy_n, __first, __n,
+        [&](const auto& __policy) { return oneapi::dpl::copy_n(__policy, __first, __n, __result); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _Predicate>
@@ -251,9 +263,9 @@ static _ForwardIterator2
 copy_if(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
         _ForwardIterator2 __result, _Predicate __pred)
 {
-    return oneapi::dpl::copy_if(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __result, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__copy_if, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::copy_if(__policy, __first, __last, __result, __pred); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2>
@@ -261,9 +273,9 @@ static _ForwardIterator2
 swap_ranges(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
             _ForwardIterator2 __first2)
 {
-    return oneapi::dpl::swap_ranges(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__swap_ranges, __first1, __last1,
+        [&](const auto& __policy) { return oneapi::dpl::swap_ranges(__policy, __first1, __last1, __first2); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _ForwardIterator, class _BinaryOperation>
@@ -271,9 +283,11 @@ static _ForwardIterator
 transform(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
           _ForwardIterator2 __first2, _ForwardIterator __result, _BinaryOperation __op)
 {
-    return oneapi::dpl::transform(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __result, __op);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__transform, __first1, __last1, __first2,
+        [&](const auto& __policy) {
+            return oneapi::dpl::transform(__policy, __first1, __last1, __first2, __result, __op);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _UnaryOperation>
@@ -281,9 +295,9 @@ static _ForwardIterator2
 transform(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
           _ForwardIterator2 __result, _UnaryOperation __op)
 {
-    return oneapi::dpl::transform(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __result, __op);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__transform, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::transform(__policy, __first, __last, __result, __op); });
 }
 
 template <class _ForwardIterator, class _UnaryPredicate, class _Tp>
@@ -291,9 +305,9 @@ static void
 replace_if(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
            _UnaryPredicate __pred, const _Tp& __new_value)
 {
-    oneapi::dpl::replace_if(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __pred, __new_value);
+    ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__replace_if, __first, __last,
+        [&](const auto& __policy) { oneapi::dpl::replace_if(__policy, __first, __last, __pred, __new_value); });
 }
 
 template <class _ForwardIterator, class _Tp>
@@ -301,9 +315,9 @@ static void
 replace(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
         const _Tp& __old_value, const _Tp& __new_value)
 {
-    oneapi::dpl::replace(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __old_value, __new_value);
+    ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__replace, __first, __last,
+        [&](const auto& __policy) { oneapi::dpl::replace(__policy, __first, __last, __old_value, __new_value); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _UnaryPredicate, class _Tp>
@@ -311,9 +325,11 @@ static _ForwardIterator2
 replace_copy_if(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
                 _ForwardIterator2 __result, _UnaryPredicate __pred, const _Tp& __new_value)
 {
-    return oneapi::dpl::replace_copy_if(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __result, __pred, __new_value);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__replace_copy_if, __first, __last,
+        [&](const auto& __policy) {
+            return oneapi::dpl::replace_copy_if(__policy, __first, __last, __result, __pred, __new_value);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _Tp>
@@ -321,9 +337,11 @@ static _ForwardIterator2
 replace_copy(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
              _ForwardIterator2 __result, const _Tp& __old_value, const _Tp& __new_value)
 {
-    return oneapi::dpl::replace_copy(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __result, __old_value, __new_value);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__replace_copy, __first, __last,
+        [&](const auto& __policy) {
+            return oneapi::dpl::replace_copy(__policy, __first, __last, __result, __old_value, __new_value);
+        });
 }
 
 template <class _ForwardIterator, class _Tp>
@@ -331,18 +349,18 @@ static void
 fill(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
      const _Tp& __value)
 {
-    oneapi::dpl::fill(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __value);
+    ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__fill, __first, __last,
+        [&](const auto& __policy) { oneapi::dpl::fill(__policy, __first, __last, __value); });
 }
 
 template <class _ForwardIterator, class _Size, class _Tp>
 static _ForwardIterator
 fill_n(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _Size __count, const _Tp& __value)
 {
-    return oneapi::dpl::fill_n(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __count, __value);
+    return ::__pstl_offload::__offload_or_host_n(
+        ::__pstl_offload::__offload_algorithm::__fill_n, __first, __count,
+        [&](const auto& __policy) { return oneapi::dpl::fill_n(__policy, __first, __count, __value); });
 }
 
 template <class _ForwardIterator, class _Generator>
@@ -350,18 +368,18 @@ static void
 generate(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
          _Generator __g)
 {
-    oneapi::dpl::generate(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __g);
+    ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__generate, __first, __last,
+        [&](const auto& __policy) { oneapi::dpl::generate(__policy, __first, __last, __g); });
 }
 
 template <class _ForwardIterator, class _Size, class _Generator>
 static _ForwardIterator
 generate_n(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _Size __count, _Generator __g)
 {
-    return oneapi::dpl::generate_n(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __count, __g);
+    return ::__pstl_offload::__offload_or_host_n(
+        ::__pstl_offload::__offload_algorithm::__generate_n, __first, __count,
+        [&](const auto& __policy) { return oneapi::dpl::generate_n(__policy, __first, __count, __g); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _Predicate>
@@ -369,9 +387,9 @@ static _ForwardIterator2
 remove_copy_if(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
                _ForwardIterator2 __result, _Predicate __pred)
 {
-    return oneapi::dpl::remove_copy_if(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __result, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__remove_copy_if, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::remove_copy_if(__policy, __first, __last, __result, __pred); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _Tp>
@@ -379,9 +397,9 @@ static _ForwardIterator2
 remove_copy(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
             _ForwardIterator2 __result, const _Tp& __value)
 {
-    return oneapi::dpl::remove_copy(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __result, __value);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__remove_copy, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::remove_copy(__policy, __first, __last, __result, __value); });
 }
 
 template <class _ForwardIterator, class _UnaryPredicate>
@@ -389,9 +407,9 @@ static _ForwardIterator
 remove_if(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
           _UnaryPredicate __pred)
 {
-    return oneapi::dpl::remove_if(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__remove_if, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::remove_if(__policy, __first, __last, __pred); });
 }
 
 template <class _ForwardIterator, class _Tp>
@@ -399,9 +417,9 @@ static _ForwardIterator
 remove(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
        const _Tp& __value)
 {
-    return oneapi::dpl::remove(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __value);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__remove, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::remove(__policy, __first, __last, __value); });
 }
 
 template <class _ForwardIterator, class _BinaryPredicate>
@@ -409,18 +427,18 @@ static _ForwardIterator
 unique(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
        _BinaryPredicate __pred)
 {
-    return oneapi::dpl::unique(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__unique, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::unique(__policy, __first, __last, __pred); });
 }
 
 template <class _ForwardIterator>
 static _ForwardIterator
 unique(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last)
 {
-    return oneapi::dpl::unique(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__unique, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::unique(__policy, __first, __last); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _BinaryPredicate>
@@ -428,9 +446,9 @@ static _ForwardIterator2
 unique_copy(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
             _ForwardIterator2 __result, _BinaryPredicate __pred)
 {
-    return oneapi::dpl::unique_copy(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __result, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__unique_copy, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::unique_copy(__policy, __first, __last, __result, __pred); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2>
@@ -438,18 +456,18 @@ static _ForwardIterator2
 unique_copy(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
             _ForwardIterator2 __result)
 {
-    return oneapi::dpl::unique_copy(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __result);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__unique_copy, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::unique_copy(__policy, __first, __last, __result); });
 }
 
 template <class _BidirectionalIterator>
 static void
 reverse(const execution::parallel_unsequenced_policy&, _BidirectionalIterator __first, _BidirectionalIterator __last)
 {
-    return oneapi::dpl::reverse(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__reverse, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::reverse(__policy, __first, __last); });
 }
 
 template <class _BidirectionalIterator, class _ForwardIterator>
@@ -457,9 +475,9 @@ static _ForwardIterator
 reverse_copy(const execution::parallel_unsequenced_policy&, _BidirectionalIterator __first,
              _BidirectionalIterator __last, _ForwardIterator __d_first)
 {
-    return oneapi::dpl::reverse_copy(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __d_first);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__reverse_copy, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::reverse_copy(__policy, __first, __last, __d_first); });
 }
 
 template <class _ForwardIterator>
@@ -467,9 +485,9 @@ static _ForwardIterator
 rotate(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __middle,
        _ForwardIterator __last)
 {
-    return oneapi::dpl::rotate(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __middle, __last);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__rotate, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::rotate(__policy, __first, __middle, __last); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2>
@@ -477,9 +495,9 @@ static _ForwardIterator2
 rotate_copy(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __middle,
             _ForwardIterator1 __last, _ForwardIterator2 __result)
 {
-    return oneapi::dpl::rotate_copy(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __middle, __last, __result);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__rotate_copy, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::rotate_copy(__policy, __first, __middle, __last, __result); });
 }
 
 template <class _ForwardIterator, class _UnaryPredicate>
@@ -487,9 +505,9 @@ static bool
 is_partitioned(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
                _UnaryPredicate __pred)
 {
-    return oneapi::dpl::is_partitioned(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__is_partitioned, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::is_partitioned(__policy, __first, __last, __pred); });
 }
 
 template <class _ForwardIterator, class _UnaryPredicate>
@@ -497,9 +515,9 @@ static _ForwardIterator
 partition(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
           _UnaryPredicate __pred)
 {
-    return oneapi::dpl::partition(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__partition, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::partition(__policy, __first, __last, __pred); });
 }
 
 template <class _BidirectionalIterator, class _UnaryPredicate>
@@ -507,9 +525,9 @@ static _BidirectionalIterator
 stable_partition(const execution::parallel_unsequenced_policy&, _BidirectionalIterator __first,
                  _BidirectionalIterator __last, _UnaryPredicate __pred)
 {
-    return oneapi::dpl::stable_partition(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__stable_partition, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::stable_partition(__policy, __first, __last, __pred); });
 }
 
 template <class _ForwardIterator, class _ForwardIterator1, class _ForwardIterator2, class _UnaryPredicate>
@@ -517,9 +535,11 @@ static pair<_ForwardIterator1, _ForwardIterator2>
 partition_copy(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
                _ForwardIterator1 __out_true, _ForwardIterator2 __out_false, _UnaryPredicate __pred)
 {
-    return oneapi::dpl::partition_copy(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __out_true, __out_false, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__partition_copy, __first, __last,
+        [&](const auto& __policy) {
+            return oneapi::dpl::partition_copy(__policy, __first, __last, __out_true, __out_false, __pred);
+        });
 }
 
 template <class _RandomAccessIterator, class _Compare>
@@ -527,18 +547,18 @@ static void
 sort(const execution::parallel_unsequenced_policy&, _RandomAccessIterator __first, _RandomAccessIterator __last,
      _Compare __comp)
 {
-    oneapi::dpl::sort(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __comp);
+    ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__sort, __first, __last,
+        [&](const auto& __policy) { oneapi::dpl::sort(__policy, __first, __last, __comp); });
 }
 
 template <class _RandomAccessIterator>
 static void
 sort(const execution::parallel_unsequenced_policy&, _RandomAccessIterator __first, _RandomAccessIterator __last)
 {
-    oneapi::dpl::sort(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last);
+    ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__sort, __first, __last,
+        [&](const auto& __policy) { oneapi::dpl::sort(__policy, __first, __last); });
 }
 
 template <class _RandomAccessIterator, class _Compare>
@@ -546,18 +566,18 @@ static void
 stable_sort(const execution::parallel_unsequenced_policy&, _RandomAccessIterator __first, _RandomAccessIterator __last,
             _Compare __comp)
 {
-    oneapi::dpl::stable_sort(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __comp);
+    ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__stable_sort, __first, __last,
+        [&](const auto& __policy) { oneapi::dpl::stable_sort(__policy, __first, __last, __comp); });
 }
 
 template <class _RandomAccessIterator>
 static void
 stable_sort(const execution::parallel_unsequenced_policy&, _RandomAccessIterator __first, _RandomAccessIterator __last)
 {
-    oneapi::dpl::stable_sort(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last);
+    ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__stable_sort, __first, __last,
+        [&](const auto& __policy) { oneapi::dpl::stable_sort(__policy, __first, __last); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _BinaryPredicate>
@@ -565,9 +585,11 @@ static pair<_ForwardIterator1, _ForwardIterator2>
 mismatch(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
          _ForwardIterator2 __first2, _ForwardIterator2 __last2, _BinaryPredicate __pred)
 {
-    return oneapi::dpl::mismatch(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __last2, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__mismatch, __first1, __last1,
+        [&](const auto& __policy) {
+            return oneapi::dpl::mismatch(__policy, __first1, __last1, __first2, __last2, __pred);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _BinaryPredicate>
@@ -575,9 +597,9 @@ static pair<_ForwardIterator1, _ForwardIterator2>
 mismatch(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
          _ForwardIterator2 __first2, _BinaryPredicate __pred)
 {
-    return oneapi::dpl::mismatch(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__mismatch, __first1, __last1,
+        [&](const auto& __policy) { return oneapi::dpl::mismatch(__policy, __first1, __last1, __first2, __pred); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2>
@@ -585,9 +607,9 @@ static pair<_ForwardIterator1, _ForwardIterator2>
 mismatch(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
          _ForwardIterator2 __first2, _ForwardIterator2 __last2)
 {
-    return oneapi::dpl::mismatch(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __last2);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__mismatch, __first1, __last1,
+        [&](const auto& __policy) { return oneapi::dpl::mismatch(__policy, __first1, __last1, __first2, __last2); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2>
@@ -595,9 +617,9 @@ static pair<_ForwardIterator1, _ForwardIterator2>
 mismatch(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
          _ForwardIterator2 __first2)
 {
-    return oneapi::dpl::mismatch(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__mismatch, __first1, __last1,
+        [&](const auto& __policy) { return oneapi::dpl::mismatch(__policy, __first1, __last1, __first2); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _BinaryPredicate>
@@ -605,9 +627,9 @@ static bool
 equal(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
       _ForwardIterator2 __first2, _BinaryPredicate __pred)
 {
-    return oneapi::dpl::equal(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__equal, __first1, __last1, __first2,
+        [&](const auto& __policy) { return oneapi::dpl::equal(__policy, __first1, __last1, __first2, __pred); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2>
@@ -615,9 +637,9 @@ static bool
 equal(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
       _ForwardIterator2 __first2)
 {
-    return oneapi::dpl::equal(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__equal, __first1, __last1, __first2,
+        [&](const auto& __policy) { return oneapi::dpl::equal(__policy, __first1, __last1, __first2); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _BinaryPredicate>
@@ -625,9 +647,11 @@ static bool
 equal(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
       _ForwardIterator2 __first2, _ForwardIterator2 __last2, _BinaryPredicate __pred)
 {
-    return oneapi::dpl::equal(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __last2, __pred);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__equal, __first1, __last1, __first2, __last2,
+        [&](const auto& __policy) {
+            return oneapi::dpl::equal(__policy, __first1, __last1, __first2, __last2, __pred);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2>
@@ -635,9 +659,9 @@ static bool
 equal(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
       _ForwardIterator2 __first2, _ForwardIterator2 __last2)
 {
-    return oneapi::dpl::equal(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __last2);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__equal, __first1, __last1, __first2, __last2,
+        [&](const auto& __policy) { return oneapi::dpl::equal(__policy, __first1, __last1, __first2, __last2); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2>
@@ -645,9 +669,9 @@ static _ForwardIterator2
 move(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
      _ForwardIterator2 __d_first)
 {
-    return oneapi::dpl::move(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __d_first);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__move, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::move(__policy, __first, __last, __d_first); });
 }
 
 template <class _RandomAccessIterator, class _Compare>
@@ -655,9 +679,9 @@ static void
 partial_sort(const execution::parallel_unsequenced_policy&, _RandomAccessIterator __first,
              _RandomAccessIterator __middle, _RandomAccessIterator __last, _Compare __comp)
 {
-    oneapi::dpl::partial_sort(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __middle, __last, __comp);
+    ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__partial_sort, __first, __last,
+        [&](const auto& __policy) { oneapi::dpl::partial_sort(__policy, __first, __middle, __last, __comp); });
 }
 
 template <class _RandomAccessIterator>
@@ -665,9 +689,9 @@ static void
 partial_sort(const execution::parallel_unsequenced_policy&, _RandomAccessIterator __first,
              _RandomAccessIterator __middle, _RandomAccessIterator __last)
 {
-    oneapi::dpl::partial_sort(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __middle, __last);
+    ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__partial_sort, __first, __last,
+        [&](const auto& __policy) { oneapi::dpl::partial_sort(__policy, __first, __middle, __last); });
 }
 
 template <class _ForwardIterator, class _RandomAccessIterator, class _Compare>
@@ -675,9 +699,11 @@ static _RandomAccessIterator
 partial_sort_copy(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
                   _RandomAccessIterator __d_first, _RandomAccessIterator __d_last, _Compare __comp)
 {
-    return oneapi::dpl::partial_sort_copy(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __d_first, __d_last, __comp);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__partial_sort_copy, __first, __last,
+        [&](const auto& __policy) {
+            return oneapi::dpl::partial_sort_copy(__policy, __first, __last, __d_first, __d_last, __comp);
+        });
 }
 
 template <class _ForwardIterator, class _RandomAccessIterator>
@@ -685,9 +711,11 @@ static _RandomAccessIterator
 partial_sort_copy(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
                   _RandomAccessIterator __d_first, _RandomAccessIterator __d_last)
 {
-    return oneapi::dpl::partial_sort_copy(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __d_first, __d_last);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__partial_sort_copy, __first, __last,
+        [&](const auto& __policy) {
+            return oneapi::dpl::partial_sort_copy(__policy, __first, __last, __d_first, __d_last);
+        });
 }
 
 template <class _ForwardIterator, class _Compare>
@@ -695,18 +723,18 @@ static _ForwardIterator
 is_sorted_until(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
                 _Compare __comp)
 {
-    return oneapi::dpl::is_sorted_until(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __comp);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__is_sorted_until, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::is_sorted_until(__policy, __first, __last, __comp); });
 }
 
 template <class _ForwardIterator>
 static _ForwardIterator
 is_sorted_until(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last)
 {
-    return oneapi::dpl::is_sorted_until(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__is_sorted_until, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::is_sorted_until(__policy, __first, __last); });
 }
 
 template <class _ForwardIterator, class _Compare>
@@ -714,18 +742,18 @@ static bool
 is_sorted(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
           _Compare __comp)
 {
-    return oneapi::dpl::is_sorted(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __comp);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__is_sorted, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::is_sorted(__policy, __first, __last, __comp); });
 }
 
 template <class _ForwardIterator>
 static bool
 is_sorted(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last)
 {
-    return oneapi::dpl::is_sorted(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__is_sorted, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::is_sorted(__policy, __first, __last); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _ForwardIterator, class _Compare>
@@ -733,9 +761,11 @@ static _ForwardIterator
 merge(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
       _ForwardIterator2 __first2, _ForwardIterator2 __last2, _ForwardIterator __d_first, _Compare __comp)
 {
-    return oneapi::dpl::merge(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __last2, __d_first, __comp);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__merge, __first1, __last1, __first2, __last2,
+        [&](const auto& __policy) {
+            return oneapi::dpl::merge(__policy, __first1, __last1, __first2, __last2, __d_first, __comp);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _ForwardIterator>
@@ -743,9 +773,11 @@ static _ForwardIterator
 merge(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
       _ForwardIterator2 __first2, _ForwardIterator2 __last2, _ForwardIterator __d_first)
 {
-    return oneapi::dpl::merge(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __last2, __d_first);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__merge, __first1, __last1, __first2, __last2,
+        [&](const auto& __policy) {
+            return oneapi::dpl::merge(__policy, __first1, __last1, __first2, __last2, __d_first);
+        });
 }
 
 template <class _BidirectionalIterator, class _Compare>
@@ -753,9 +785,9 @@ static void
 inplace_merge(const execution::parallel_unsequenced_policy&, _BidirectionalIterator __first,
               _BidirectionalIterator __middle, _BidirectionalIterator __last, _Compare __comp)
 {
-    oneapi::dpl::inplace_merge(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __middle, __last, __comp);
+    ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__inplace_merge, __first, __last,
+        [&](const auto& __policy) { oneapi::dpl::inplace_merge(__policy, __first, __middle, __last, __comp); });
 }
 
 template <class _BidirectionalIterator>
@@ -763,9 +795,9 @@ static void
 inplace_merge(const execution::parallel_unsequenced_policy&, _BidirectionalIterator __first,
               _BidirectionalIterator __middle, _BidirectionalIterator __last)
 {
-    oneapi::dpl::inplace_merge(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __middle, __last);
+    ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__inplace_merge, __first, __last,
+        [&](const auto& __policy) { oneapi::dpl::inplace_merge(__policy, __first, __middle, __last); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _Compare>
@@ -773,9 +805,11 @@ static bool
 includes(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
          _ForwardIterator2 __first2, _ForwardIterator2 __last2, _Compare __comp)
 {
-    return oneapi::dpl::includes(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __last2, __comp);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__includes, __first1, __last1,
+        [&](const auto& __policy) {
+            return oneapi::dpl::includes(__policy, __first1, __last1, __first2, __last2, __comp);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2>
@@ -783,9 +817,9 @@ static bool
 includes(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
          _ForwardIterator2 __first2, _ForwardIterator2 __last2)
 {
-    return oneapi::dpl::includes(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __last2);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__includes, __first1, __last1,
+        [&](const auto& __policy) { return oneapi::dpl::includes(__policy, __first1, __last1, __first2, __last2); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _ForwardIterator, class _Compare>
@@ -793,9 +827,11 @@ static _ForwardIterator
 set_union(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
           _ForwardIterator2 __first2, _ForwardIterator2 __last2, _ForwardIterator __result, _Compare __comp)
 {
-    return oneapi::dpl::set_union(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __last2, __result, __comp);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__set_union, __first1, __last1,
+        [&](const auto& __policy) {
+            return oneapi::dpl::set_union(__policy, __first1, __last1, __first2, __last2, __result, __comp);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _ForwardIterator>
@@ -803,9 +839,11 @@ static _ForwardIterator
 set_union(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
           _ForwardIterator2 __first2, _ForwardIterator2 __last2, _ForwardIterator __result)
 {
-    return oneapi::dpl::set_union(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __last2, __result);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__set_union, __first1, __last1,
+        [&](const auto& __policy) {
+            return oneapi::dpl::set_union(__policy, __first1, __last1, __first2, __last2, __result);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _ForwardIterator, class _Compare>
@@ -813,9 +851,11 @@ static _ForwardIterator
 set_intersection(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
                  _ForwardIterator2 __first2, _ForwardIterator2 __last2, _ForwardIterator __result, _Compare __comp)
 {
-    return oneapi::dpl::set_intersection(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __last2, __result, __comp);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__set_intersection, __first1, __last1,
+        [&](const auto& __policy) {
+            return oneapi::dpl::set_intersection(__policy, __first1, __last1, __first2, __last2, __result, __comp);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _ForwardIterator>
@@ -823,9 +863,11 @@ static _ForwardIterator
 set_intersection(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
                  _ForwardIterator2 __first2, _ForwardIterator2 __last2, _ForwardIterator __result)
 {
-    return oneapi::dpl::set_intersection(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __last2, __result);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__set_intersection, __first1, __last1,
+        [&](const auto& __policy) {
+            return oneapi::dpl::set_intersection(__policy, __first1, __last1, __first2, __last2, __result);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _ForwardIterator, class _Compare>
@@ -833,9 +875,11 @@ static _ForwardIterator
 set_difference(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
                _ForwardIterator2 __first2, _ForwardIterator2 __last2, _ForwardIterator __result, _Compare __comp)
 {
-    return oneapi::dpl::set_difference(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __last2, __result, __comp);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__set_difference, __first1, __last1,
+        [&](const auto& __policy) {
+            return oneapi::dpl::set_difference(__policy, __first1, __last1, __first2, __last2, __result, __comp);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _ForwardIterator>
@@ -843,9 +887,11 @@ static _ForwardIterator
 set_difference(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
                _ForwardIterator2 __first2, _ForwardIterator2 __last2, _ForwardIterator __result)
 {
-    return oneapi::dpl::set_difference(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __last2, __result);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__set_difference, __first1, __last1,
+        [&](const auto& __policy) {
+            return oneapi::dpl::set_difference(__policy, __first1, __last1, __first2, __last2, __result);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _ForwardIterator, class _Compare>
@@ -854,9 +900,12 @@ set_symmetric_difference(const execution::parallel_unsequenced_policy&, _Forward
                          _ForwardIterator1 __last1, _ForwardIterator2 __first2, _ForwardIterator2 __last2,
                          _ForwardIterator __result, _Compare __comp)
 {
-    return oneapi::dpl::set_symmetric_difference(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __last2, __result, __comp);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__set_symmetric_difference, __first1, __last1,
+        [&](const auto& __policy) {
+            return oneapi::dpl::set_symmetric_difference(__policy, __first1, __last1, __first2, __last2, __result,
+                                                         __comp);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _ForwardIterator>
@@ -865,9 +914,11 @@ set_symmetric_difference(const execution::parallel_unsequenced_policy&, _Forward
                          _ForwardIterator1 __last1, _ForwardIterator2 __first2, _ForwardIterator2 __last2,
                          _ForwardIterator __result)
 {
-    return oneapi::dpl::set_symmetric_difference(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __last2, __result);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__set_symmetric_difference, __first1, __last1,
+        [&](const auto& __policy) {
+            return oneapi::dpl::set_symmetric_difference(__policy, __first1, __last1, __first2, __last2, __result);
+        });
 }
 
 template <class _RandomAccessIterator, class _Compare>
@@ -875,9 +926,9 @@ static _RandomAccessIterator
 is_heap_until(const execution::parallel_unsequenced_policy&, _RandomAccessIterator __first,
               _RandomAccessIterator __last, _Compare __comp)
 {
-    return oneapi::dpl::is_heap_until(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __comp);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__is_heap_until, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::is_heap_until(__policy, __first, __last, __comp); });
 }
 
 template <class _RandomAccessIterator>
@@ -885,9 +936,9 @@ static _RandomAccessIterator
 is_heap_until(const execution::parallel_unsequenced_policy&, _RandomAccessIterator __first,
               _RandomAccessIterator __last)
 {
-    return oneapi::dpl::is_heap_until(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__is_heap_until, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::is_heap_until(__policy, __first, __last); });
 }
 
 template <class _RandomAccessIterator, class _Compare>
@@ -895,18 +946,18 @@ static bool
 is_heap(const execution::parallel_unsequenced_policy&, _RandomAccessIterator __first, _RandomAccessIterator __last,
         _Compare __comp)
 {
-    return oneapi::dpl::is_heap(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __comp);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__is_heap, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::is_heap(__policy, __first, __last, __comp); });
 }
 
 template <class _RandomAccessIterator>
 static bool
 is_heap(const execution::parallel_unsequenced_policy&, _RandomAccessIterator __first, _RandomAccessIterator __last)
 {
-    return oneapi::dpl::is_heap(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__is_heap, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::is_heap(__policy, __first, __last); });
 }
 
 template <class _ForwardIterator, class _Compare>
@@ -914,18 +965,18 @@ static _ForwardIterator
 min_element(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
             _Compare __comp)
 {
-    return oneapi::dpl::min_element(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __comp);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__min_element, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::min_element(__policy, __first, __last, __comp); });
 }
 
 template <class _ForwardIterator>
 static _ForwardIterator
 min_element(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last)
 {
-    return oneapi::dpl::min_element(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__min_element, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::min_element(__policy, __first, __last); });
 }
 
 template <class _ForwardIterator, class _Compare>
@@ -933,18 +984,18 @@ static _ForwardIterator
 max_element(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
             _Compare __comp)
 {
-    return oneapi::dpl::max_element(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __comp);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__max_element, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::max_element(__policy, __first, __last, __comp); });
 }
 
 template <class _ForwardIterator>
 static _ForwardIterator
 max_element(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last)
 {
-    return oneapi::dpl::max_element(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__max_element, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::max_element(__policy, __first, __last); });
 }
 
 template <class _ForwardIterator, class _Compare>
@@ -952,18 +1003,18 @@ static pair<_ForwardIterator, _ForwardIterator>
 minmax_element(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
                _Compare __comp)
 {
-    return oneapi::dpl::minmax_element(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __comp);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__minmax_element, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::minmax_element(__policy, __first, __last, __comp); });
 }
 
 template <class _ForwardIterator>
 static pair<_ForwardIterator, _ForwardIterator>
 minmax_element(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last)
 {
-    return oneapi::dpl::minmax_element(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__minmax_element, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::minmax_element(__policy, __first, __last); });
 }
 
 template <class _RandomAccessIterator, class _Compare>
@@ -971,9 +1022,9 @@ static void
 nth_element(const execution::parallel_unsequenced_policy&, _RandomAccessIterator __first, _RandomAccessIterator __nth,
             _RandomAccessIterator __last, _Compare __comp)
 {
-    return oneapi::dpl::nth_element(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __nth, __last, __comp);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__nth_element, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::nth_element(__policy, __first, __nth, __last, __comp); });
 }
 
 template <class _RandomAccessIterator>
@@ -981,9 +1032,9 @@ static void
 nth_element(const execution::parallel_unsequenced_policy&, _RandomAccessIterator __first, _RandomAccessIterator __nth,
             _RandomAccessIterator __last)
 {
-    return oneapi::dpl::nth_element(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __nth, __last);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__nth_element, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::nth_element(__policy, __first, __nth, __last); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _Compare>
@@ -992,9 +1043,11 @@ lexicographical_compare(const execution::parallel_unsequenced_policy&, _ForwardI
                         _ForwardIterator1 __last1, _ForwardIterator2 __first2, _ForwardIterator2 __last2,
                         _Compare __comp)
 {
-    return oneapi::dpl::lexicographical_compare(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __last2, __comp);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__lexicographical_compare, __first1, __last1,
+        [&](const auto& __policy) {
+            return oneapi::dpl::lexicographical_compare(__policy, __first1, __last1, __first2, __last2, __comp);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2>
@@ -1002,9 +1055,11 @@ static bool
 lexicographical_compare(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1,
                         _ForwardIterator1 __last1, _ForwardIterator2 __first2, _ForwardIterator2 __last2)
 {
-    return oneapi::dpl::lexicographical_compare(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __last2);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__lexicographical_compare, __first1, __last1,
+        [&](const auto& __policy) {
+            return oneapi::dpl::lexicographical_compare(__policy, __first1, __last1, __first2, __last2);
+        });
 }
 
 template <class _ForwardIterator>
@@ -1012,9 +1067,9 @@ static _ForwardIterator
 shift_left(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
            typename iterator_traits<_ForwardIterator>::difference_type __n)
 {
-    return oneapi::dpl::shift_left(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __n);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__shift_left, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::shift_left(__policy, __first, __last, __n); });
 }
 
 template <class _ForwardIterator>
@@ -1022,9 +1077,9 @@ static _ForwardIterator
 shift_right(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
             typename iterator_traits<_ForwardIterator>::difference_type __n)
 {
-    return oneapi::dpl::shift_right(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __n);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__shift_right, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::shift_right(__policy, __first, __last, __n); });
 }
 
 } // namespace std
@@ -19,11 +19,13 @@
 #include <oneapi/dpl/memory>
 
 #include "usm_memory_replacement.h"
+#include "offload_heuristic.h"
 
 namespace std
 {
 
-// All the algorithms below get the policy from static __offload_policy_holder object.
+// All the algorithms below get the policy from static __offload_policy_holder object,
+// unless the sequence is too short to be worth the offload (see offload_heuristic.h).
 // They needs to be explicitly marked static because, otherwise, function templates behave
 // like inline that can result in using only one device in all translation units no matter which
 // PSTL offload option argument was used for the particular translation unit compilation
@@ -33,9 +35,9 @@ static _ForwardIterator
 uninitialized_copy(const execution::parallel_unsequenced_policy&, _InputIterator __first, _InputIterator __last,
                    _ForwardIterator __result)
 {
-    return oneapi::dpl::uninitialized_copy(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __result);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__uninitialized_copy, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::uninitialized_copy(__policy, __first, __last, __result); });
 }
 
 template <class _InputIterator, class _Size, class _ForwardIterator>
@@ -43,9 +45,9 @@ static _ForwardIterator
 uninitialized_copy_n(const execution::parallel_unsequenced_policy&, _InputIterator __first, _Size __n,
                      _ForwardIterator __result)
 {
-    return oneapi::dpl::uninitialized_copy_n(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __n, __result);
+    return ::__pstl_offload::__offload_or_host_n(
+        ::__pstl_offload::__offload_algorithm::__uninitialized_copy_n, __first, __n,
+        [&](const auto& __policy) { return oneapi::dpl::uninitialized_copy_n(__policy, __first, __n, __result); });
 }
 
 template <class _InputIterator, class _ForwardIterator>
@@ -53,9 +55,9 @@ static _ForwardIterator
 uninitialized_move(const execution::parallel_unsequenced_policy&, _InputIterator __first, _InputIterator __last,
                    _ForwardIterator __result)
 {
-    return oneapi::dpl::uninitialized_move(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __result);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__uninitialized_move, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::uninitialized_move(__policy, __first, __last, __result); });
 }
 
 template <class _InputIterator, class _Size, class _ForwardIterator>
@@ -63,9 +65,9 @@ static _ForwardIterator
 uninitialized_move_n(const execution::parallel_unsequenced_policy&, _InputIterator __first, _Size __n,
                      _ForwardIterator __result)
 {
-    return oneapi::dpl::uninitialized_move_n(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __n, __result);
+    return ::__pstl_offload::__offload_or_host_n(
+        ::__pstl_offload::__offload_algorithm::__uninitialized_move_n, __first, __n,
+        [&](const auto& __policy) { return oneapi::dpl::uninitialized_move_n(__policy, __first, __n, __result); });
 }
 
 template <class _ForwardIterator, class _Tp>
@@ -73,9 +75,9 @@ static void
 uninitialized_fill(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
                    const _Tp& __value)
 {
-    oneapi::dpl::uninitialized_fill(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __value);
+    ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__uninitialized_fill, __first, __last,
+        [&](const auto& __policy) { oneapi::dpl::uninitialized_fill(__policy, __first, __last, __value); });
 }
 
 template <class _ForwardIterator, class _Size, class _Tp>
@@ -83,27 +85,27 @@ static _ForwardIterator
 uninitialized_fill_n(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _Size __n,
                      const _Tp& __value)
 {
-    return oneapi::dpl::uninitialized_fill_n(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __n, __value);
+    return ::__pstl_offload::__offload_or_host_n(
+        ::__pstl_offload::__offload_algorithm::__uninitialized_fill_n, __first, __n,
+        [&](const auto& __policy) { return oneapi::dpl::uninitialized_fill_n(__policy, __first, __n, __value); });
 }
 
 template <class _ForwardIterator>
 static void
 destroy(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last)
 {
-    oneapi::dpl::destroy(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last);
+    ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__destroy, __first, __last,
+        [&](const auto& __policy) { oneapi::dpl::destroy(__policy, __first, __last); });
 }
 
 template <class _ForwardIterator, class _Size>
 static void
 destroy_n(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _Size __n)
 {
-    oneapi::dpl::destroy_n(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __n);
+    ::__pstl_offload::__offload_or_host_n(
+        ::__pstl_offload::__offload_algorithm::__destroy_n, __first, __n,
+        [&](const auto& __policy) { oneapi::dpl::destroy_n(__policy, __first, __n); });
 }
 
 template <class _ForwardIterator>
@@ -111,18 +113,18 @@ static void
 uninitialized_default_construct(const execution::parallel_unsequenced_policy&, _ForwardIterator __first,
                                 _ForwardIterator __last)
 {
-    oneapi::dpl::uninitialized_default_construct(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last);
+    ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__uninitialized_default_construct, __first, __last,
+        [&](const auto& __policy) { oneapi::dpl::uninitialized_default_construct(__policy, __first, __last); });
 }
 
 template <class _ForwardIterator, class _Size>
 static void
 uninitialized_default_construct_n(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _Size __n)
 {
-    oneapi::dpl::uninitialized_default_construct_n(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __n);
+    ::__pstl_offload::__offload_or_host_n(
+        ::__pstl_offload::__offload_algorithm::__uninitialized_default_construct_n, __first, __n,
+        [&](const auto& __policy) { oneapi::dpl::uninitialized_default_construct_n(__policy, __first, __n); });
 }
 
 template <class _ForwardIterator>
@@ -130,18 +132,18 @@ static void
 uninitialized_value_construct(const execution::parallel_unsequenced_policy&, _ForwardIterator __first,
                               _ForwardIterator __last)
 {
-    oneapi::dpl::uninitialized_value_construct(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last);
+    ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__uninitialized_value_construct, __first, __last,
+        [&](const auto& __policy) { oneapi::dpl::uninitialized_value_construct(__policy, __first, __last); });
 }
 
 template <class _ForwardIterator, class _Size>
 static void
 uninitialized_value_construct_n(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _Size __n)
 {
-    oneapi::dpl::uninitialized_value_construct_n(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __n);
+    ::__pstl_offload::__offload_or_host_n(
+        ::__pstl_offload::__offload_algorithm::__uninitialized_value_construct_n, __first, __n,
+        [&](const auto& __policy) { oneapi::dpl::uninitialized_value_construct_n(__policy, __first, __n); });
 }
 
 } // namespace std
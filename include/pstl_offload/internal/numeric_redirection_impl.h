@@ -19,11 +19,13 @@
 #include <oneapi/dpl/numeric>
 
 #include "usm_memory_replacement.h"
+#include "offload_heuristic.h"
 
 namespace std
 {
 
-// All the algorithms below get the policy from static __offload_policy_holder object.
+// All the algorithms below get the policy from static __offload_policy_holder object,
+// unless the sequence is too short to be worth the offload (see offload_heuristic.h).
 // They needs to be explicitly marked static because, otherwise, function templates behave
 // like inline that can result in using only one device in all translation units no matter which
 // PSTL offload option argument was used for the particular translation unit compilation
@@ -33,27 +35,27 @@ static _Tp
 reduce(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last, _Tp __init,
        _BinaryOperation __binary_op)
 {
-    return oneapi::dpl::reduce(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __init, __binary_op);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__reduce, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::reduce(__policy, __first, __last, __init, __binary_op); });
 }
 
 template <class _ForwardIterator, class _Tp>
 static _Tp
 reduce(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last, _Tp __init)
 {
-    return oneapi::dpl::reduce(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __init);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__reduce, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::reduce(__policy, __first, __last, __init); });
 }
 
 template <class _ForwardIterator>
 static typename iterator_traits<_ForwardIterator>::value_type
 reduce(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last)
 {
-    return oneapi::dpl::reduce(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__reduce, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::reduce(__policy, __first, __last); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _Tp>
@@ -61,9 +63,11 @@ static _Tp
 transform_reduce(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
                  _ForwardIterator2 __first2, _Tp __init)
 {
-    return oneapi::dpl::transform_reduce(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __init);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__transform_reduce, __first1, __last1,
+        [&](const auto& __policy) {
+            return oneapi::dpl::transform_reduce(__policy, __first1, __last1, __first2, __init);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _Tp, class _BinaryOperation1, class _BinaryOperation2>
@@ -71,9 +75,12 @@ static _Tp
 transform_reduce(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first1, _ForwardIterator1 __last1,
                  _ForwardIterator2 __first2, _Tp __init, _BinaryOperation1 __binary_op1, _BinaryOperation2 __binary_op2)
 {
-    return oneapi::dpl::transform_reduce(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first1, __last1, __first2, __init, __binary_op1, __binary_op2);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__transform_reduce, __first1, __last1,
+        [&](const auto& __policy) {
+            return oneapi::dpl::transform_reduce(__policy, __first1, __last1, __first2, __init, __binary_op1,
+                                                 __binary_op2);
+        });
 }
 
 template <class _ForwardIterator, class _Tp, class _BinaryOperation, class _UnaryOperation>
@@ -81,9 +88,11 @@ static _Tp
 transform_reduce(const execution::parallel_unsequenced_policy&, _ForwardIterator __first, _ForwardIterator __last,
                  _Tp __init, _BinaryOperation __binary_op, _UnaryOperation __unary_op)
 {
-    return oneapi::dpl::transform_reduce(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __init, __binary_op, __unary_op);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__transform_reduce, __first, __last,
+        [&](const auto& __policy) {
+            return oneapi::dpl::transform_reduce(__policy, __first, __last, __init, __binary_op, __unary_op);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _Tp>
@@ -91,9 +100,11 @@ static _ForwardIterator2
 exclusive_scan(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
                _ForwardIterator2 __d_first, _Tp __init)
 {
-    return oneapi::dpl::exclusive_scan(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __d_first, __init);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__exclusive_scan, __first, __last,
+        [&](const auto& __policy) {
+            return oneapi::dpl::exclusive_scan(__policy, __first, __last, __d_first, __init);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _Tp, class _BinaryOperation>
@@ -101,9 +112,11 @@ static _ForwardIterator2
 exclusive_scan(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
                _ForwardIterator2 __d_first, _Tp __init, _BinaryOperation __binary_op)
 {
-    return oneapi::dpl::exclusive_scan(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __d_first, __init, __binary_op);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__exclusive_scan, __first, __last,
+        [&](const auto& __policy) {
+            return oneapi::dpl::exclusive_scan(__policy, __first, __last, __d_first, __init, __binary_op);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2>
@@ -111,9 +124,9 @@ static _ForwardIterator2
 inclusive_scan(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
                _ForwardIterator2 __result)
 {
-    return oneapi::dpl::inclusive_scan(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __result);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__inclusive_scan, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::inclusive_scan(__policy, __first, __last, __result); });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _BinaryOperation>
@@ -121,9 +134,11 @@ static _ForwardIterator2
 inclusive_scan(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
                _ForwardIterator2 __result, _BinaryOperation __binary_op)
 {
-    return oneapi::dpl::inclusive_scan(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __result, __binary_op);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__inclusive_scan, __first, __last,
+        [&](const auto& __policy) {
+            return oneapi::dpl::inclusive_scan(__policy, __first, __last, __result, __binary_op);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _Tp, class _BinaryOperation>
@@ -131,9 +146,11 @@ static _ForwardIterator2
 inclusive_scan(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
                _ForwardIterator2 __result, _BinaryOperation __binary_op, _Tp __init)
 {
-    return oneapi::dpl::inclusive_scan(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __result, __binary_op, __init);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__inclusive_scan, __first, __last,
+        [&](const auto& __policy) {
+            return oneapi::dpl::inclusive_scan(__policy, __first, __last, __result, __binary_op, __init);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _Tp, class _BinaryOperation, class _UnaryOperation>
@@ -142,9 +159,12 @@ transform_exclusive_scan(const execution::parallel_unsequenced_policy&, _Forward
                          _ForwardIterator1 __last, _ForwardIterator2 __result, _Tp __init, _BinaryOperation __binary_op,
                          _UnaryOperation __unary_op)
 {
-    return oneapi::dpl::transform_exclusive_scan(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __result, __init, __binary_op, __unary_op);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__transform_exclusive_scan, __first, __last,
+        [&](const auto& __policy) {
+            return oneapi::dpl::transform_exclusive_scan(__policy, __first, __last, __result, __init, __binary_op,
+                                                         __unary_op);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _BinaryOperation, class _UnaryOperation, class _Tp>
@@ -153,9 +173,12 @@ transform_inclusive_scan(const execution::parallel_unsequenced_policy&, _Forward
                          _ForwardIterator1 __last, _ForwardIterator2 __result, _BinaryOperation __binary_op,
                          _UnaryOperation __unary_op, _Tp __init)
 {
-    return oneapi::dpl::transform_inclusive_scan(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __result, __binary_op, __unary_op, __init);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__transform_inclusive_scan, __first, __last,
+        [&](const auto& __policy) {
+            return oneapi::dpl::transform_inclusive_scan(__policy, __first, __last, __result, __binary_op, __unary_op,
+                                                         __init);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _UnaryOperation, class _BinaryOperation>
@@ -164,9 +187,11 @@ transform_inclusive_scan(const execution::parallel_unsequenced_policy&, _Forward
                          _ForwardIterator1 __last, _ForwardIterator2 __result, _BinaryOperation __binary_op,
                          _UnaryOperation __unary_op)
 {
-    return oneapi::dpl::transform_inclusive_scan(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __result, __binary_op, __unary_op);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__transform_inclusive_scan, __first, __last,
+        [&](const auto& __policy) {
+            return oneapi::dpl::transform_inclusive_scan(__policy, __first, __last, __result, __binary_op, __unary_op);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2, class _BinaryOperation>
@@ -174,9 +199,11 @@ static _ForwardIterator2
 adjacent_difference(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
                     _ForwardIterator2 __d_first, _BinaryOperation __op)
 {
-    return oneapi::dpl::adjacent_difference(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __d_first, __op);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__adjacent_difference, __first, __last,
+        [&](const auto& __policy) {
+            return oneapi::dpl::adjacent_difference(__policy, __first, __last, __d_first, __op);
+        });
 }
 
 template <class _ForwardIterator1, class _ForwardIterator2>
@@ -184,9 +211,9 @@ static _ForwardIterator2
 adjacent_difference(const execution::parallel_unsequenced_policy&, _ForwardIterator1 __first, _ForwardIterator1 __last,
                     _ForwardIterator2 __d_first)
 {
-    return oneapi::dpl::adjacent_difference(
-        ::__pstl_offload::__offload_policy_holder_type::__get_policy(::__pstl_offload::__offload_policy_holder),
-        __first, __last, __d_first);
+    return ::__pstl_offload::__offload_or_host(
+        ::__pstl_offload::__offload_algorithm::__adjacent_difference, __first, __last,
+        [&](const auto& __policy) { return oneapi::dpl::adjacent_difference(__policy, __first, __last, __d_first); });
 }
 
 } // namespace std
@@ -0,0 +1,437 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) 2023 Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifndef _ONEDPL_PSTL_OFFLOAD_INTERNAL_OFFLOAD_HEURISTIC_H
+#define _ONEDPL_PSTL_OFFLOAD_INTERNAL_OFFLOAD_HEURISTIC_H
+
+#if !__SYCL_PSTL_OFFLOAD__
+#    error "PSTL offload compiler mode should be enabled to use this header"
+#endif
+
+#include <array>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+
+#include <oneapi/dpl/execution>
+
+#include "usm_memory_replacement.h"
+
+namespace __pstl_offload
+{
+
+// A kernel submission and the migration of the shared memory cost more than a small algorithm run on the host,
+// so the sequences shorter than a threshold of the algorithm, in elements or in bytes, are processed with the
+// host par_unseq policy rather than offloaded.
+
+enum class __offload_algorithm : std::size_t
+{
+    __any_of,
+    __all_of,
+    __none_of,
+    __for_each,
+    __for_each_n,
+    __find_if,
+    __find_if_not,
+    __find,
+    __find_end,
+    __find_first_of,
+    __adjacent_find,
+    __count,
+    __count_if,
+    __search,
+    __search_n,
+    __copy,
+    __copy_n,
+    __copy_if,
+    __swap_ranges,
+    __transform,
+    __replace_if,
+    __replace,
+    __replace_copy_if,
+    __replace_copy,
+    __fill,
+    __fill_n,
+    __generate,
+    __generate_n,
+    __remove_copy_if,
+    __remove_copy,
+    __remove_if,
+    __remove,
+    __unique,
+    __unique_copy,
+    __reverse,
+    __reverse_copy,
+    __rotate,
+    __rotate_copy,
+    __is_partitioned,
+    __partition,
+    __stable_partition,
+    __partition_copy,
+    __sort,
+    __stable_sort,
+    __mismatch,
+    __equal,
+    __move,
+    __partial_sort,
+    __partial_sort_copy,
+    __is_sorted_until,
+    __is_sorted,
+    __merge,
+    __inplace_merge,
+    __includes,
+    __set_union,
+    __set_intersection,
+    __set_difference,
+    __set_symmetric_difference,
+    __is_heap_until,
+    __is_heap,
+    __min_element,
+    __max_element,
+    __minmax_element,
+    __nth_element,
+    __lexicographical_compare,
+    __shift_left,
+    __shift_right,
+    __reduce,
+    __transform_reduce,
+    __exclusive_scan,
+    __inclusive_scan,
+    __transform_exclusive_scan,
+    __transform_inclusive_scan,
+    __adjacent_difference,
+    __uninitialized_copy,
+    __uninitialized_copy_n,
+    __uninitialized_move,
+    __uninitialized_move_n,
+    __uninitialized_fill,
+    __uninitialized_fill_n,
+    __destroy,
+    __destroy_n,
+    __uninitialized_default_construct,
+    __uninitialized_default_construct_n,
+    __uninitialized_value_construct,
+    __uninitialized_value_construct_n,
+    __count_of_algorithms
+};
+
+inline constexpr std::size_t __offload_algorithms_count =
+    static_cast<std::size_t>(__offload_algorithm::__count_of_algorithms);
+
+struct __offload_threshold
+{
+    std::size_t _M_min_elements;
+    std::size_t _M_min_bytes;
+};
+
+// The default thresholds depend on the work done per element: a single pass over the elements, the passes of
+// the scans and of the compactions, or the sorts, merges and set operations
+inline constexpr __offload_threshold __single_pass_threshold{1 << 15, 0};
+inline constexpr __offload_threshold __multi_pass_threshold{1 << 14, 0};
+inline constexpr __offload_threshold __sort_threshold{1 << 12, 0};
+
+struct __offload_algorithm_info
+{
+    // The suffix of the environment variables of the algorithm
+    const char* _M_name;
+    __offload_threshold _M_threshold;
+};
+
+// In the order of __offload_algorithm
+inline constexpr __offload_algorithm_info __offload_algorithms[] = {
+    {"ANY_OF", __single_pass_threshold},
+    {"ALL_OF", __single_pass_threshold},
+    {"NONE_OF", __single_pass_threshold},
+    {"FOR_EACH", __single_pass_threshold},
+    {"FOR_EACH_N", __single_pass_threshold},
+    {"FIND_IF", __single_pass_threshold},
+    {"FIND_IF_NOT", __single_pass_threshold},
+    {"FIND", __single_pass_threshold},
+    {"FIND_END", __sort_threshold},
+    {"FIND_FIRST_OF", __sort_threshold},
+    {"ADJACENT_FIND", __single_pass_threshold},
+    {"COUNT", __single_pass_threshold},
+    {"COUNT_IF", __single_pass_threshold},
+    {"SEARCH", __sort_threshold},
+    {"SEARCH_N", __single_pass_threshold},
+    {"COPY", __single_pass_threshold},
+    {"COPY_N", __single_pass_threshold},
+    {"COPY_IF", __multi_pass_threshold},
+    {"SWAP_RANGES", __single_pass_threshold},
+    {"TRANSFORM", __single_pass_threshold},
+    {"REPLACE_IF", __single_pass_threshold},
+    {"REPLACE", __single_pass_threshold},
+    {"REPLACE_COPY_IF", __single_pass_threshold},
+    {"REPLACE_COPY", __single_pass_threshold},
+    {"FILL", __single_pass_threshold},
+    {"FILL_N", __single_pass_threshold},
+    {"GENERATE", __single_pass_threshold},
+    {"GENERATE_N", __single_pass_threshold},
+    {"REMOVE_COPY_IF", __multi_pass_threshold},
+    {"REMOVE_COPY", __multi_pass_threshold},
+    {"REMOVE_IF", __multi_pass_threshold},
+    {"REMOVE", __multi_pass_threshold},
+    {"UNIQUE", __multi_pass_threshold},
+    {"UNIQUE_COPY", __multi_pass_threshold},
+    {"REVERSE", __single_pass_threshold},
+    {"REVERSE_COPY", __single_pass_threshold},
+    {"ROTATE", __single_pass_threshold},
+    {"ROTATE_COPY", __single_pass_threshold},
+    {"IS_PARTITIONED", __single_pass_threshold},
+    {"PARTITION", __multi_pass_threshold},
+    {"STABLE_PARTITION", __multi_pass_threshold},
+    {"PARTITION_COPY", __multi_pass_threshold},
+    {"SORT", __sort_threshold},
+    {"STABLE_SORT", __sort_threshold},
+    {"MISMATCH", __single_pass_threshold},
+    {"EQUAL", __single_pass_threshold},
+    {"MOVE", __single_pass_threshold},
+    {"PARTIAL_SORT", __sort_threshold},
+    {"PARTIAL_SORT_COPY", __sort_threshold},
+    {"IS_SORTED_UNTIL", __single_pass_threshold},
+    {"IS_SORTED", __single_pass_threshold},
+    {"MERGE", __sort_threshold},
+    {"INPLACE_MERGE", __sort_threshold},
+    {"INCLUDES", __sort_threshold},
+    {"SET_UNION", __sort_threshold},
+    {"SET_INTERSECTION", __sort_threshold},
+    {"SET_DIFFERENCE", __sort_threshold},
+    {"SET_SYMMETRIC_DIFFERENCE", __sort_threshold},
+    {"IS_HEAP_UNTIL", __single_pass_threshold},
+    {"IS_HEAP", __single_pass_threshold},
+    {"MIN_ELEMENT", __single_pass_threshold},
+    {"MAX_ELEMENT", __single_pass_threshold},
+    {"MINMAX_ELEMENT", __single_pass_threshold},
+    {"NTH_ELEMENT", __sort_threshold},
+    {"LEXICOGRAPHICAL_COMPARE", __single_pass_threshold},
+    {"SHIFT_LEFT", __single_pass_threshold},
+    {"SHIFT_RIGHT", __single_pass_threshold},
+    {"REDUCE", __single_pass_threshold},
+    {"TRANSFORM_REDUCE", __single_pass_threshold},
+    {"EXCLUSIVE_SCAN", __multi_pass_threshold},
+    {"INCLUSIVE_SCAN", __multi_pass_threshold},
+    {"TRANSFORM_EXCLUSIVE_SCAN", __multi_pass_threshold},
+    {"TRANSFORM_INCLUSIVE_SCAN", __multi_pass_threshold},
+    {"ADJACENT_DIFFERENCE", __single_pass_threshold},
+    {"UNINITIALIZED_COPY", __single_pass_threshold},
+    {"UNINITIALIZED_COPY_N", __single_pass_threshold},
+    {"UNINITIALIZED_MOVE", __single_pass_threshold},
+    {"UNINITIALIZED_MOVE_N", __single_pass_threshold},
+    {"UNINITIALIZED_FILL", __single_pass_threshold},
+    {"UNINITIALIZED_FILL_N", __single_pass_threshold},
+    {"DESTROY", __single_pass_threshold},
+    {"DESTROY_N", __single_pass_threshold},
+    {"UNINITIALIZED_DEFAULT_CONSTRUCT", __single_pass_threshold},
+    {"UNINITIALIZED_DEFAULT_CONSTRUCT_N", __single_pass_threshold},
+    {"UNINITIALIZED_VALUE_CONSTRUCT", __single_pass_threshold},
+    {"UNINITIALIZED_VALUE_CONSTRUCT_N", __single_pass_threshold}};
+
+static_assert(std::size(__offload_algorithms) == __offload_algorithms_count,
+              "Every algorithm must have its entry in the table of thresholds");
+
+// Reads a non-negative number from the environment variable __prefix or __prefix_<__name> if __name is given;
+// keeps __value if the variable is not set or is not a number
+inline void
+__read_threshold_from_env(std::size_t& __value, const char* __prefix, const char* __name)
+{
+    char __var_name[128];
+    const std::size_t __prefix_len = std::strlen(__prefix);
+    std::memcpy(__var_name, __prefix, __prefix_len + 1);
+    if (__name != nullptr)
+    {
+        const std::size_t __name_len = std::strlen(__name);
+        assert(__prefix_len + __name_len + 2 <= sizeof(__var_name));
+        __var_name[__prefix_len] = '_';
+        std::memcpy(__var_name + __prefix_len + 1, __name, __name_len + 1);
+    }
+
+    const char* __env = std::getenv(__var_name);
+    if (__env == nullptr || *__env < '0' || *__env > '9')
+        return;
+    char* __end = nullptr;
+    const unsigned long long __parsed = std::strtoull(__env, &__end, 10);
+    if (*__end == '\0')
+        __value = static_cast<std::size_t>(__parsed);
+}
+
+// The thresholds are taken, with the increasing priority, from the table above, the PSTL_OFFLOAD_MIN_ELEMENTS and
+// PSTL_OFFLOAD_MIN_BYTES macros, the same-named environment variables, and the environment variables suffixed
+// with the name of the algorithm, such as PSTL_OFFLOAD_MIN_ELEMENTS_SORT. They are read at the first use.
+inline const std::array<__offload_threshold, __offload_algorithms_count>&
+__get_offload_thresholds()
+{
+    static const std::array<__offload_threshold, __offload_algorithms_count> __thresholds = []() {
+        std::array<__offload_threshold, __offload_algorithms_count> __result{};
+        for (std::size_t __i = 0; __i < __offload_algorithms_count; ++__i)
+        {
+            __offload_threshold& __threshold = __result[__i];
+            __threshold = __offload_algorithms[__i]._M_threshold;
+#ifdef PSTL_OFFLOAD_MIN_ELEMENTS
+            __threshold._M_min_elements = PSTL_OFFLOAD_MIN_ELEMENTS;
+#endif
+#ifdef PSTL_OFFLOAD_MIN_BYTES
+            __threshold._M_min_bytes = PSTL_OFFLOAD_MIN_BYTES;
+#endif
+            __read_threshold_from_env(__threshold._M_min_elements, "PSTL_OFFLOAD_MIN_ELEMENTS", nullptr);
+            __read_threshold_from_env(__threshold._M_min_bytes, "PSTL_OFFLOAD_MIN_BYTES", nullptr);
+            __read_threshold_from_env(__threshold._M_min_elements, "PSTL_OFFLOAD_MIN_ELEMENTS",
+                                      __offload_algorithms[__i]._M_name);
+            __read_threshold_from_env(__threshold._M_min_bytes, "PSTL_OFFLOAD_MIN_BYTES",
+                                      __offload_algorithms[__i]._M_name);
+        }
+        return __result;
+    }();
+    return __thresholds;
+}
+
+// __n and __bytes are the total length and size of the input sequences of the algorithm
+inline bool
+__is_worth_offload(__offload_algorithm __algorithm, std::size_t __n, std::size_t __bytes)
+{
+    const __offload_threshold& __threshold = __get_offload_thresholds()[static_cast<std::size_t>(__algorithm)];
+    return __n >= __threshold._M_min_elements && __bytes >= __threshold._M_min_bytes;
+}
+
+// The length of a sequence is known without a pass over it for the random access iterators
+template <typename _Iterator, typename = void>
+struct __is_sized_iterator : std::false_type
+{
+};
+
+template <typename _Iterator>
+struct __is_sized_iterator<_Iterator, std::void_t<decltype(std::declval<_Iterator>() - std::declval<_Iterator>())>>
+    : std::is_base_of<std::random_access_iterator_tag, typename std::iterator_traits<_Iterator>::iterator_category>
+{
+};
+
+// Calls __algorithm with __policy, measuring the call if the statistics of the offload are enabled
+template <typename _Algorithm, typename _Policy>
+static decltype(auto)
+__call_algorithm(__offload_algorithm __id, std::size_t __n, _Algorithm& __algorithm, const _Policy& __policy)
+{
+    static const bool __stats_enabled = __is_offload_stats_enabled();
+    if (!__stats_enabled)
+        return __algorithm(__policy);
+
+    using _Clock = std::chrono::steady_clock;
+    struct __call_timer
+    {
+        __offload_algorithm _M_id;
+        std::size_t _M_n;
+        _Clock::time_point _M_start;
+
+        ~__call_timer()
+        {
+            auto __nanoseconds = [](auto __duration) {
+                return std::uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(__duration).count());
+            };
+            __record_offload_call(__offload_algorithms[static_cast<std::size_t>(_M_id)]._M_name, _M_n,
+                                  std::is_same_v<_Policy, oneapi::dpl::execution::device_policy<>>,
+                                  __nanoseconds(_M_start.time_since_epoch()), __nanoseconds(_Clock::now() - _M_start));
+        }
+    } __timer{__id, __n, _Clock::now()};
+    return __algorithm(__policy);
+}
+
+template <typename _Iterator>
+inline constexpr std::size_t __value_size_v = sizeof(typename std::iterator_traits<_Iterator>::value_type);
+
+template <typename _Iterator>
+std::size_t
+__sequence_length(_Iterator __first, _Iterator __last)
+{
+    const auto __n = __last - __first;
+    return __n > 0 ? static_cast<std::size_t>(__n) : 0;
+}
+
+// Calls __algorithm with the offload policy, or with the host policy if the input sequences of __n elements and
+// __bytes bytes in total are below the threshold
+template <typename _Algorithm>
+static decltype(auto)
+__offload_or_host_sized(__offload_algorithm __id, std::size_t __n, std::size_t __bytes, _Algorithm& __algorithm)
+{
+    if (!__is_worth_offload(__id, __n, __bytes))
+        return __call_algorithm(__id, __n, __algorithm, oneapi::dpl::execution::par_unseq);
+    return __call_algorithm(__id, __n, __algorithm, __get_offload_policy());
+}
+
+// The sequences of unknown length are offloaded, and the statistics count no elements for them
+template <typename _Algorithm>
+static decltype(auto)
+__offload_unsized(__offload_algorithm __id, _Algorithm& __algorithm)
+{
+    return __call_algorithm(__id, 0, __algorithm, __get_offload_policy());
+}
+
+// The input sequences are counted together, in elements and in bytes, against the threshold of the algorithm.
+// A single input sequence of __n elements:
+template <typename _Iterator, typename _Size, typename _Algorithm>
+static decltype(auto)
+__offload_or_host_n(__offload_algorithm __id, _Iterator, _Size __n, _Algorithm __algorithm)
+{
+    const std::size_t __size = __n > 0 ? static_cast<std::size_t>(__n) : 0;
+    if constexpr (__is_sized_iterator<_Iterator>::value)
+        return __offload_or_host_sized(__id, __size, __size * __value_size_v<_Iterator>, __algorithm);
+    else
+        return __call_algorithm(__id, __size, __algorithm, __get_offload_policy());
+}
+
+template <typename _Iterator, typename _Algorithm>
+static decltype(auto)
+__offload_or_host(__offload_algorithm __id, _Iterator __first, _Iterator __last, _Algorithm __algorithm)
+{
+    if constexpr (__is_sized_iterator<_Iterator>::value)
+        return __offload_or_host_n(__id, __first, __last - __first, __algorithm);
+    else
+        return __offload_unsized(__id, __algorithm);
+}
+
+// Two input sequences of the same length, such as the ones of the binary transform or of equal
+template <typename _Iterator1, typename _Iterator2, typename _Algorithm>
+static decltype(auto)
+__offload_or_host(__offload_algorithm __id, _Iterator1 __first1, _Iterator1 __last1, _Iterator2,
+                  _Algorithm __algorithm)
+{
+    if constexpr (__is_sized_iterator<_Iterator1>::value && __is_sized_iterator<_Iterator2>::value)
+    {
+        const std::size_t __n = __sequence_length(__first1, __last1);
+        return __offload_or_host_sized(__id, 2 * __n, __n * (__value_size_v<_Iterator1> + __value_size_v<_Iterator2>),
+                                       __algorithm);
+    }
+    else
+        return __offload_unsized(__id, __algorithm);
+}
+
+// Two input sequences of their own lengths, such as the ones of merge
+template <typename _Iterator1, typename _Iterator2, typename _Algorithm>
+static decltype(auto)
+__offload_or_host(__offload_algorithm __id, _Iterator1 __first1, _Iterator1 __last1, _Iterator2 __first2,
+                  _Iterator2 __last2, _Algorithm __algorithm)
+{
+    if constexpr (__is_sized_iterator<_Iterator1>::value && __is_sized_iterator<_Iterator2>::value)
+    {
+        const std::size_t __n1 = __sequence_length(__first1, __last1);
+        const std::size_t __n2 = __sequence_length(__first2, __last2);
+        return __offload_or_host_sized(__id, __n1 + __n2,
+                                       __n1 * __value_size_v<_Iterator1> + __n2 * __value_size_v<_Iterator2>,
+                                       __algorithm);
+    }
+    else
+        return __offload_unsized(__id, __algorithm);
+}
+
+} // namespace __pstl_offload
+
+#endif // _ONEDPL_PSTL_OFFLOAD_INTERNAL_OFFLOAD_HEURISTIC_H
@@ -18,7 +18,10 @@
 #include <atomic>
 #include <cassert>
 #include <cerrno>
+#include <cstdint>
 #include <mutex> // std::scoped_lock
+#include <optional>
+#include <thread> // std::this_thread::yield
 
 #include <sycl/sycl.hpp>
 
@@ -65,6 +68,42 @@ __get_offload_device_selector()
 
 static __spin_mutex __offload_policy_holder_mtx;
 
+// Number of threads reading the members of __offload_policy_holder without __offload_policy_holder_mtx.
+// The destructor of the holder waits for them after the device is marked as not ready.
+static std::atomic<std::size_t> __offload_policy_holder_readers;
+
+// Registers a reader of __offload_policy_holder; __is_ready() tells whether the members can be read
+class __offload_policy_holder_reader
+{
+  public:
+    __offload_policy_holder_reader() { __offload_policy_holder_readers.fetch_add(1, std::memory_order_seq_cst); }
+
+    ~__offload_policy_holder_reader() { __offload_policy_holder_readers.fetch_sub(1, std::memory_order_release); }
+
+    __offload_policy_holder_reader(const __offload_policy_holder_reader&) = delete;
+    __offload_policy_holder_reader&
+    operator=(const __offload_policy_holder_reader&) = delete;
+
+    bool
+    __is_ready() const
+    {
+        // pairs with the fence in ~__offload_policy_holder_type(), so either the destructor sees the reader,
+        // or the reader sees the device not ready
+        return __device_ready.load(std::memory_order_seq_cst);
+    }
+};
+
+// The holders are numbered at their initialization, so that the copy of the policy of a holder is not taken for
+// the policy of another one, even if it is created at the same address
+inline std::atomic<std::uint64_t> __offload_policy_holder_generation{0};
+
+// A copy of the policy of the holder of generation _M_generation; no holder has the generation 0
+struct __offload_policy_cache
+{
+    std::uint64_t _M_generation = 0;
+    std::optional<oneapi::dpl::execution::device_policy<>> _M_policy;
+};
+
 class __offload_policy_holder_type
 {
     using __set_device_status_func_type = void (*)(bool);
@@ -107,6 +146,7 @@ class __offload_policy_holder_type
 
         _M_offload_device.__init(_device);
         _M_offload_policy = oneapi::dpl::execution::device_policy<>(_device);
+        _M_generation = __offload_policy_holder_generation.fetch_add(1, std::memory_order_relaxed) + 1;
         _M_set_device_status_func(true);
     }
 
@@ -115,46 +155,74 @@ class __offload_policy_holder_type
         std::scoped_lock __lock{__offload_policy_holder_mtx};
 
         _M_set_device_status_func(false);
+
+        // the readers registered before the device became not ready may still copy the members
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        while (__offload_policy_holder_readers.load(std::memory_order_acquire) != 0)
+        {
+            std::this_thread::yield();
+        }
     }
 
-    static auto
-    __get_policy(__offload_policy_holder_type& __this)
+    // The policy does not change while the device is ready, so each thread copies it once into __cache and then
+    // only checks the device status and the generation of the holder
+    static const oneapi::dpl::execution::device_policy<>&
+    __get_policy(__offload_policy_holder_type& __this, __offload_policy_cache& __cache)
     {
-        std::scoped_lock __lock{__offload_policy_holder_mtx};
-
         if (!__device_ready.load(std::memory_order_acquire))
         {
             throw sycl::exception(sycl::errc::runtime);
         }
-        return __this._M_offload_policy;
+        if (__cache._M_generation != __this._M_generation)
+        {
+            __offload_policy_holder_reader __reader;
+            if (!__reader.__is_ready())
+            {
+                throw sycl::exception(sycl::errc::runtime);
+            }
+            __cache._M_policy.emplace(__this._M_offload_policy);
+            __cache._M_generation = __this._M_generation;
+        }
+        return *__cache._M_policy;
     }
 
+    // Called from the memory allocation functions, so it avoids thread_local objects with destructors,
+    // as registering them can allocate memory
     static __sycl_device_shared_ptr
     __get_device_ptr(__offload_policy_holder_type& __this)
     {
-        std::scoped_lock __lock{__offload_policy_holder_mtx};
-
         if (__device_ready.load(std::memory_order_acquire))
         {
-            // it's safe to use copy ctor here, because we under __offload_policy_holder_mtx
-            // and ~__offload_policy_holder_type() has not been called
-            return __sycl_device_shared_ptr(__this._M_offload_device);
-        }
-        else
-        {
-            return __sycl_device_shared_ptr{};
+            __offload_policy_holder_reader __reader;
+            if (__reader.__is_ready())
+            {
+                // it's safe to use copy ctor here, because ~__offload_policy_holder_type() waits for the reader
+                return __sycl_device_shared_ptr(__this._M_offload_device);
+            }
         }
+        return __sycl_device_shared_ptr{};
     }
 
   private:
     __sycl_device_shared_ptr _M_offload_device;
     oneapi::dpl::execution::device_policy<> _M_offload_policy;
     __set_device_status_func_type _M_set_device_status_func;
+    std::uint64_t _M_generation = 0;
 }; // class __offload_policy_holder_type
 
 static __offload_policy_holder_type __offload_policy_holder{__get_offload_device_selector(), &__set_device_status,
                                                             __offload_policy_holder_mtx};
 
+// Each translation unit has its own holder, so its own cache of the policy, and the threads calling the algorithms
+// of several translation units offloading to different devices do not copy the policies over and over again
+static thread_local __offload_policy_cache __offload_policy_thread_cache;
+
+static const oneapi::dpl::execution::device_policy<>&
+__get_offload_policy()
+{
+    return __offload_policy_holder_type::__get_policy(__offload_policy_holder, __offload_policy_thread_cache);
+}
+
 #if __linux__
 inline void*
 __original_aligned_alloc(std::size_t __alignment, std::size_t __size)
@@ -14,6 +14,7 @@
 #include <atomic>
 #include <thread> // std::this_thread::yield
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cassert>
 #include <cstring> // for memcpy
@@ -145,6 +146,25 @@ void*
 __allocate_shared_for_device_large_alignment(__sycl_device_shared_ptr __device_ptr, std::size_t __size,
                                              std::size_t __alignment);
 
+// Blocks of up to __usm_pool_max_block_size bytes, header included, are carved out of larger USM slabs
+// and reused after release, as sycl::aligned_alloc_shared is too slow for frequent small allocations
+inline constexpr std::size_t __usm_pool_max_block_size = 64 * 1024;
+
+void*
+__allocate_shared_for_device_pooled(__sycl_device_shared_ptr __device_ptr, std::size_t __size);
+
+// Statistics of the offload, collected if enabled by the PSTL_OFFLOAD_STATS or PSTL_OFFLOAD_TRACE
+// environment variables
+bool
+__is_offload_stats_enabled();
+
+void
+__record_offload_call(const char* __name, std::size_t __elements, bool __offloaded, std::uint64_t __start_nanoseconds,
+                      std::uint64_t __nanoseconds);
+
+void
+__record_usm_allocation(std::size_t __size);
+
 void*
 __realloc_impl(void* __user_ptr, std::size_t __new_size);
 
@@ -214,6 +234,12 @@ __allocate_shared_for_device(__sycl_device_shared_ptr __device_ptr, std::size_t
         return __allocate_shared_for_device_large_alignment(std::move(__device_ptr), __size, __alignment);
     }
 
+    // The pooled blocks are aligned to sizeof(__block_header) after the header
+    if (__alignment <= sizeof(__block_header) && __size <= __usm_pool_max_block_size - sizeof(__block_header))
+    {
+        return __allocate_shared_for_device_pooled(std::move(__device_ptr), __size);
+    }
+
     std::size_t __base_offset = std::max(__alignment, sizeof(__block_header));
 
     // Check overflow on addition of __base_offset and __size
@@ -239,6 +265,7 @@ __allocate_shared_for_device(__sycl_device_shared_ptr __device_ptr, std::size_t
         __block_header* __header = static_cast<__block_header*>(__ptr) - 1;
         assert(__same_memory_page(__ptr, __header));
         new (__header) __block_header{__uniq_type_const, __original_pointer, std::move(__device_ptr), __size};
+        __record_usm_allocation(__size);
     }
 
     return __ptr;
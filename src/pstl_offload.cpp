@@ -8,15 +8,25 @@
 //===----------------------------------------------------------------------===//
 
 #include <new>
+#include <algorithm>
+#include <atomic>
+#include <cctype>
+#include <chrono>
 #include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <mutex> // std::scoped_lock
 #include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <sycl/sycl.hpp>
 
 #include <pstl_offload/internal/usm_memory_replacement_common.h>
 
 #define _PSTL_OFFLOAD_BINARY_VERSION_MAJOR 1
-#define _PSTL_OFFLOAD_BINARY_VERSION_MINOR 0
+#define _PSTL_OFFLOAD_BINARY_VERSION_MINOR 1
 #define _PSTL_OFFLOAD_BINARY_VERSION_PATCH 0
 
 /*
@@ -44,6 +54,8 @@ Microsoft Detours.
 
 #elif __linux__
 
+#include <pthread.h>
+
 #define _PSTL_OFFLOAD_EXPORT __attribute__((visibility("default")))
 
 #endif
@@ -190,9 +202,21 @@ struct __orig_free_allocator
     friend bool operator!=(const __orig_free_allocator<T>&, const __orig_free_allocator<U>&) { return false; }
 };
 
-// this mutex protects only __large_aligned_ptrs_map, do not put it inside __large_aligned_ptrs_map
+// The registry is split into shards by the pointer, each with its own map and mutex, so the threads releasing
+// different blocks rarely wait for each other.
+inline constexpr std::size_t __large_aligned_ptrs_shards_log = 6;
+inline constexpr std::size_t __large_aligned_ptrs_shards = std::size_t(1) << __large_aligned_ptrs_shards_log;
+
+// these mutexes protect only __large_aligned_ptrs_map, do not put them inside __large_aligned_ptrs_map
 // to freely use after execution __large_aligned_ptrs_map's dtor
-static __spin_mutex __large_aligned_ptrs_map_mtx;
+struct alignas(64) __large_aligned_ptrs_shard_lock
+{
+    __spin_mutex _M_mtx;
+    // number of pointers in the shard, so the lookups of not registered pointers skip the lock of an empty shard
+    std::atomic<std::size_t> _M_size{0};
+};
+
+static __large_aligned_ptrs_shard_lock __large_aligned_ptrs_map_locks[__large_aligned_ptrs_shards];
 
 class __large_aligned_ptrs_map
 {
@@ -210,22 +234,34 @@ private:
     using __map_ptr_to_object_prop =
         std::unordered_map<void*, __ptr_desc, __hash_aligned_ptr, std::equal_to<void*>,
         __orig_free_allocator<std::pair<void* const, __ptr_desc>>>;
-    __map_ptr_to_object_prop* _M_map;
+    __map_ptr_to_object_prop* _M_maps[__large_aligned_ptrs_shards];
+
+    static std::size_t
+    __shard_index(void* __ptr)
+    {
+        // Fibonacci hashing of the page address, as the low bits of the page addresses are zeros
+        constexpr std::uint64_t __multiplier = 0x9e3779b97f4a7c15LLU;
+        return std::size_t((std::uint64_t(__hash_aligned_ptr()(__ptr)) * __multiplier) >>
+                           (64 - __large_aligned_ptrs_shards_log));
+    }
 
 public:
     // We suppose that all users of libpstloffload have dependence on it, so it's impossible to
     // register >=4K-aligned USM memory before ctor of static objects in libpstloffload is executed.
     // So, no need for special support for adding to not-yet-created __large_aligned_ptrs_map.
-    // Suppose that _M_map contains zero before ctor run, so __unregister_ptr()/__get_size() can be
+    // Suppose that _M_maps contains zeros before ctor run, so __unregister_ptr()/__get_size() can be
     // used in this case.
     __large_aligned_ptrs_map()
     {
-        // must have lock because __unregister_ptr()/__get_size() can be called concurrently with ctor
-        std::scoped_lock __l(__large_aligned_ptrs_map_mtx);
-        _M_map = new __map_ptr_to_object_prop;
+        for (std::size_t __i = 0; __i < __large_aligned_ptrs_shards; ++__i)
+        {
+            // must have lock because __unregister_ptr()/__get_size() can be called concurrently with ctor
+            std::scoped_lock __l(__large_aligned_ptrs_map_locks[__i]._M_mtx);
+            _M_maps[__i] = new __map_ptr_to_object_prop;
+        }
     }
 
-    // Do not destroy (i.e., intentionally leak) _M_map to able use it after static object dtor is
+    // Do not destroy (i.e., intentionally leak) _M_maps to able use them after static object dtor is
     // executed. Global free/delete/realloc/etc are overloaded, so we need to use it even after
     // static object dtor has been executed.
     ~__large_aligned_ptrs_map() { }
@@ -238,9 +274,13 @@ public:
     {
         assert(__is_ptr_page_aligned(__ptr));
 
-        std::scoped_lock __l(__large_aligned_ptrs_map_mtx);
-        [[maybe_unused]] auto __ret = __this._M_map->emplace(__ptr, __ptr_desc{std::move(__device_ptr), __size});
+        const std::size_t __shard = __shard_index(__ptr);
+        __large_aligned_ptrs_shard_lock& __lock = __large_aligned_ptrs_map_locks[__shard];
+        std::scoped_lock __l(__lock._M_mtx);
+        [[maybe_unused]] auto __ret =
+            __this._M_maps[__shard]->emplace(__ptr, __ptr_desc{std::move(__device_ptr), __size});
         assert(__ret.second); // the pointer must be unique
+        __lock._M_size.fetch_add(1, std::memory_order_relaxed);
     }
 
     // nullopt means "it's not our pointer"
@@ -253,19 +293,29 @@ public:
             return std::nullopt;
         }
 
-        std::scoped_lock __l(__large_aligned_ptrs_map_mtx);
-        if (!__this._M_map)
+        const std::size_t __shard = __shard_index(__ptr);
+        __large_aligned_ptrs_shard_lock& __lock = __large_aligned_ptrs_map_locks[__shard];
+        // the registration of a pointer happens before its release, so an empty shard can't have it
+        if (__lock._M_size.load(std::memory_order_relaxed) == 0)
+        {
+            return std::nullopt;
+        }
+
+        std::scoped_lock __l(__lock._M_mtx);
+        __map_ptr_to_object_prop* __map = __this._M_maps[__shard];
+        if (!__map)
         {
             // ctor of static object not yet run, so it can't be our pointer
             return std::nullopt;
         }
-        auto __iter = __this._M_map->find(__ptr);
-        if (__iter == __this._M_map->end())
+        auto __iter = __map->find(__ptr);
+        if (__iter == __map->end())
         {
             return std::nullopt;
         }
         __ptr_desc __header = std::move(__iter->second);
-        __this._M_map->erase(__iter);
+        __map->erase(__iter);
+        __lock._M_size.fetch_sub(1, std::memory_order_relaxed);
         return __header;
     }
 
@@ -279,14 +329,22 @@ public:
             return std::nullopt;
         }
 
-        std::scoped_lock __l(__large_aligned_ptrs_map_mtx);
-        if (!__this._M_map)
+        const std::size_t __shard = __shard_index(__ptr);
+        __large_aligned_ptrs_shard_lock& __lock = __large_aligned_ptrs_map_locks[__shard];
+        if (__lock._M_size.load(std::memory_order_relaxed) == 0)
+        {
+            return std::nullopt;
+        }
+
+        std::scoped_lock __l(__lock._M_mtx);
+        __map_ptr_to_object_prop* __map = __this._M_maps[__shard];
+        if (!__map)
         {
             // ctor of static object not yet run, so it can't be our pointer
             return std::nullopt;
         }
-        auto __iter = __this._M_map->find(__ptr);
-        if (__iter == __this._M_map->end())
+        auto __iter = __map->find(__ptr);
+        if (__iter == __map->end())
         {
             return std::nullopt;
         }
@@ -296,10 +354,682 @@ public:
 
 static __large_aligned_ptrs_map __large_aligned_ptrs;
 
+// Statistics of the redirected algorithms and of the USM allocations, collected when the PSTL_OFFLOAD_STATS
+// environment variable is set to a non-zero value or PSTL_OFFLOAD_TRACE names a file. The summary is printed to
+// stderr at exit; the trace file gets a line per algorithm call, in JSON if the file name ends with ".json",
+// in CSV otherwise.
+
+// The statistics are updated from the replaced allocation functions, so they allocate nothing themselves: the
+// algorithms are kept in a fixed table, and the trace file is opened at the first record, as fopen allocates
+inline constexpr std::size_t __offload_stats_max_algorithms = 128;
+inline constexpr std::size_t __offload_stats_max_name_length = 48;
+
+struct __offload_algorithm_stats
+{
+    // the names are copied, as the module the algorithm is called from can be unloaded before exit
+    char _M_name[__offload_stats_max_name_length];
+    std::size_t _M_calls;
+    std::size_t _M_host_calls;
+    std::size_t _M_elements;
+    std::uint64_t _M_nanoseconds;
+};
+
+// Created at the first use in static storage and never destroyed, as the algorithms and the memory releases can be
+// called after the static objects destruction
+class __offload_stats
+{
+    __spin_mutex _M_mtx;
+    __offload_algorithm_stats _M_algorithms[__offload_stats_max_algorithms] = {};
+    std::size_t _M_algorithms_count = 0;
+    char _M_trace_file_name[FILENAME_MAX] = {};
+    std::FILE* _M_trace = nullptr;
+    bool _M_trace_opened = false;
+    bool _M_trace_json = false;
+    bool _M_trace_empty = true;
+    const std::uint64_t _M_start_nanoseconds;
+
+    // the names are passed in upper case, as used for the environment variables of the thresholds, and are
+    // stored in lower case, truncated to the length of _M_name
+    static char
+    __to_lower(char __c)
+    {
+        return char(std::tolower(static_cast<unsigned char>(__c)));
+    }
+
+    static bool
+    __is_named(const __offload_algorithm_stats& __stats, const char* __name)
+    {
+        std::size_t __i = 0;
+        for (; __i + 1 < __offload_stats_max_name_length && __name[__i] != '\0'; ++__i)
+        {
+            if (__stats._M_name[__i] != __to_lower(__name[__i]))
+            {
+                return false;
+            }
+        }
+        return __stats._M_name[__i] == '\0';
+    }
+
+    static void
+    __copy_name(char (&__dest)[__offload_stats_max_name_length], const char* __name)
+    {
+        for (std::size_t __i = 0; __i + 1 < __offload_stats_max_name_length && __name[__i] != '\0'; ++__i)
+        {
+            __dest[__i] = __to_lower(__name[__i]);
+        }
+    }
+
+    // nullptr if the table is full, then the calls are only traced
+    __offload_algorithm_stats*
+    __find_algorithm(const char* __name)
+    {
+        for (std::size_t __i = 0; __i < _M_algorithms_count; ++__i)
+        {
+            if (__is_named(_M_algorithms[__i], __name))
+            {
+                return &_M_algorithms[__i];
+            }
+        }
+        if (_M_algorithms_count == __offload_stats_max_algorithms)
+        {
+            return nullptr;
+        }
+        __offload_algorithm_stats& __stats = _M_algorithms[_M_algorithms_count++];
+        __copy_name(__stats._M_name, __name);
+        return &__stats;
+    }
+
+    // Called under _M_mtx
+    void
+    __open_trace()
+    {
+        _M_trace_opened = true;
+        if (_M_trace_file_name[0] == '\0')
+        {
+            return;
+        }
+        _M_trace = std::fopen(_M_trace_file_name, "w");
+        if (_M_trace == nullptr)
+        {
+            std::fprintf(stderr, "PSTL offload: cannot open the trace file %s\n", _M_trace_file_name);
+            return;
+        }
+        const std::size_t __len = std::strlen(_M_trace_file_name);
+        _M_trace_json = __len >= 5 && std::strcmp(_M_trace_file_name + __len - 5, ".json") == 0;
+        std::fputs(_M_trace_json ? "[\n" : "algorithm,elements,policy,start_ns,duration_ns\n", _M_trace);
+    }
+
+  public:
+    std::atomic<std::size_t> _M_usm_allocations{0};
+    std::atomic<std::size_t> _M_usm_releases{0};
+    std::atomic<std::size_t> _M_usm_allocated_bytes{0};
+    std::atomic<std::size_t> _M_usm_released_bytes{0};
+    std::atomic<std::size_t> _M_usm_used_bytes{0};
+    std::atomic<std::size_t> _M_usm_peak_bytes{0};
+
+    explicit __offload_stats(const char* __trace_file_name)
+        : _M_start_nanoseconds(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                   std::chrono::steady_clock::now().time_since_epoch())
+                                   .count())
+    {
+        if (__trace_file_name == nullptr || *__trace_file_name == '\0')
+        {
+            return;
+        }
+        if (std::strlen(__trace_file_name) >= sizeof(_M_trace_file_name))
+        {
+            std::fprintf(stderr, "PSTL offload: the trace file name %s is too long\n", __trace_file_name);
+            return;
+        }
+        // copied, as the environment can be changed by the application before the first record
+        std::strcpy(_M_trace_file_name, __trace_file_name);
+    }
+
+    void
+    __record_call(const char* __name, std::size_t __elements, bool __offloaded, std::uint64_t __start_nanoseconds,
+                  std::uint64_t __nanoseconds)
+    {
+        std::scoped_lock __l(_M_mtx);
+
+        __offload_algorithm_stats* __stats = __find_algorithm(__name);
+        if (__stats != nullptr)
+        {
+            ++__stats->_M_calls;
+            __stats->_M_host_calls += !__offloaded;
+            __stats->_M_elements += __elements;
+            __stats->_M_nanoseconds += __nanoseconds;
+        }
+
+        if (!_M_trace_opened)
+        {
+            __open_trace();
+        }
+        if (_M_trace != nullptr)
+        {
+            // the names are traced in lower case as well
+            char __lower_name[__offload_stats_max_name_length] = {};
+            __copy_name(__lower_name, __name);
+            const char* __policy = __offloaded ? "device" : "host";
+            const unsigned long long __start = __start_nanoseconds - _M_start_nanoseconds;
+            if (_M_trace_json)
+            {
+                std::fprintf(_M_trace,
+                             "%s  {\"algorithm\": \"%s\", \"elements\": %zu, \"policy\": \"%s\", \"start_ns\": %llu, "
+                             "\"duration_ns\": %llu}",
+                             _M_trace_empty ? "" : ",\n", __lower_name, __elements, __policy, __start,
+                             (unsigned long long)__nanoseconds);
+            }
+            else
+            {
+                std::fprintf(_M_trace, "%s,%zu,%s,%llu,%llu\n", __lower_name, __elements, __policy, __start,
+                             (unsigned long long)__nanoseconds);
+            }
+            _M_trace_empty = false;
+        }
+    }
+
+    void
+    __record_usm_allocation(std::size_t __size)
+    {
+        _M_usm_allocations.fetch_add(1, std::memory_order_relaxed);
+        _M_usm_allocated_bytes.fetch_add(__size, std::memory_order_relaxed);
+        const std::size_t __used = _M_usm_used_bytes.fetch_add(__size, std::memory_order_relaxed) + __size;
+        std::size_t __peak = _M_usm_peak_bytes.load(std::memory_order_relaxed);
+        while (__peak < __used &&
+               !_M_usm_peak_bytes.compare_exchange_weak(__peak, __used, std::memory_order_relaxed))
+        {
+        }
+    }
+
+    void
+    __record_usm_release(std::size_t __size)
+    {
+        _M_usm_releases.fetch_add(1, std::memory_order_relaxed);
+        _M_usm_released_bytes.fetch_add(__size, std::memory_order_relaxed);
+        _M_usm_used_bytes.fetch_sub(__size, std::memory_order_relaxed);
+    }
+
+    void
+    __report()
+    {
+        std::scoped_lock __l(_M_mtx);
+
+        std::fprintf(stderr, "PSTL offload statistics:\n");
+        std::fprintf(stderr, "%-34s %10s %10s %14s %14s\n", "algorithm", "calls", "host calls", "elements",
+                     "time, ms");
+        std::sort(_M_algorithms, _M_algorithms + _M_algorithms_count,
+                  [](const __offload_algorithm_stats& __x, const __offload_algorithm_stats& __y) {
+                      return std::strcmp(__x._M_name, __y._M_name) < 0;
+                  });
+        for (std::size_t __i = 0; __i < _M_algorithms_count; ++__i)
+        {
+            const __offload_algorithm_stats& __stats = _M_algorithms[__i];
+            std::fprintf(stderr, "%-34s %10zu %10zu %14zu %14.3f\n", __stats._M_name, __stats._M_calls,
+                         __stats._M_host_calls, __stats._M_elements, __stats._M_nanoseconds / 1e6);
+        }
+        std::fprintf(stderr, "USM allocations: %zu (%zu bytes), releases: %zu (%zu bytes), peak usage: %zu bytes\n",
+                     _M_usm_allocations.load(), _M_usm_allocated_bytes.load(), _M_usm_releases.load(),
+                     _M_usm_released_bytes.load(), _M_usm_peak_bytes.load());
+
+        if (!_M_trace_opened)
+        {
+            __open_trace();
+        }
+        if (_M_trace != nullptr)
+        {
+            if (_M_trace_json)
+            {
+                std::fputs(_M_trace_empty ? "]\n" : "\n]\n", _M_trace);
+            }
+            std::fclose(_M_trace);
+            _M_trace = nullptr;
+        }
+    }
+};
+
+static __offload_stats*
+__get_offload_stats()
+{
+    static __offload_stats* __stats = []() -> __offload_stats* {
+        const char* __enabled = std::getenv("PSTL_OFFLOAD_STATS");
+        const char* __trace_file_name = std::getenv("PSTL_OFFLOAD_TRACE");
+        if ((__enabled == nullptr || std::strcmp(__enabled, "0") == 0 || *__enabled == '\0') &&
+            (__trace_file_name == nullptr || *__trace_file_name == '\0'))
+        {
+            return nullptr;
+        }
+        // not allocated, as the allocation functions record the USM allocations here
+        alignas(__offload_stats) static unsigned char __storage[sizeof(__offload_stats)];
+        return new (__storage) __offload_stats(__trace_file_name);
+    }();
+    return __stats;
+}
+
+// Prints the summary after the static objects of the application are destroyed, as the library is loaded
+// before the application
+static struct __offload_stats_reporter
+{
+    ~__offload_stats_reporter()
+    {
+        if (__offload_stats* __stats = __get_offload_stats())
+        {
+            __stats->__report();
+        }
+    }
+} __offload_stats_report;
+
+_PSTL_OFFLOAD_EXPORT bool
+__is_offload_stats_enabled()
+{
+    return __get_offload_stats() != nullptr;
+}
+
+_PSTL_OFFLOAD_EXPORT void
+__record_offload_call(const char* __name, std::size_t __elements, bool __offloaded, std::uint64_t __start_nanoseconds,
+                      std::uint64_t __nanoseconds)
+{
+    if (__offload_stats* __stats = __get_offload_stats())
+    {
+        __stats->__record_call(__name, __elements, __offloaded, __start_nanoseconds, __nanoseconds);
+    }
+}
+
+_PSTL_OFFLOAD_EXPORT void
+__record_usm_allocation(std::size_t __size)
+{
+    if (__offload_stats* __stats = __get_offload_stats())
+    {
+        __stats->__record_usm_allocation(__size);
+    }
+}
+
+static void
+__record_usm_release(std::size_t __size)
+{
+    if (__offload_stats* __stats = __get_offload_stats())
+    {
+        __stats->__record_usm_release(__size);
+    }
+}
+
+// The pool of small USM blocks. A block starts with its __block_header, like the blocks allocated directly, but its
+// _M_original_pointer is marked with __usm_pool_block_mark. The blocks of a size class are linked through their
+// first bytes while they are free.
+
+inline constexpr std::size_t __usm_pool_min_block_size = 2 * sizeof(__block_header);
+inline constexpr std::size_t __usm_pool_slab_size = 2 * 1024 * 1024;
+// number of blocks moved at once between a thread cache and the pool: 16K bytes, at least 2 blocks
+inline constexpr std::size_t __usm_pool_batch_bytes = 16 * 1024;
+inline constexpr std::uintptr_t __usm_pool_block_mark = 1;
+
+static_assert(__is_power_of_two(__usm_pool_min_block_size) && __is_power_of_two(__usm_pool_max_block_size));
+static_assert(__usm_pool_slab_size % __usm_pool_max_block_size == 0);
+
+// block sizes are powers of 2 from __usm_pool_min_block_size to __usm_pool_max_block_size
+constexpr std::size_t
+__usm_pool_size_class(std::size_t __requested_number_of_bytes)
+{
+    std::size_t __class = 0;
+    while ((__usm_pool_min_block_size << __class) < __requested_number_of_bytes + sizeof(__block_header))
+    {
+        ++__class;
+    }
+    return __class;
+}
+
+inline constexpr std::size_t __usm_pool_size_classes =
+    __usm_pool_size_class(__usm_pool_max_block_size - sizeof(__block_header)) + 1;
+
+constexpr std::size_t
+__usm_pool_block_size(std::size_t __class)
+{
+    return __usm_pool_min_block_size << __class;
+}
+
+constexpr std::size_t
+__usm_pool_batch_size(std::size_t __class)
+{
+    return std::max(__usm_pool_batch_bytes / __usm_pool_block_size(__class), std::size_t(2));
+}
+
+inline bool
+__is_pooled_block(const __block_header* __header)
+{
+    return (std::uintptr_t(__header->_M_original_pointer) & __usm_pool_block_mark) != 0;
+}
+
+struct __usm_pool_free_block
+{
+    __usm_pool_free_block* _M_next;
+};
+
+// Blocks of one context. The pools are never destroyed, so blocks can be released after the static objects
+// destruction; the slabs are returned to the system at process exit only.
+class __usm_pool
+{
+    sycl::device _M_device;
+    sycl::context _M_context;
+
+    __spin_mutex _M_mtx;
+    __usm_pool_free_block* _M_free_blocks[__usm_pool_size_classes] = {};
+    // the unused part of the last slab
+    char* _M_slab_begin = nullptr;
+    char* _M_slab_end = nullptr;
+
+  public:
+    __usm_pool* const _M_next;
+
+    __usm_pool(const __sycl_device_shared_ptr& __device_ptr, __usm_pool* __next)
+        : _M_device(__device_ptr.__get_device()), _M_context(__device_ptr.__get_context()), _M_next(__next)
+    {
+    }
+
+    bool
+    __serves(const sycl::context& __context) const
+    {
+        return _M_context == __context;
+    }
+
+    // Takes up to __count blocks of the class, returns the list of them and its length
+    std::pair<__usm_pool_free_block*, std::size_t>
+    __take(std::size_t __class, std::size_t __count)
+    {
+        std::scoped_lock __l(_M_mtx);
+
+        __usm_pool_free_block* __list = nullptr;
+        std::size_t __taken = 0;
+        for (; __taken < __count && _M_free_blocks[__class] != nullptr; ++__taken)
+        {
+            __usm_pool_free_block* __block = _M_free_blocks[__class];
+            _M_free_blocks[__class] = __block->_M_next;
+            __block->_M_next = __list;
+            __list = __block;
+        }
+
+        const std::size_t __block_size = __usm_pool_block_size(__class);
+        for (; __taken < __count; ++__taken)
+        {
+            if (std::size_t(_M_slab_end - _M_slab_begin) < __block_size)
+            {
+                // at least one block is enough, the remainder of the previous slab is abandoned
+                if (__taken > 0 || !__new_slab())
+                {
+                    break;
+                }
+            }
+            __usm_pool_free_block* __block = new (_M_slab_begin) __usm_pool_free_block{__list};
+            _M_slab_begin += __block_size;
+            __list = __block;
+        }
+        return {__list, __taken};
+    }
+
+    void
+    __put(std::size_t __class, __usm_pool_free_block* __first, __usm_pool_free_block* __last)
+    {
+        std::scoped_lock __l(_M_mtx);
+
+        __last->_M_next = _M_free_blocks[__class];
+        _M_free_blocks[__class] = __first;
+    }
+
+  private:
+    bool
+    __new_slab()
+    {
+        void* __slab =
+            sycl::aligned_alloc_shared(__get_memory_page_size(), __usm_pool_slab_size, _M_device, _M_context);
+        if (__slab == nullptr)
+        {
+            return false;
+        }
+        _M_slab_begin = static_cast<char*>(__slab);
+        _M_slab_end = _M_slab_begin + __usm_pool_slab_size;
+        return true;
+    }
+};
+
+// list of the pools, one per context, only grows
+static std::atomic<__usm_pool*> __usm_pools;
+static __spin_mutex __usm_pools_mtx;
+
+static __usm_pool*
+__get_usm_pool(const __sycl_device_shared_ptr& __device_ptr)
+{
+    const sycl::context __context = __device_ptr.__get_context();
+    for (__usm_pool* __pool = __usm_pools.load(std::memory_order_acquire); __pool; __pool = __pool->_M_next)
+    {
+        if (__pool->__serves(__context))
+        {
+            return __pool;
+        }
+    }
+
+    std::scoped_lock __l(__usm_pools_mtx);
+    // the pool might be added while the lock was being taken
+    __usm_pool* __head = __usm_pools.load(std::memory_order_relaxed);
+    for (__usm_pool* __pool = __head; __pool; __pool = __pool->_M_next)
+    {
+        if (__pool->__serves(__context))
+        {
+            return __pool;
+        }
+    }
+    __usm_pool* __pool = new __usm_pool(__device_ptr, __head);
+    __usm_pools.store(__pool, std::memory_order_release);
+    return __pool;
+}
+
+// Blocks kept by a thread for the last used pool, at most two batches per class.
+// Allocation and release of a block need no lock unless a batch is moved from or to the pool.
+// The cache is trivially destructible, as registering the destructor of a thread_local object allocates memory
+// and so re-enters the allocation functions; it is flushed at the thread exit by the destructor of a pthread key
+// (an FLS callback under Windows) instead.
+class __usm_thread_cache
+{
+    __usm_pool* _M_pool = nullptr;
+    __usm_pool_free_block* _M_blocks[__usm_pool_size_classes] = {};
+    std::size_t _M_counts[__usm_pool_size_classes] = {};
+
+  public:
+    __usm_thread_cache() = default;
+
+    __usm_thread_cache(const __usm_thread_cache&) = delete;
+    __usm_thread_cache&
+    operator=(const __usm_thread_cache&) = delete;
+
+    void*
+    __allocate(__usm_pool* __pool, std::size_t __class)
+    {
+        __switch_to(__pool);
+        if (_M_blocks[__class] == nullptr)
+        {
+            std::tie(_M_blocks[__class], _M_counts[__class]) = __pool->__take(__class, __usm_pool_batch_size(__class));
+            if (_M_blocks[__class] == nullptr)
+            {
+                return nullptr;
+            }
+        }
+        __usm_pool_free_block* __block = _M_blocks[__class];
+        _M_blocks[__class] = __block->_M_next;
+        --_M_counts[__class];
+        return __block;
+    }
+
+    void
+    __deallocate(__usm_pool* __pool, std::size_t __class, void* __ptr)
+    {
+        if (_M_pool == nullptr)
+        {
+            _M_pool = __pool;
+        }
+        else if (__pool != _M_pool)
+        {
+            // do not switch the cache on release, as the block may come from another thread
+            __usm_pool_free_block* __block = new (__ptr) __usm_pool_free_block;
+            __pool->__put(__class, __block, __block);
+            return;
+        }
+        _M_blocks[__class] = new (__ptr) __usm_pool_free_block{_M_blocks[__class]};
+        if (++_M_counts[__class] >= 2 * __usm_pool_batch_size(__class))
+        {
+            __return_blocks(__class, __usm_pool_batch_size(__class));
+        }
+    }
+
+    void
+    __flush()
+    {
+        for (std::size_t __class = 0; __class < __usm_pool_size_classes; ++__class)
+        {
+            if (_M_counts[__class] > 0)
+            {
+                __return_blocks(__class, _M_counts[__class]);
+            }
+        }
+    }
+
+  private:
+    void
+    __switch_to(__usm_pool* __pool)
+    {
+        if (__pool != _M_pool)
+        {
+            __flush();
+            _M_pool = __pool;
+        }
+    }
+
+    void
+    __return_blocks(std::size_t __class, std::size_t __count)
+    {
+        __usm_pool_free_block* __first = _M_blocks[__class];
+        __usm_pool_free_block* __last = __first;
+        for (std::size_t __i = 1; __i < __count; ++__i)
+        {
+            __last = __last->_M_next;
+        }
+        _M_blocks[__class] = __last->_M_next;
+        _M_counts[__class] -= __count;
+        _M_pool->__put(__class, __first, __last);
+    }
+};
+
+static_assert(std::is_trivially_destructible_v<__usm_thread_cache>);
+
+enum class __usm_thread_cache_state : unsigned char
+{
+    __unused,
+    // the flush at the thread exit is registered
+    __registered,
+    // the cache is flushed, or its flush cannot be registered: the blocks go directly to the pool
+    __bypassed
+};
+
+static thread_local __usm_thread_cache __usm_cache;
+static thread_local __usm_thread_cache_state __usm_cache_state = __usm_thread_cache_state::__unused;
+
+static void
+__flush_usm_thread_cache()
+{
+    __usm_cache_state = __usm_thread_cache_state::__bypassed;
+    __usm_cache.__flush();
+}
+
+// the destructor of the pthread key, or the FLS callback
+static void
+__usm_thread_cache_exit(void*)
+{
+    __flush_usm_thread_cache();
+}
+
+static bool
+__register_usm_thread_cache_exit()
+{
+#if _WIN64
+    static const DWORD __index = FlsAlloc(__usm_thread_cache_exit);
+    return __index != FLS_OUT_OF_INDEXES && FlsSetValue(__index, &__usm_cache);
+#else
+    static pthread_key_t __key;
+    static const bool __key_created = pthread_key_create(&__key, __usm_thread_cache_exit) == 0;
+    // the destructor of a key is called for a non-null value only
+    return __key_created && pthread_setspecific(__key, &__usm_cache) == 0;
+#endif
+}
+
+// Returns the cache of the thread, or nullptr if the blocks of the thread go directly to the pool
+static __usm_thread_cache*
+__get_usm_thread_cache()
+{
+    if (__usm_cache_state == __usm_thread_cache_state::__unused)
+    {
+        // the registration may allocate memory, the allocations made by it use the cache already
+        __usm_cache_state = __usm_thread_cache_state::__registered;
+        if (!__register_usm_thread_cache_exit())
+        {
+            __flush_usm_thread_cache();
+        }
+    }
+    return __usm_cache_state == __usm_thread_cache_state::__registered ? &__usm_cache : nullptr;
+}
+
+_PSTL_OFFLOAD_EXPORT void*
+__allocate_shared_for_device_pooled(__sycl_device_shared_ptr __device_ptr, std::size_t __size)
+{
+    assert(__size <= __usm_pool_max_block_size - sizeof(__block_header));
+
+    const std::size_t __class = __usm_pool_size_class(__size);
+    __usm_pool* __pool = __get_usm_pool(__device_ptr);
+    void* __block = nullptr;
+    if (__usm_thread_cache* __cache = __get_usm_thread_cache())
+    {
+        __block = __cache->__allocate(__pool, __class);
+    }
+    else
+    {
+        __block = __pool->__take(__class, 1).first;
+    }
+    if (__block == nullptr)
+    {
+        return nullptr;
+    }
+
+    __block_header* __header = static_cast<__block_header*>(__block);
+    void* __original_pointer = (void*)(std::uintptr_t(__block) | __usm_pool_block_mark);
+    new (__header) __block_header{__uniq_type_const, __original_pointer, std::move(__device_ptr), __size};
+    __record_usm_allocation(__size);
+    return __header + 1;
+}
+
+static void
+__free_pooled_block(__block_header* __header)
+{
+    __usm_pool* __pool = __get_usm_pool(__header->_M_device);
+    const std::size_t __class = __usm_pool_size_class(__header->_M_requested_number_of_bytes);
+    void* __block = __header;
+    __header->~__block_header();
+
+    if (__usm_thread_cache* __cache = __get_usm_thread_cache())
+    {
+        __cache->__deallocate(__pool, __class, __block);
+    }
+    else
+    {
+        __usm_pool_free_block* __free_block = new (__block) __usm_pool_free_block;
+        __pool->__put(__class, __free_block, __free_block);
+    }
+}
+
 static void
 __free_usm_pointer(__block_header* __header)
 {
     __header->_M_uniq_const = 0;
+    __record_usm_release(__header->_M_requested_number_of_bytes);
+    if (__is_pooled_block(__header))
+    {
+        __free_pooled_block(__header);
+        return;
+    }
     sycl::context __context = __header->_M_device.__get_context();
     void* __original_pointer = __header->_M_original_pointer;
     __header->~__block_header();
@@ -324,6 +1054,7 @@ __internal_free(void* __user_ptr)
                 __desc = __large_aligned_ptrs_map::__unregister_ptr(__large_aligned_ptrs, __user_ptr);
                 __desc.has_value())
         {
+            __record_usm_release(__desc->_M_requested_number_of_bytes);
             sycl::context __context = __desc->_M_device.__get_context();
             sycl::free(__user_ptr, __context);
             return;
@@ -447,6 +1178,15 @@ __realloc_impl(void* __user_ptr, std::size_t __new_size)
         {
             return __user_ptr;
         }
+        // a pooled block can grow up to the size of its class
+        if (__is_pooled_block(__header) && __new_size <= __usm_pool_max_block_size - sizeof(__block_header) &&
+            __usm_pool_size_class(__new_size) == __usm_pool_size_class(__header->_M_requested_number_of_bytes))
+        {
+            __record_usm_release(__header->_M_requested_number_of_bytes);
+            __record_usm_allocation(__new_size);
+            __header->_M_requested_number_of_bytes = __new_size;
+            return __user_ptr;
+        }
 
         void* __result = __realloc_allocate_shared(__header->_M_device, __user_ptr,
                                                    __header->_M_requested_number_of_bytes, __new_size);
@@ -464,6 +1204,7 @@ __realloc_impl(void* __user_ptr, std::size_t __new_size)
         void* __result = __realloc_allocate_shared(__desc->_M_device, __user_ptr, __desc->_M_requested_number_of_bytes, __new_size);
         if (__result)
         {
+            __record_usm_release(__desc->_M_requested_number_of_bytes);
             sycl::context __context = __desc->_M_device.__get_context();
             sycl::free(__user_ptr, __context);
         }
@@ -488,6 +1229,7 @@ __allocate_shared_for_device_large_alignment(__sycl_device_shared_ptr __device_p
     if (__ptr)
     {
         __large_aligned_ptrs_map::__register_ptr(__large_aligned_ptrs, __ptr, __size, std::move(__device_ptr));
+        __record_usm_allocation(__size);
     }
     return __ptr;
 }
@@ -549,6 +1291,7 @@ __aligned_realloc_impl(void* __user_ptr, std::size_t __new_size, std::size_t __a
 
         if (__result != nullptr)
         {
+            __record_usm_release(__desc->_M_requested_number_of_bytes);
             sycl::context __context = __desc->_M_device.__get_context();
             sycl::free(__user_ptr, __context);
         }
@@ -47,6 +47,12 @@
 #    endif
 #endif
 
+#if !ONEDPL_USE_STD_THREAD_BACKEND
+#    ifdef _ONEDPL_PARALLEL_BACKEND_STD_THREAD_H
+#        error The std::thread backend is used while it should not (ONEDPL_USE_STD_THREAD_BACKEND is not set to 1)
+#    endif
+#endif
+
 // Verify that DPC++ backend for the FPGA is not not accessed if ONEDPL_FPGA_DEVICE is undefined or set to 0.
 #if !ONEDPL_FPGA_DEVICE
 #    ifdef _ONEDPL_parallel_backend_sycl_fpga_H
@@ -69,6 +75,17 @@
 // |       1      |       OpenMP        |  OpenMP   |   TBB    |
 // |______________|_____________________|___________|__________|
 
+// The std::thread backend is used only if requested, and then regardless of the other macros
+#if ONEDPL_USE_STD_THREAD_BACKEND
+#    if !defined(_ONEDPL_PARALLEL_BACKEND_STD_THREAD_H)
+#        error The std::thread backend is not enabled while it should (ONEDPL_USE_STD_THREAD_BACKEND == 1)
+#    endif
+#    if defined(_ONEDPL_PARALLEL_BACKEND_TBB_H) || defined(_ONEDPL_PARALLEL_BACKEND_OMP_H) ||                         \
+        defined(_ONEDPL_PARALLEL_BACKEND_SERIAL_H)
+#        error Another backend cannot be simultaneously enabled with the std::thread backend
+#    endif
+#else
+
 // Make sure that the TBB backend is selected if ONEDPL_USE_TBB_BACKEND set to 1 and ONEDPL_USE_OPENMP_BACKEND set to any value
 #if defined(ONEDPL_USE_TBB_BACKEND) && ONEDPL_USE_TBB_BACKEND
 #    if !defined(_ONEDPL_PARALLEL_BACKEND_TBB_H)
@@ -145,6 +162,8 @@
 #    endif
 #endif
 
+#endif // ONEDPL_USE_STD_THREAD_BACKEND
+
 int main() {
     return TestUtils::done();
 }
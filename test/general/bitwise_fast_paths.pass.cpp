@@ -0,0 +1,125 @@
+// -*- C++ -*-
+//===-- bitwise_fast_paths.pass.cpp ---------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include _PSTL_TEST_HEADER(execution)
+#include _PSTL_TEST_HEADER(algorithm)
+
+#include "support/utils.h"
+
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <vector>
+
+#if !TEST_ONLY_HETERO_POLICIES
+template <typename T>
+T
+make(std::size_t i)
+{
+    if constexpr (std::is_pointer_v<T>)
+        return reinterpret_cast<T>(std::uintptr_t(i * 8));
+    else
+        return T(i % 251);
+}
+
+// The differences are put at the bounds of the blocks compared at once, and at both ends of the sequences
+template <typename T, typename Policy>
+void
+test_type(const Policy& policy)
+{
+    for (std::size_t n : {0, 1, 7, 63, 64, 65, 256, 257, 1000, 100003})
+    {
+        std::vector<T> x(n), y(n);
+        for (std::size_t i = 0; i < n; ++i)
+            x[i] = y[i] = make<T>(i);
+        const std::vector<T>& cx = x;
+
+        EXPECT_TRUE(std::equal(policy, cx.begin(), cx.end(), y.begin()), "wrong result of equal");
+        EXPECT_TRUE(std::equal(policy, x.data(), x.data() + n, y.data(), y.data() + n, std::equal_to<>()),
+                    "wrong result of equal");
+        EXPECT_TRUE(std::mismatch(policy, x.begin(), x.end(), y.begin()).first == x.end(),
+                    "wrong result of mismatch");
+        if (n > 0)
+            EXPECT_TRUE(!std::equal(policy, x.begin(), x.end(), y.begin(), y.end() - 1),
+                        "wrong result of equal of sequences of different lengths");
+
+        for (std::size_t k : {std::size_t(0), std::size_t(63), std::size_t(64), n / 2, n - 1})
+        {
+            if (k >= n)
+                continue;
+            y[k] = make<T>(k + 1);
+            EXPECT_TRUE(!std::equal(policy, cx.begin(), cx.end(), y.begin(), std::equal_to<T>()),
+                        "wrong result of equal");
+            auto result = std::mismatch(policy, cx.begin(), cx.end(), y.begin(), y.end());
+            EXPECT_EQ(std::ptrdiff_t(k), result.first - cx.begin(), "wrong result of mismatch");
+            EXPECT_EQ(std::ptrdiff_t(k), result.second - y.begin(), "wrong result of mismatch");
+            y[k] = x[k];
+        }
+
+        std::vector<T> out(n);
+        std::copy(policy, cx.begin(), cx.end(), out.begin());
+        EXPECT_TRUE(out == x, "wrong effect of copy");
+        std::fill(out.begin(), out.end(), T{});
+        std::copy_n(policy, x.data(), n, out.data());
+        EXPECT_TRUE(out == x, "wrong effect of copy_n");
+        std::fill(out.begin(), out.end(), T{});
+        std::move(policy, x.begin(), x.end(), out.data());
+        EXPECT_TRUE(out == x, "wrong effect of move");
+    }
+}
+
+// Floating point values with the same value but different bits, or the same bits but no equality, are not
+// compared bitwise
+template <typename Policy>
+void
+test_floating_point(const Policy& policy)
+{
+    std::vector<double> zeros(1000, 0.0), negative_zeros(1000, -0.0);
+    EXPECT_TRUE(std::equal(policy, zeros.begin(), zeros.end(), negative_zeros.begin()), "wrong result of equal");
+    EXPECT_TRUE(std::mismatch(policy, zeros.begin(), zeros.end(), negative_zeros.begin()).first == zeros.end(),
+                "wrong result of mismatch");
+
+    std::vector<double> nans(1000, std::numeric_limits<double>::quiet_NaN());
+    EXPECT_TRUE(!std::equal(policy, nans.begin(), nans.end(), nans.begin()), "wrong result of equal");
+    EXPECT_TRUE(std::mismatch(policy, nans.begin(), nans.end(), nans.begin()).first == nans.begin(),
+                "wrong result of mismatch");
+}
+
+template <typename Policy>
+void
+test_policy(const Policy& policy)
+{
+    test_type<std::uint8_t>(policy);
+    test_type<std::int32_t>(policy);
+    test_type<std::uint64_t>(policy);
+    test_type<const char*>(policy);
+    test_floating_point(policy);
+}
+#endif // !TEST_ONLY_HETERO_POLICIES
+
+int
+main()
+{
+#if !TEST_ONLY_HETERO_POLICIES
+    test_policy(oneapi::dpl::execution::seq);
+    test_policy(oneapi::dpl::execution::unseq);
+    test_policy(oneapi::dpl::execution::par);
+    test_policy(oneapi::dpl::execution::par_unseq);
+#endif // !TEST_ONLY_HETERO_POLICIES
+
+    return TestUtils::done();
+}
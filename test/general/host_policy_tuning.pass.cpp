@@ -0,0 +1,176 @@
+// -*- C++ -*-
+//===-- host_policy_tuning.pass.cpp ---------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include _PSTL_TEST_HEADER(execution)
+#include _PSTL_TEST_HEADER(algorithm)
+#include _PSTL_TEST_HEADER(numeric)
+#include _PSTL_TEST_HEADER(memory)
+
+#include "support/utils.h"
+
+#include <vector>
+#include <functional>
+#include <mutex>
+#include <set>
+#include <thread>
+
+#if !TEST_ONLY_HETERO_POLICIES && _ONEDPL_PAR_BACKEND_TBB
+#    include <tbb/task_arena.h>
+#endif
+
+#if !TEST_ONLY_HETERO_POLICIES
+template <typename Policy>
+void
+test_tuned_policy(const Policy& policy)
+{
+    const std::size_t n = 100000;
+    std::vector<std::int64_t> in(n), out(n), expected(n);
+
+    std::iota(in.begin(), in.end(), 0);
+    std::fill(policy, out.begin(), out.end(), -1);
+    EXPECT_TRUE(std::count(out.begin(), out.end(), -1) == n, "wrong result of fill with a tuned policy");
+
+    std::for_each(policy, out.begin(), out.end(), [](std::int64_t& x) { x = 1; });
+    EXPECT_TRUE(std::count(out.begin(), out.end(), 1) == n, "wrong result of for_each with a tuned policy");
+
+    EXPECT_TRUE(std::reduce(policy, in.begin(), in.end()) == std::int64_t(n) * (n - 1) / 2,
+                "wrong result of reduce with a tuned policy");
+    EXPECT_TRUE(std::transform_reduce(policy, in.begin(), in.end(), in.begin(), std::int64_t(0)) ==
+                    std::inner_product(in.begin(), in.end(), in.begin(), std::int64_t(0)),
+                "wrong result of transform_reduce with a tuned policy");
+
+    std::partial_sum(in.begin(), in.end(), expected.begin());
+    std::inclusive_scan(policy, in.begin(), in.end(), out.begin());
+    EXPECT_EQ_N(expected.begin(), out.begin(), n, "wrong result of inclusive_scan with a tuned policy");
+    std::fill(out.begin(), out.end(), 0);
+    std::copy_if(policy, in.begin(), in.end(), out.begin(), [](std::int64_t x) { return x % 3 == 0; });
+    EXPECT_TRUE(out[n / 3] == std::int64_t(n / 3) * 3, "wrong result of copy_if with a tuned policy");
+
+    std::reverse_copy(in.begin(), in.end(), out.begin());
+    std::stable_sort(policy, out.begin(), out.end());
+    EXPECT_EQ_N(in.begin(), out.begin(), n, "wrong result of stable_sort with a tuned policy");
+
+    std::vector<std::int64_t> merged(2 * n);
+    std::merge(policy, in.begin(), in.end(), out.begin(), out.end(), merged.begin());
+    EXPECT_TRUE(std::is_sorted(merged.begin(), merged.end()), "wrong result of merge with a tuned policy");
+
+    EXPECT_TRUE(std::find(policy, in.begin(), in.end(), std::int64_t(n / 2)) == in.begin() + n / 2,
+                "wrong result of find with a tuned policy");
+}
+
+template <typename Policy>
+void
+test_first_touch(const Policy& policy)
+{
+    // large enough for the scratch buffer of stable_sort to be placed in parallel
+    const std::size_t n = 1 << 20;
+    std::vector<std::int64_t> data(n);
+    std::fill(policy, data.begin(), data.end(), 7);
+    EXPECT_TRUE(std::count(data.begin(), data.end(), 7) == n, "wrong result of fill with the first touch placement");
+
+    std::iota(data.rbegin(), data.rend(), 0);
+    std::stable_sort(policy, data.begin(), data.end());
+    EXPECT_TRUE(std::is_sorted(data.begin(), data.end()), "wrong result of stable_sort with the first touch placement");
+
+    std::allocator<std::int64_t> alloc;
+    std::int64_t* raw = alloc.allocate(n);
+    std::uninitialized_copy(policy, data.begin(), data.end(), raw);
+    EXPECT_EQ_N(data.begin(), raw, n, "wrong result of uninitialized_copy with the first touch placement");
+    alloc.deallocate(raw, n);
+}
+
+template <typename Policy>
+void
+test_thread_limit(const Policy& policy, std::size_t max_threads)
+{
+    std::mutex m;
+    std::set<std::thread::id> threads;
+    std::vector<int> data(100000);
+    std::for_each(policy, data.begin(), data.end(), [&](int&) {
+        std::lock_guard<std::mutex> lock(m);
+        threads.insert(std::this_thread::get_id());
+    });
+    EXPECT_TRUE(threads.size() <= max_threads, "a policy used more threads than requested");
+
+    std::iota(data.rbegin(), data.rend(), 0);
+    std::sort(policy, data.begin(), data.end());
+    EXPECT_TRUE(std::is_sorted(data.begin(), data.end()), "wrong result of sort with a thread limited policy");
+}
+#endif // !TEST_ONLY_HETERO_POLICIES
+
+std::int32_t
+main()
+{
+#if !TEST_ONLY_HETERO_POLICIES
+    using namespace oneapi::dpl::execution;
+
+    static_assert(std::is_same_v<decltype(par.with(grainsize(64))), parallel_policy>,
+                  "with() must preserve the policy type");
+    static_assert(std::is_same_v<decltype(par_unseq.with(partitioner::static_)), parallel_unsequenced_policy>,
+                  "with() must preserve the policy type");
+    static_assert(is_execution_policy_v<std::decay_t<decltype(par.with(grainsize(64)))>>,
+                  "a tuned policy must remain an execution policy");
+
+    constexpr auto tuned = par.with(grainsize(64 * 1024), partitioner::static_);
+    static_assert(tuned.__get_params().__grainsize == 64 * 1024, "wrong grain size of a tuned policy");
+    static_assert(tuned.__get_params().__partitioner == partitioner::static_, "wrong partitioner of a tuned policy");
+    static_assert(par.__get_params().__grainsize == 0, "the predefined policy must keep the backend defaults");
+
+    test_tuned_policy(par);
+    test_tuned_policy(tuned);
+    test_tuned_policy(par.with(grainsize(1)));
+    test_tuned_policy(par.with(grainsize(100), partitioner::simple));
+    test_tuned_policy(par_unseq.with(partitioner::static_));
+    test_tuned_policy(par_unseq.with(grainsize(1000000), partitioner::simple));
+
+    constexpr auto first_touch = par_unseq.with(numa_placement::first_touch);
+    static_assert(first_touch.__get_params().__partitioner == partitioner::static_,
+                  "the first touch placement requires the static partitioning");
+    test_tuned_policy(first_touch);
+    test_first_touch(first_touch);
+    test_first_touch(par.with(numa_placement::first_touch, num_threads(2)));
+
+    test_tuned_policy(par.with(num_threads(2)));
+    test_thread_limit(par.with(num_threads(2)), 2);
+    test_thread_limit(par_unseq.with(num_threads(1), grainsize(16)), 1);
+#    if _ONEDPL_PAR_BACKEND_TBB
+    tbb::task_arena limited_arena(2);
+    test_tuned_policy(par.with(arena(limited_arena)));
+    test_thread_limit(par.with(arena(limited_arena)), 2);
+    // the arena of the policy takes precedence over the thread limit
+    test_thread_limit(par_unseq.with(num_threads(8), arena(limited_arena)), 2);
+
+    // the calls limited to the same number of threads share an arena
+    tbb::task_arena& arena2 = oneapi::dpl::__tbb_backend::__arena_with_concurrency(2);
+    test_thread_limit(par.with(num_threads(3)), 3);
+    EXPECT_TRUE(&oneapi::dpl::__tbb_backend::__arena_with_concurrency(2) == &arena2, "the arena is not reused");
+    EXPECT_EQ(3, oneapi::dpl::__tbb_backend::__arena_with_concurrency(3).max_concurrency(),
+              "wrong concurrency of the shared arena");
+
+    // the searches split the work among the threads of the arena the algorithm runs in
+    using oneapi::dpl::__internal::__tbb_backend_tag;
+    EXPECT_EQ(std::size_t(3),
+              oneapi::dpl::__tbb_backend::__max_concurrency(__tbb_backend_tag{}, par.with(num_threads(3))),
+              "wrong concurrency of a thread limited policy");
+    EXPECT_EQ(std::size_t(2),
+              oneapi::dpl::__tbb_backend::__max_concurrency(__tbb_backend_tag{}, par.with(arena(limited_arena))),
+              "wrong concurrency of a policy bound to an arena");
+#    endif
+#endif // !TEST_ONLY_HETERO_POLICIES
+
+    return TestUtils::done();
+}
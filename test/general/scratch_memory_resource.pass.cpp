@@ -0,0 +1,241 @@
+// -*- C++ -*-
+//===-- scratch_memory_resource.pass.cpp ----------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include _PSTL_TEST_HEADER(execution)
+#include _PSTL_TEST_HEADER(algorithm)
+#include _PSTL_TEST_HEADER(memory)
+
+#include "support/utils.h"
+
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#if !TEST_ONLY_HETERO_POLICIES
+// Upstream resource counting the allocations and checking the alignment of the returned blocks
+class counting_resource : public oneapi::dpl::scratch_memory_resource
+{
+  public:
+    std::atomic<std::size_t> allocations{0};
+    std::atomic<std::size_t> deallocations{0};
+    std::atomic<std::size_t> outstanding_bytes{0};
+
+  private:
+    void*
+    do_allocate(std::size_t bytes, std::size_t alignment) override
+    {
+        void* p = ::operator new(bytes, std::align_val_t(alignment));
+        EXPECT_TRUE(reinterpret_cast<std::uintptr_t>(p) % alignment == 0, "misaligned block");
+        ++allocations;
+        outstanding_bytes += bytes;
+        return p;
+    }
+    void
+    do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override
+    {
+        ++deallocations;
+        outstanding_bytes -= bytes;
+        ::operator delete(p, std::align_val_t(alignment));
+    }
+};
+
+void
+test_pool_reuse()
+{
+    counting_resource upstream;
+    {
+        oneapi::dpl::scratch_pool_resource pool(std::size_t(-1), &upstream);
+        EXPECT_TRUE(pool.upstream_resource() == &upstream, "wrong upstream resource of the pool");
+
+        void* p = pool.allocate(1000, 64);
+        EXPECT_TRUE(reinterpret_cast<std::uintptr_t>(p) % 64 == 0, "misaligned block of the pool");
+        pool.deallocate(p, 1000, 64);
+        EXPECT_TRUE(pool.cached_bytes() >= 1000, "a deallocated block must be cached");
+
+        // a request of the same size class and alignment reuses the cached block
+        void* q = pool.allocate(990, 64);
+        EXPECT_TRUE(p == q, "a cached block must be reused");
+        EXPECT_TRUE(upstream.allocations == 1, "a cached block must not be allocated again");
+        pool.deallocate(q, 990, 64);
+
+        // a different alignment does not
+        void* r = pool.allocate(1000, 128);
+        EXPECT_TRUE(upstream.allocations == 2, "blocks of different alignments must not be mixed");
+        pool.deallocate(r, 1000, 128);
+
+        pool.release();
+        EXPECT_TRUE(pool.cached_bytes() == 0, "release must drop the cached blocks");
+        EXPECT_TRUE(upstream.outstanding_bytes == 0, "release must return the cached blocks upstream");
+
+        void* s = pool.allocate(4096);
+        pool.deallocate(s, 4096);
+    }
+    EXPECT_TRUE(upstream.allocations == upstream.deallocations, "the pool must return every block on destruction");
+
+    // a pool with no cache capacity passes the blocks through
+    oneapi::dpl::scratch_pool_resource no_cache(0, &upstream);
+    void* p = no_cache.allocate(1 << 16);
+    no_cache.deallocate(p, 1 << 16);
+    EXPECT_TRUE(no_cache.cached_bytes() == 0 && upstream.outstanding_bytes == 0,
+                "blocks above the cache capacity must be returned upstream");
+}
+
+void
+test_concurrent_pool()
+{
+    counting_resource upstream;
+    oneapi::dpl::scratch_pool_resource pool(std::size_t(-1), &upstream);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t)
+        threads.emplace_back([&pool, t]() {
+            for (std::size_t i = 0; i < 1000; ++i)
+            {
+                const std::size_t bytes = 64 + (i * 37 + t) % 5000;
+                auto* p = static_cast<unsigned char*>(pool.allocate(bytes));
+                p[0] = p[bytes - 1] = static_cast<unsigned char>(t);
+                pool.deallocate(p, bytes);
+            }
+        });
+    for (auto& thread : threads)
+        thread.join();
+    pool.release();
+    EXPECT_TRUE(upstream.outstanding_bytes == 0, "blocks were lost under concurrent use");
+}
+
+template <typename Policy>
+void
+test_algorithms(const Policy& policy)
+{
+    const std::size_t n = 100000;
+    std::vector<std::int64_t> data(n), out(n);
+    std::iota(data.rbegin(), data.rend(), 0);
+    std::stable_sort(policy, data.begin(), data.end());
+    EXPECT_TRUE(std::is_sorted(data.begin(), data.end()), "wrong result of stable_sort with a scratch resource");
+
+    auto end = std::copy_if(policy, data.begin(), data.end(), out.begin(), [](std::int64_t x) { return x % 2 == 0; });
+    EXPECT_TRUE(end - out.begin() == n / 2 && out[1] == 2, "wrong result of copy_if with a scratch resource");
+}
+
+void
+test_policy_resource()
+{
+    using namespace oneapi::dpl::execution;
+    counting_resource upstream;
+    oneapi::dpl::scratch_pool_resource pool(std::size_t(-1), &upstream);
+
+    test_algorithms(par.with(scratch_resource(&pool)));
+    const std::size_t allocations = upstream.allocations;
+#    if !_ONEDPL_PAR_BACKEND_SERIAL
+    EXPECT_TRUE(allocations > 0, "the scratch resource of the policy must be used");
+#    endif
+    test_algorithms(par_unseq.with(scratch_resource(&pool), grainsize(1024)));
+    EXPECT_TRUE(upstream.allocations == allocations, "repeated calls must reuse the cached buffers");
+    pool.release();
+    EXPECT_TRUE(upstream.outstanding_bytes == 0, "a buffer of an algorithm was not returned");
+}
+
+void
+test_default_resource()
+{
+    using namespace oneapi::dpl::execution;
+    counting_resource upstream, policy_upstream;
+    oneapi::dpl::scratch_pool_resource pool(std::size_t(-1), &upstream);
+
+    EXPECT_TRUE(oneapi::dpl::get_default_scratch_resource() == nullptr, "wrong initial default scratch resource");
+    EXPECT_TRUE(oneapi::dpl::set_default_scratch_resource(&pool) == nullptr, "wrong previous default scratch resource");
+    test_algorithms(par);
+#    if !_ONEDPL_PAR_BACKEND_SERIAL
+    EXPECT_TRUE(upstream.allocations > 0, "the default scratch resource must be used");
+#    endif
+
+    // the resource of the policy takes precedence
+    const std::size_t allocations = upstream.allocations;
+    oneapi::dpl::scratch_pool_resource policy_pool(0, &policy_upstream);
+    test_algorithms(par.with(scratch_resource(&policy_pool)));
+    EXPECT_TRUE(upstream.allocations == allocations, "the default resource must not be used by a policy with one");
+#    if !_ONEDPL_PAR_BACKEND_SERIAL
+    EXPECT_TRUE(policy_upstream.allocations > 0, "the scratch resource of the policy must be used");
+#    endif
+
+    EXPECT_TRUE(oneapi::dpl::set_default_scratch_resource(nullptr) == &pool, "wrong previous default scratch resource");
+    test_algorithms(par);
+}
+
+void
+test_huge_pages()
+{
+    using namespace oneapi::dpl::execution;
+    for (bool reserved : {false, true})
+    {
+        oneapi::dpl::huge_page_resource huge(reserved);
+        EXPECT_TRUE(huge.reserved() == reserved, "wrong kind of pages of a huge page resource");
+        const std::size_t bytes = 3 * oneapi::dpl::huge_page_resource::page_size + 100;
+        auto* p = static_cast<unsigned char*>(huge.allocate(bytes, 64));
+#    if __linux__
+        EXPECT_TRUE(reinterpret_cast<std::uintptr_t>(p) % oneapi::dpl::huge_page_resource::page_size == 0,
+                    "a block of huge pages must be 2 MiB aligned");
+#    endif
+        std::fill(p, p + bytes, static_cast<unsigned char>(1));
+        EXPECT_TRUE(std::count(p, p + bytes, static_cast<unsigned char>(1)) == bytes, "a huge page block is not writable");
+        huge.deallocate(p, bytes, 64);
+    }
+
+    // large enough for the scratch buffers to be backed by huge pages
+    const std::size_t n = 1 << 21;
+    std::vector<std::int64_t> data(n);
+    std::iota(data.rbegin(), data.rend(), 0);
+    std::stable_sort(par.with(huge_pages::enabled), data.begin(), data.end());
+    EXPECT_TRUE(std::is_sorted(data.begin(), data.end()), "wrong result of stable_sort with huge pages");
+
+#    if _ONEDPL_HUGE_PAGES_AVAILABLE
+    // the huge page blocks are kept mapped for the next calls
+    auto* cache = dynamic_cast<oneapi::dpl::scratch_pool_resource*>(
+        oneapi::dpl::__internal::__huge_page_scratch_resource());
+#        if !_ONEDPL_PAR_BACKEND_SERIAL
+    // the serial backend sorts in place, with no scratch buffer
+    EXPECT_TRUE(cache && cache->cached_bytes() >= n * sizeof(std::int64_t), "the huge page blocks are not cached");
+#        endif
+    const std::size_t cached = cache ? cache->cached_bytes() : 0;
+    std::iota(data.rbegin(), data.rend(), 0);
+    std::stable_sort(par.with(huge_pages::enabled), data.begin(), data.end());
+    EXPECT_TRUE(std::is_sorted(data.begin(), data.end()), "wrong result of stable_sort with huge pages");
+    EXPECT_TRUE(cache && cache->cached_bytes() == cached, "the cached huge page blocks are not reused");
+#    endif
+
+    oneapi::dpl::huge_page_resource huge;
+    oneapi::dpl::scratch_pool_resource pool(std::size_t(-1), &huge);
+    test_algorithms(par_unseq.with(scratch_resource(&pool), huge_pages::disabled));
+    test_algorithms(par_unseq.with(scratch_resource(&pool)));
+}
+#endif // !TEST_ONLY_HETERO_POLICIES
+
+std::int32_t
+main()
+{
+#if !TEST_ONLY_HETERO_POLICIES
+    test_pool_reuse();
+    test_concurrent_pool();
+    test_policy_resource();
+    test_default_resource();
+    test_huge_pages();
+#endif // !TEST_ONLY_HETERO_POLICIES
+
+    return TestUtils::done();
+}
@@ -0,0 +1,127 @@
+// -*- C++ -*-
+//===-- serial_cutoff.pass.cpp --------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include _PSTL_TEST_HEADER(execution)
+#include _PSTL_TEST_HEADER(algorithm)
+#include _PSTL_TEST_HEADER(numeric)
+
+#include "support/utils.h"
+
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#if !TEST_ONLY_HETERO_POLICIES
+// Sizes around the default cutoffs of the loops, in elements of 4 bytes
+const std::size_t sizes[] = {0, 1, 2, 100, 1023, 1024, 1025, 2047, 2048, 2049, 100000};
+
+template <typename Policy>
+void
+test_results(const Policy& policy)
+{
+    for (std::size_t n : sizes)
+    {
+        std::vector<std::int32_t> data(n), out(n), expected(n);
+        std::iota(data.begin(), data.end(), 1);
+
+        std::for_each(policy, data.begin(), data.end(), [](std::int32_t& x) { x *= 2; });
+        EXPECT_TRUE(n == 0 || (data.front() == 2 && data.back() == std::int32_t(2 * n)), "wrong result of for_each");
+
+        const std::int64_t sum = std::int64_t(n) * (n + 1);
+        EXPECT_TRUE(std::reduce(policy, data.begin(), data.end(), std::int64_t(0)) == sum, "wrong result of reduce");
+        EXPECT_TRUE(std::transform_reduce(policy, data.begin(), data.end(), std::int64_t(0), std::plus<std::int64_t>(),
+                                          [](std::int32_t x) { return std::int64_t(x) / 2; }) == sum / 2,
+                    "wrong result of transform_reduce");
+
+        std::partial_sum(data.begin(), data.end(), expected.begin());
+        std::inclusive_scan(policy, data.begin(), data.end(), out.begin());
+        EXPECT_EQ_N(expected.begin(), out.begin(), n, "wrong result of inclusive_scan");
+        std::transform_inclusive_scan(policy, data.begin(), data.end(), out.begin(), std::plus<std::int32_t>(),
+                                      [](std::int32_t x) { return x; });
+        EXPECT_EQ_N(expected.begin(), out.begin(), n, "wrong result of transform_inclusive_scan");
+
+        auto end = std::copy_if(policy, data.begin(), data.end(), out.begin(), [](std::int32_t x) { return x % 4 == 0; });
+        EXPECT_TRUE(std::size_t(end - out.begin()) == n / 2, "wrong result of copy_if");
+    }
+}
+
+// A loop over less data than its cutoff runs on the calling thread
+template <typename Policy>
+void
+test_calling_thread(const Policy& policy)
+{
+    const std::thread::id caller = std::this_thread::get_id();
+    std::vector<std::int32_t> data(100, 1);
+    std::atomic<bool> elsewhere{false};
+    auto check_thread = [&](std::int32_t x) {
+        if (std::this_thread::get_id() != caller)
+            elsewhere = true;
+        return x;
+    };
+
+    std::for_each(policy, data.begin(), data.end(), [&](std::int32_t x) { check_thread(x); });
+    EXPECT_TRUE(!elsewhere, "a small for_each must run on the calling thread");
+    EXPECT_TRUE(std::transform_reduce(policy, data.begin(), data.end(), 0, std::plus<std::int32_t>(), check_thread) ==
+                    100,
+                "wrong result of a small transform_reduce");
+    EXPECT_TRUE(!elsewhere, "a small transform_reduce must run on the calling thread");
+}
+
+// An early exit of a short algorithm, run by a worker within a chunk of an enclosing loop, does not cancel the
+// enclosing loop
+template <typename Policy>
+void
+test_nested_early_exit(const Policy& policy)
+{
+    const std::size_t n = 200000;
+    std::vector<std::int32_t> outer(n), inner(16);
+    std::iota(inner.begin(), inner.end(), 0);
+    std::atomic<std::size_t> visited{0};
+
+    std::for_each(policy, outer.begin(), outer.end(), [&](std::int32_t& x) {
+        x = std::any_of(policy, inner.begin(), inner.end(), [](std::int32_t y) { return y == 0; }) +
+            !std::all_of(policy, inner.begin(), inner.end(), [](std::int32_t y) { return y > 0; });
+        ++visited;
+    });
+    EXPECT_EQ(n, visited.load(), "an enclosing for_each is cancelled by a nested algorithm");
+    EXPECT_TRUE(std::count(outer.begin(), outer.end(), 2) == std::ptrdiff_t(n), "wrong result of a nested algorithm");
+}
+#endif // !TEST_ONLY_HETERO_POLICIES
+
+std::int32_t
+main()
+{
+#if !TEST_ONLY_HETERO_POLICIES
+    using namespace oneapi::dpl::execution;
+    test_results(par);
+    test_results(par_unseq);
+    // expensive elements lower the cutoffs, so that even short loops are run in parallel
+    test_results(par.with(cost_hint(1000)));
+    test_results(par_unseq.with(cost_hint(0), grainsize(16)));
+
+    test_calling_thread(par);
+    test_calling_thread(par_unseq.with(partitioner::static_));
+    test_calling_thread(par.with(cost_hint(4)));
+
+    test_nested_early_exit(par);
+    test_nested_early_exit(par_unseq);
+#endif // !TEST_ONLY_HETERO_POLICIES
+
+    return TestUtils::done();
+}
@@ -0,0 +1,214 @@
+// -*- C++ -*-
+//===-- std_thread_backend.pass.cpp ---------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+// The std::thread backend is selected regardless of the backend the tests are configured with
+#ifndef ONEDPL_USE_STD_THREAD_BACKEND
+#    define ONEDPL_USE_STD_THREAD_BACKEND 1
+#endif
+
+#include "support/test_config.h"
+
+#include _PSTL_TEST_HEADER(execution)
+#include _PSTL_TEST_HEADER(algorithm)
+#include _PSTL_TEST_HEADER(numeric)
+
+#include "support/utils.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <atomic>
+#include <list>
+#include <new>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if !TEST_ONLY_HETERO_POLICIES && ONEDPL_USE_STD_THREAD_BACKEND
+// The algorithms of several threads outside of the pool share its workers
+void
+test_concurrent_callers()
+{
+    const std::size_t n = 200000;
+    std::vector<std::thread> callers;
+    std::vector<std::int64_t> sums(4);
+    std::vector<std::int32_t> sorted(4);
+    for (std::size_t t = 0; t < sums.size(); ++t)
+    {
+        callers.emplace_back([&, t]() {
+            std::vector<std::int32_t> data(n);
+            std::iota(data.rbegin(), data.rend(), std::int32_t(t));
+            oneapi::dpl::sort(oneapi::dpl::execution::par, data.begin(), data.end());
+            sorted[t] = std::is_sorted(data.begin(), data.end());
+            sums[t] = oneapi::dpl::reduce(oneapi::dpl::execution::par, data.begin(), data.end(), std::int64_t(0));
+        });
+    }
+    for (std::thread& caller : callers)
+        caller.join();
+
+    for (std::size_t t = 0; t < sums.size(); ++t)
+    {
+        EXPECT_TRUE(sorted[t] != 0, "wrong effect of sort called concurrently");
+        EXPECT_EQ(std::int64_t(n) * (n - 1) / 2 + std::int64_t(t) * n, sums[t],
+                  "wrong result of reduce called concurrently");
+    }
+}
+
+// An algorithm called from a chunk of another one runs on the worker executing the chunk
+void
+test_nested()
+{
+    const std::size_t n = 64, m = 10000;
+    std::vector<std::vector<std::int32_t>> rows(n, std::vector<std::int32_t>(m));
+    oneapi::dpl::for_each(oneapi::dpl::execution::par, rows.begin(), rows.end(), [](std::vector<std::int32_t>& row) {
+        oneapi::dpl::fill(oneapi::dpl::execution::par, row.begin(), row.end(), 1);
+        oneapi::dpl::inclusive_scan(oneapi::dpl::execution::par, row.begin(), row.end(), row.begin());
+    });
+    const bool ok = std::all_of(rows.begin(), rows.end(), [m](const std::vector<std::int32_t>& row) {
+        return row.front() == 1 && row.back() == std::int32_t(m);
+    });
+    EXPECT_TRUE(ok, "wrong effect of nested algorithms");
+}
+
+// The stable sort constructs the elements in its buffer, and the transform scan keeps its partial sums in any
+// copyable type
+void
+test_non_trivial_types()
+{
+    const std::size_t n = 50000;
+    std::vector<std::string> words(n);
+    for (std::size_t i = 0; i < n; ++i)
+        words[i] = std::to_string((i * 7919) % 1000) + "#" + std::to_string(i);
+
+    auto by_prefix = [](const std::string& a, const std::string& b) {
+        return a.substr(0, a.find('#')) < b.substr(0, b.find('#'));
+    };
+    std::vector<std::string> expected(words);
+    std::stable_sort(expected.begin(), expected.end(), by_prefix);
+    oneapi::dpl::stable_sort(oneapi::dpl::execution::par, words.begin(), words.end(), by_prefix);
+    EXPECT_TRUE(words == expected, "wrong effect of stable_sort of strings");
+
+    auto first_char = [](const std::string& s) { return std::string(1, s[0]); };
+    std::vector<std::string> scanned(n), expected_scan(n);
+    std::transform_exclusive_scan(words.begin(), words.begin() + 3000, expected_scan.begin(), std::string("!"),
+                                  std::plus<std::string>(), first_char);
+    oneapi::dpl::transform_exclusive_scan(oneapi::dpl::execution::par.with(oneapi::dpl::execution::grainsize{100}),
+                                          words.begin(), words.begin() + 3000, scanned.begin(), std::string("!"),
+                                          std::plus<std::string>(), first_char);
+    EXPECT_TRUE(std::equal(expected_scan.begin(), expected_scan.begin() + 3000, scanned.begin()),
+                "wrong effect of transform_exclusive_scan of strings");
+}
+
+// for_each over forward iterators and the loops limited to a given number of threads
+void
+test_for_each_and_tuning()
+{
+    std::list<std::int32_t> values(30000, 2);
+    oneapi::dpl::for_each(oneapi::dpl::execution::par, values.begin(), values.end(), [](std::int32_t& v) { v *= 3; });
+    EXPECT_TRUE(std::all_of(values.begin(), values.end(), [](std::int32_t v) { return v == 6; }),
+                "wrong effect of for_each over a list");
+
+    std::vector<std::int32_t> data(100000);
+    std::iota(data.begin(), data.end(), 0);
+    for (auto policy : {oneapi::dpl::execution::par.with(oneapi::dpl::execution::num_threads{2}),
+                        oneapi::dpl::execution::par.with(oneapi::dpl::execution::partitioner::static_),
+                        oneapi::dpl::execution::par.with(oneapi::dpl::execution::partitioner::simple,
+                                                         oneapi::dpl::execution::grainsize{1000})})
+    {
+        auto found = oneapi::dpl::find(policy, data.begin(), data.end(), 77777);
+        EXPECT_TRUE(found - data.begin() == 77777, "wrong result of find with a tuned policy");
+        EXPECT_EQ(std::int64_t(data.size()) * (data.size() - 1) / 2,
+                  oneapi::dpl::reduce(policy, data.begin(), data.end(), std::int64_t(0)),
+                  "wrong result of reduce with a tuned policy");
+    }
+}
+
+// An early exit of a short algorithm, run within a chunk of an enclosing loop, cancels neither the enclosing loop nor,
+// when it throws, leaves its cancellation flag behind
+void
+test_nested_cancellation()
+{
+    const std::size_t n = 200000;
+    std::vector<std::int32_t> outer(n), inner(16);
+    std::iota(inner.begin(), inner.end(), 0);
+    std::atomic<std::size_t> visited{0};
+    oneapi::dpl::for_each(oneapi::dpl::execution::par, outer.begin(), outer.end(), [&](std::int32_t& x) {
+        x = oneapi::dpl::any_of(oneapi::dpl::execution::par, inner.begin(), inner.end(),
+                                [](std::int32_t y) { return y == 0; });
+        ++visited;
+    });
+    EXPECT_EQ(n, visited.load(), "an enclosing for_each is cancelled by a nested any_of");
+    EXPECT_TRUE(std::count(outer.begin(), outer.end(), 1) == std::ptrdiff_t(n), "wrong result of a nested any_of");
+
+    bool thrown = false;
+    try
+    {
+        oneapi::dpl::for_each(oneapi::dpl::execution::par, inner.begin(), inner.end(),
+                              [](std::int32_t) { throw std::bad_alloc(); });
+    }
+    catch (const std::bad_alloc&)
+    {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown, "bad_alloc is not propagated by for_each");
+    EXPECT_TRUE(oneapi::dpl::__std_thread_backend::__current_cancellation_flag() == nullptr,
+                "the cancellation flag of a loop left by an exception is not restored");
+}
+
+// The partial sorts merge the sorted prefixes of the halves only
+void
+test_partial_sort()
+{
+    const std::size_t n = 100000;
+    std::vector<std::int32_t> data(n);
+    for (std::size_t i = 0; i < n; ++i)
+        data[i] = std::int32_t((i * 7919) % 50021);
+    std::vector<std::int32_t> sorted(data);
+    std::sort(sorted.begin(), sorted.end());
+
+    for (std::size_t k : {std::size_t(1), std::size_t(100), std::size_t(2049), std::size_t(30000), n - 1, n})
+    {
+        std::vector<std::int32_t> out(data);
+        oneapi::dpl::partial_sort(oneapi::dpl::execution::par, out.begin(), out.begin() + k, out.end());
+        EXPECT_TRUE(std::equal(sorted.begin(), sorted.begin() + k, out.begin()), "wrong prefix of partial_sort");
+        std::sort(out.begin() + k, out.end());
+        EXPECT_TRUE(std::equal(sorted.begin() + k, sorted.end(), out.begin() + k),
+                    "the elements are not preserved by partial_sort");
+
+        std::vector<std::int32_t> copied(k);
+        oneapi::dpl::partial_sort_copy(oneapi::dpl::execution::par, data.begin(), data.end(), copied.begin(),
+                                       copied.end());
+        EXPECT_TRUE(std::equal(sorted.begin(), sorted.begin() + k, copied.begin()),
+                    "wrong result of partial_sort_copy");
+    }
+}
+#endif // !TEST_ONLY_HETERO_POLICIES && ONEDPL_USE_STD_THREAD_BACKEND
+
+int
+main()
+{
+    bool processed = false;
+#if !TEST_ONLY_HETERO_POLICIES && ONEDPL_USE_STD_THREAD_BACKEND
+    test_concurrent_callers();
+    test_nested();
+    test_non_trivial_types();
+    test_for_each_and_tuning();
+    test_nested_cancellation();
+    test_partial_sort();
+    processed = true;
+#endif
+    return TestUtils::done(processed);
+}
@@ -0,0 +1,208 @@
+// -*- C++ -*-
+//===-- streaming_stores.pass.cpp -----------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+// The streaming stores are used from a small size on, so that the loops of every size cover them
+#define ONEDPL_STREAMING_STORES 1
+#define ONEDPL_STREAMING_STORES_THRESHOLD 1000
+
+#include "support/test_config.h"
+
+#include _PSTL_TEST_HEADER(execution)
+#include _PSTL_TEST_HEADER(algorithm)
+#include _PSTL_TEST_HEADER(memory)
+
+#include "support/utils.h"
+
+#include <cstdint>
+#include <vector>
+
+#if !TEST_ONLY_HETERO_POLICIES
+// An element of 3 bytes, copied but not filled by the streaming stores
+struct Rgb
+{
+    std::uint8_t r, g, b;
+
+    friend bool
+    operator==(const Rgb& x, const Rgb& y)
+    {
+        return x.r == y.r && x.g == y.g && x.b == y.b;
+    }
+};
+
+// An element of 16 bytes, as wide as a streaming store
+struct Pair
+{
+    std::int64_t first, second;
+
+    friend bool
+    operator==(const Pair& x, const Pair& y)
+    {
+        return x.first == y.first && x.second == y.second;
+    }
+};
+
+template <typename T>
+T
+make(std::size_t i)
+{
+    if constexpr (std::is_same_v<T, Rgb>)
+        return Rgb{std::uint8_t(i), std::uint8_t(i >> 8), std::uint8_t(i >> 16)};
+    else if constexpr (std::is_same_v<T, Pair>)
+        return Pair{std::int64_t(i), -std::int64_t(i)};
+    else
+        return T(i % 100 + 1);
+}
+
+template <typename T>
+bool
+all_equal(const T* first, std::size_t n, const T& value)
+{
+    for (std::size_t i = 0; i < n; ++i)
+        if (!(first[i] == value))
+            return false;
+    return true;
+}
+
+// The destinations start at every offset from a 16-byte boundary, so the stores of the heads and the tails are covered
+template <typename T, typename Policy>
+void
+test_type(const Policy& policy)
+{
+    for (std::size_t n : {0, 1, 15, 16, 17, 100, 1000, 100003})
+    {
+        std::vector<T> src(n + 16), dst(n + 16);
+        for (std::size_t i = 0; i < src.size(); ++i)
+            src[i] = make<T>(i);
+
+        for (std::size_t offset : {0, 1, 3})
+        {
+            T* out = dst.data() + offset;
+            const T guard = make<T>(7777);
+            std::fill(dst.begin(), dst.end(), guard);
+
+            std::copy(policy, src.begin(), src.begin() + n, out);
+            EXPECT_TRUE(std::equal(src.begin(), src.begin() + n, out), "wrong effect of copy");
+            EXPECT_TRUE(out[n] == guard && (offset == 0 || out[-1] == guard), "copy wrote out of its destination");
+
+            std::fill(dst.begin(), dst.end(), guard);
+            std::copy_n(policy, src.data() + offset, n, out);
+            EXPECT_TRUE(std::equal(src.data() + offset, src.data() + offset + n, out), "wrong effect of copy_n");
+
+            std::fill(dst.begin(), dst.end(), guard);
+            std::move(policy, src.data(), src.data() + n, dst.begin() + offset);
+            EXPECT_TRUE(std::equal(src.begin(), src.begin() + n, out), "wrong effect of move");
+
+            std::fill(dst.begin(), dst.end(), guard);
+            std::uninitialized_copy(policy, src.begin(), src.begin() + n, out);
+            EXPECT_TRUE(std::equal(src.begin(), src.begin() + n, out), "wrong effect of uninitialized_copy");
+
+            const T value = make<T>(42);
+            std::fill(dst.begin(), dst.end(), guard);
+            std::fill(policy, out, out + n, value);
+            EXPECT_TRUE(all_equal(out, n, value), "wrong effect of fill");
+            EXPECT_TRUE(out[n] == guard && (offset == 0 || out[-1] == guard), "fill wrote out of its destination");
+
+            std::fill(dst.begin(), dst.end(), guard);
+            std::fill_n(policy, dst.begin() + offset, n, value);
+            EXPECT_TRUE(all_equal(out, n, value), "wrong effect of fill_n");
+
+            std::fill(dst.begin(), dst.end(), guard);
+            std::uninitialized_fill(policy, out, out + n, value);
+            EXPECT_TRUE(all_equal(out, n, value), "wrong effect of uninitialized_fill");
+        }
+    }
+}
+
+template <typename Policy>
+void
+test_policy(const Policy& policy)
+{
+    test_type<std::uint8_t>(policy);
+    test_type<std::int16_t>(policy);
+    test_type<std::int32_t>(policy);
+    test_type<double>(policy);
+    test_type<Rgb>(policy);
+    test_type<Pair>(policy);
+}
+
+// A value of another arithmetic type is converted to the element type
+void
+test_conversion()
+{
+    std::vector<std::int16_t> data(10000);
+    std::fill(oneapi::dpl::execution::par_unseq.with(oneapi::dpl::execution::streaming_stores::enabled), data.begin(),
+              data.end(), 3.75);
+    EXPECT_TRUE(all_equal(data.data(), data.size(), std::int16_t(3)), "wrong conversion of the value of fill");
+}
+
+// A vectorized brick with streaming stores, which the dispatch turns on for the destinations from the threshold on
+struct StreamingBrick
+{
+    bool __streaming = false;
+};
+
+template <typename Policy>
+bool
+dispatch_streaming(const Policy& policy, std::size_t n)
+{
+    StreamingBrick brick;
+    oneapi::dpl::__internal::__enable_streaming_stores<std::int32_t*>(brick, policy, n);
+    return brick.__streaming;
+}
+
+// The threshold, 1000 bytes unless set by ONEDPL_STREAMING_STORES_THRESHOLD, selects the streaming path unless
+// the policy forces or disables it
+void
+test_dispatch()
+{
+    using oneapi::dpl::execution::streaming_stores;
+
+    const std::size_t threshold =
+        oneapi::dpl::__utils::__size_from_env("ONEDPL_STREAMING_STORES_THRESHOLD", ONEDPL_STREAMING_STORES_THRESHOLD);
+    const std::size_t n = (threshold + sizeof(std::int32_t) - 1) / sizeof(std::int32_t);
+    const auto policy = oneapi::dpl::execution::par_unseq;
+    if (threshold > 0)
+    {
+        EXPECT_TRUE(!oneapi::dpl::__utils::__use_streaming_stores(policy, threshold - 1),
+                    "streaming stores below the threshold");
+        EXPECT_TRUE(oneapi::dpl::__utils::__use_streaming_stores(policy, threshold),
+                    "no streaming stores at the threshold");
+        EXPECT_TRUE(!dispatch_streaming(policy, n - 1), "streaming stores selected below the threshold");
+        EXPECT_TRUE(dispatch_streaming(policy, n), "streaming stores not selected at the threshold");
+    }
+    EXPECT_TRUE(dispatch_streaming(policy.with(streaming_stores::enabled), 1),
+                "streaming stores not selected when enabled by the policy");
+    EXPECT_TRUE(!dispatch_streaming(policy.with(streaming_stores::disabled), 1000000),
+                "streaming stores selected when disabled by the policy");
+}
+#endif // !TEST_ONLY_HETERO_POLICIES
+
+int
+main()
+{
+#if !TEST_ONLY_HETERO_POLICIES
+    using oneapi::dpl::execution::streaming_stores;
+
+    test_policy(oneapi::dpl::execution::unseq);
+    test_policy(oneapi::dpl::execution::par_unseq);
+    test_policy(oneapi::dpl::execution::par_unseq.with(streaming_stores::enabled));
+    test_policy(oneapi::dpl::execution::par_unseq.with(streaming_stores::disabled));
+    test_policy(oneapi::dpl::execution::par.with(streaming_stores::enabled));
+    test_conversion();
+    test_dispatch();
+#endif // !TEST_ONLY_HETERO_POLICIES
+
+    return TestUtils::done();
+}
@@ -0,0 +1,262 @@
+// -*- C++ -*-
+//===-- find_early_exit.pass.cpp ------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include _PSTL_TEST_HEADER(execution)
+#include _PSTL_TEST_HEADER(algorithm)
+
+#include "support/utils.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <numeric>
+#include <thread>
+#include <vector>
+
+#if !TEST_ONLY_HETERO_POLICIES
+// The searches stop once the result is known, so the work done depends on the position of the result and on
+// the size of the blocks searched at a time, not on the size of the range
+constexpr std::size_t n = 1 << 22;
+
+// Counts the calls of a predicate. The calls on the elements past the match in the order of the search wait until
+// the match is evaluated: a thread preempted before reaching the match cannot let the others search on, so the work
+// done past the match is bounded by the blocks the threads hold at that moment, whatever the scheduling. A search
+// running in another order gives up the wait after a while, and fails the check instead of hanging.
+struct work_counter
+{
+    std::atomic<std::size_t> calls{0};
+    std::atomic<bool> matched{false};
+    std::atomic<bool> timed_out{false};
+
+    void
+    count(bool past_match)
+    {
+        calls.fetch_add(1, std::memory_order_relaxed);
+        if (!past_match || matched.load(std::memory_order_acquire))
+            return;
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(1);
+        while (!matched.load(std::memory_order_acquire))
+        {
+            if (std::chrono::steady_clock::now() > deadline)
+            {
+                timed_out = true;
+                match();
+            }
+            std::this_thread::yield();
+        }
+    }
+
+    bool
+    match()
+    {
+        matched.store(true, std::memory_order_release);
+        return true;
+    }
+
+    bool
+    within(std::size_t bound) const
+    {
+        return !timed_out && calls <= bound;
+    }
+};
+
+// Number of the threads taking part in the algorithms run with the policy
+template <typename Policy>
+std::size_t
+concurrency(const Policy& policy)
+{
+    using backend_tag = typename oneapi::dpl::__internal::__parallel_tag<std::false_type>::__backend_tag;
+    return oneapi::dpl::__par_backend::__max_concurrency(backend_tag{}, policy);
+}
+
+// Bound of the calls of the predicate of a search finding the match at distance pos from its start: the elements
+// up to the match, and the block every thread holds when the match is found, plus one more each may claim before
+// the result is published
+template <typename Policy>
+std::size_t
+work_bound(const Policy& policy, std::size_t pos, std::size_t block)
+{
+    return pos + 1 + 2 * concurrency(policy) * block;
+}
+
+// Largest block of __parallel_find: the block size grows with the distance searched up to n / (8 * workers)
+template <typename Policy>
+std::size_t
+find_block(const Policy& policy)
+{
+    const std::size_t min_block =
+        std::max<std::size_t>(1024, oneapi::dpl::__internal::__get_host_policy_params(policy).__grainsize);
+    return std::max(min_block, n / (8 * std::max<std::size_t>(1, concurrency(policy))));
+}
+
+template <typename Policy>
+void
+test_first_match(const Policy& policy, std::size_t pos)
+{
+    std::vector<int> data(n);
+    std::iota(data.begin(), data.end(), 0);
+    const std::size_t bound = work_bound(policy, pos, find_block(policy));
+
+    work_counter find_if_work;
+    auto it = std::find_if(policy, data.begin(), data.end(), [&find_if_work, pos](int x) {
+        find_if_work.count(std::size_t(x) > pos);
+        return x == int(pos) && find_if_work.match();
+    });
+    EXPECT_TRUE(it == data.begin() + pos, "wrong result of find_if");
+    EXPECT_TRUE(find_if_work.within(bound), "find_if searched too far past the match");
+
+    // the order is broken by the element at pos
+    if (pos > 0)
+    {
+        work_counter sorted_work;
+        it = std::is_sorted_until(policy, data.begin(), data.end(), [&sorted_work, pos](int x, int y) {
+            sorted_work.count(std::size_t(x) > pos);
+            return (x == int(pos) && sorted_work.match()) || x < y;
+        });
+        EXPECT_TRUE(it == data.begin() + pos, "wrong result of is_sorted_until");
+        EXPECT_TRUE(sorted_work.within(bound), "is_sorted_until searched too far past the unsorted element");
+    }
+
+    std::vector<int> other(data);
+    other[pos] = -1;
+    work_counter mismatch_work;
+    auto res = std::mismatch(policy, data.begin(), data.end(), other.begin(), [&mismatch_work, pos](int x, int y) {
+        mismatch_work.count(std::size_t(x) > pos);
+        return x == y || !mismatch_work.match();
+    });
+    EXPECT_TRUE(res.first == data.begin() + pos, "wrong result of mismatch");
+    EXPECT_TRUE(mismatch_work.within(bound), "mismatch searched too far past the mismatch");
+
+    std::vector<int> needle{int(pos), int(pos) + 1};
+    auto found = std::search(policy, data.begin(), data.end(), needle.begin(), needle.end());
+    EXPECT_TRUE(found == data.begin() + pos, "wrong result of search");
+
+    data[pos + 1] = data[pos];
+    EXPECT_TRUE(std::adjacent_find(policy, data.begin(), data.end()) == data.begin() + pos,
+                "wrong result of adjacent_find");
+}
+
+// The blocks of find_end are searched forward for their last match, so the elements past the match in the block
+// holding it are searched too, and the calls cannot wait for the match. The work is checked with a single worker,
+// which stops at the block holding the match.
+template <typename Policy>
+void
+test_last_match(const Policy& policy, std::size_t pos, bool check_work)
+{
+    std::vector<int> data(n, 0);
+    data[pos] = 1;
+    data[pos / 2] = 1;
+    std::vector<int> needle{1};
+
+    std::atomic<std::size_t> calls{0};
+    auto it = std::find_end(policy, data.begin(), data.end(), needle.begin(), needle.end(), [&calls](int x, int y) {
+        calls.fetch_add(1, std::memory_order_relaxed);
+        return x == y;
+    });
+    EXPECT_TRUE(it == data.begin() + pos, "wrong result of find_end");
+    EXPECT_TRUE(!check_work || calls <= n - pos + find_block(policy), "find_end searched too far before the match");
+}
+
+// __parallel_or cancels the loop once the answer is known: the chunks started later call no predicate. The work is
+// checked with the simple partitioner, which bounds the chunks by the grain size on every backend.
+template <typename Policy>
+void
+test_any_match(const Policy& policy, std::size_t pos, bool check_work)
+{
+    std::vector<int> data(n, 0), other(n, 0);
+    data[pos] = 1;
+    const std::size_t grain = oneapi::dpl::__internal::__get_host_policy_params(policy).__grainsize;
+    // the OpenMP backend spreads the leftover elements over the first chunks
+    const std::size_t bound = work_bound(policy, pos, grain + 1);
+
+    work_counter any_of_work;
+    EXPECT_TRUE(std::any_of(policy, data.begin(), data.end(),
+                            [&](const int& x) {
+                                any_of_work.count(std::size_t(&x - data.data()) > pos);
+                                return x == 1 && any_of_work.match();
+                            }),
+                "wrong result of any_of");
+    EXPECT_TRUE(!check_work || any_of_work.within(bound), "any_of was not cancelled");
+
+    work_counter equal_work;
+    EXPECT_TRUE(!std::equal(policy, data.begin(), data.end(), other.begin(),
+                            [&](const int& x, const int&) {
+                                equal_work.count(std::size_t(&x - data.data()) > pos);
+                                return x == 0 || !equal_work.match();
+                            }),
+                "wrong result of equal");
+    EXPECT_TRUE(!check_work || equal_work.within(bound), "equal was not cancelled");
+}
+
+// The predicates counting their calls are not vectorization-safe, so the unsequenced policy is checked for
+// the results only
+void
+test_unsequenced(std::size_t pos)
+{
+    using namespace oneapi::dpl::execution;
+    std::vector<int> data(n);
+    std::iota(data.begin(), data.end(), 0);
+    EXPECT_TRUE(std::find(par_unseq, data.begin(), data.end(), int(pos)) == data.begin() + pos,
+                "wrong result of find with par_unseq");
+    std::vector<int> needle{int(pos), int(pos) + 1};
+    EXPECT_TRUE(std::search(par_unseq, data.begin(), data.end(), needle.begin(), needle.end()) == data.begin() + pos,
+                "wrong result of search with par_unseq");
+    EXPECT_TRUE(std::find_end(par_unseq, data.begin(), data.end(), needle.begin(), needle.end()) ==
+                    data.begin() + pos,
+                "wrong result of find_end with par_unseq");
+    data[pos + 1] = data[pos];
+    EXPECT_TRUE(std::adjacent_find(par_unseq, data.begin(), data.end()) == data.begin() + pos,
+                "wrong result of adjacent_find with par_unseq");
+    data[pos + 1] = data[pos] - 1;
+    EXPECT_TRUE(std::is_sorted_until(par_unseq, data.begin(), data.end()) == data.begin() + pos + 1,
+                "wrong result of is_sorted_until with par_unseq");
+}
+
+template <typename Policy>
+void
+test_policy(const Policy& policy)
+{
+    for (std::size_t pos : {std::size_t(0), std::size_t(1000), std::size_t(100000), n / 2, n - 2})
+        test_first_match(policy, pos);
+    for (std::size_t pos : {std::size_t(2), n / 2, n - 100000, n - 1})
+        test_last_match(policy, pos, concurrency(policy) == 1);
+}
+#endif // !TEST_ONLY_HETERO_POLICIES
+
+std::int32_t
+main()
+{
+#if !TEST_ONLY_HETERO_POLICIES
+    using namespace oneapi::dpl::execution;
+    test_policy(par);
+    test_policy(par.with(grainsize(50000)));
+    test_policy(par.with(num_threads(4)));
+    test_policy(par.with(num_threads(1)));
+    for (std::size_t pos : {std::size_t(0), std::size_t(1000), n - 1})
+    {
+        test_any_match(par.with(partitioner::simple, grainsize(2048)), pos, /*check_work*/ true);
+        test_any_match(par.with(partitioner::simple, grainsize(100000), num_threads(4)), pos, /*check_work*/ true);
+        // the chunks of the other partitioners are not known to the test
+        test_any_match(par, pos, /*check_work*/ false);
+        test_any_match(par.with(partitioner::static_), pos, /*check_work*/ false);
+    }
+    for (std::size_t pos : {std::size_t(0), std::size_t(1000), n / 2, n - 2})
+        test_unsequenced(pos);
+#endif // !TEST_ONLY_HETERO_POLICIES
+
+    return TestUtils::done();
+}
@@ -0,0 +1,118 @@
+// -*- C++ -*-
+//===-- for_each_chunk.pass.cpp -------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include <oneapi/dpl/execution>
+#include <oneapi/dpl/algorithm>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+#include "support/utils.h"
+
+using namespace TestUtils;
+
+// A scratch state counting its copies, which must not be more than the chunks
+struct Scratch
+{
+    std::atomic<std::int32_t>* copies;
+    std::vector<std::int32_t> buffer;
+    std::int32_t chunks = 0;
+
+    explicit Scratch(std::atomic<std::int32_t>* c) : copies(c) {}
+    Scratch(const Scratch& other) : copies(other.copies), buffer(other.buffer), chunks(other.chunks) { ++*copies; }
+};
+
+template <typename Policy>
+void
+test_for_each_chunk(const Policy& exec, std::int32_t n)
+{
+    std::vector<std::int32_t> in(n), out(n, -1);
+    std::iota(in.begin(), in.end(), 0);
+
+    std::atomic<std::int32_t> copies{0}, chunks{0};
+    Scratch init(&copies);
+    oneapi::dpl::for_each_chunk(exec, in.begin(), in.end(), init,
+                                [&](Scratch& s, std::vector<std::int32_t>::iterator first,
+                                    std::vector<std::int32_t>::iterator last) {
+                                    // The scratch buffer is kept by the state from the previous chunks
+                                    s.buffer.assign(first, last);
+                                    std::transform(s.buffer.begin(), s.buffer.end(), out.begin() + (first - in.begin()),
+                                                   [](std::int32_t x) { return x * 2; });
+                                    ++s.chunks;
+                                    ++chunks;
+                                });
+    bool ok = true;
+    for (std::int32_t i = 0; i < n; ++i)
+        ok = ok && out[i] == 2 * i;
+    EXPECT_TRUE(ok, "wrong effect of for_each_chunk");
+    EXPECT_TRUE(copies <= chunks, "more states than chunks created by for_each_chunk");
+    EXPECT_TRUE(n > 0 || chunks == 0, "a chunk of an empty sequence processed by for_each_chunk");
+}
+
+template <typename Policy>
+void
+test_transform_reduce_chunk(const Policy& exec, std::int32_t n)
+{
+    std::vector<std::int32_t> in(n);
+    std::iota(in.begin(), in.end(), 0);
+    using It = std::vector<std::int32_t>::iterator;
+
+    // The sum computed in a buffer of the state
+    auto sum = oneapi::dpl::transform_reduce_chunk(exec, in.begin(), in.end(), std::vector<std::int64_t>(),
+                                                   std::int64_t(5), std::plus<std::int64_t>(),
+                                                   [](std::vector<std::int64_t>& buf, It first, It last) {
+                                                       buf.assign(first, last);
+                                                       return std::accumulate(buf.begin(), buf.end(), std::int64_t(0));
+                                                   });
+    EXPECT_TRUE(sum == std::int64_t(n) * (n - 1) / 2 + 5, "wrong result of transform_reduce_chunk");
+
+    // A non-commutative operation, the chunk results must be combined in the order of the chunks
+    using Span = std::pair<std::int32_t, std::int32_t>;
+    auto join = [](Span a, Span b) { return a.second == b.first ? Span(a.first, b.second) : Span(-1, -1); };
+    auto span = oneapi::dpl::transform_reduce_chunk(exec, in.begin(), in.end(), 0, Span(-3, 0), join,
+                                                    [](std::int32_t&, It first, It last) {
+                                                        return Span(*first, *(last - 1) + 1);
+                                                    });
+    EXPECT_TRUE(span == Span(-3, n), "wrong order of the chunks of transform_reduce_chunk");
+}
+
+template <typename Policy>
+void
+test_policy(const Policy& exec)
+{
+    for (std::int32_t n : {0, 1, 17, 1000, 100000, 1000003})
+    {
+        test_for_each_chunk(exec, n);
+        test_transform_reduce_chunk(exec, n);
+    }
+}
+
+std::int32_t
+main()
+{
+    test_policy(oneapi::dpl::execution::seq);
+    test_policy(oneapi::dpl::execution::unseq);
+    test_policy(oneapi::dpl::execution::par);
+    test_policy(oneapi::dpl::execution::par_unseq);
+    test_policy(oneapi::dpl::execution::par.with(oneapi::dpl::execution::grainsize{100}));
+
+    return done();
+}
@@ -141,5 +141,13 @@ main()
     test_algo_three_sequences<ValueType, test_binary_search>();
 #endif // TEST_DPCPP_BACKEND_PRESENT
 
+#if !TEST_ONLY_HETERO_POLICIES
+    test_random_host_queries<ValueType>(
+        [](auto&& exec, auto first, auto last, auto value_first, auto value_last, auto result_first) {
+            oneapi::dpl::binary_search(exec, first, last, value_first, value_last, result_first);
+        },
+        [](auto first, auto last, ValueType value) -> ValueType { return ::std::binary_search(first, last, value); });
+#endif
+
     return TestUtils::done();
 }
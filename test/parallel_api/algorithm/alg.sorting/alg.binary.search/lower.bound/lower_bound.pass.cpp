@@ -135,5 +135,13 @@ main()
     test_algo_three_sequences<ValueType, test_lower_bound>();
 #endif // TEST_DPCPP_BACKEND_PRESENT
 
+#if !TEST_ONLY_HETERO_POLICIES
+    test_random_host_queries<ValueType>(
+        [](auto&& exec, auto first, auto last, auto value_first, auto value_last, auto result_first) {
+            oneapi::dpl::lower_bound(exec, first, last, value_first, value_last, result_first);
+        },
+        [](auto first, auto last, ValueType value) -> ValueType { return ::std::lower_bound(first, last, value) - first; });
+#endif
+
     return TestUtils::done();
 }
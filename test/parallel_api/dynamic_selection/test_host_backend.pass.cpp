@@ -0,0 +1,161 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include "oneapi/dpl/dynamic_selection"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include "support/test_dynamic_selection_utils.h"
+#include "support/utils.h"
+
+#if !_DS_BACKEND_SYCL
+using pool_t = oneapi::dpl::experimental::host_thread_pool;
+using backend_t = oneapi::dpl::experimental::host_backend<pool_t*>;
+
+template <typename Policy, typename Resource, typename ResourceFunction>
+void
+test_policy(const std::vector<Resource>& u, ResourceFunction&& f, bool wait_on_group = true)
+{
+    constexpr bool just_call_submit = false;
+    constexpr bool call_select_before_submit = true;
+
+    EXPECT_EQ(0, (test_initialization<Policy, Resource>(u)), "wrong initialization of the policy");
+    EXPECT_EQ(0, (test_submit_and_wait_on_event<just_call_submit, Policy>(u, f)), "wrong submit and wait on event");
+    EXPECT_EQ(0, (test_submit_and_wait_on_event<call_select_before_submit, Policy>(u, f)),
+              "wrong submit and wait on event");
+    EXPECT_EQ(0, (test_submit_and_wait<just_call_submit, Policy>(u, f)), "wrong submit and wait");
+    EXPECT_EQ(0, (test_submit_and_wait<call_select_before_submit, Policy>(u, f)), "wrong submit and wait");
+    // the tasks of test_submit_and_wait_on_group<call_select_before_submit> refer to the locals of the loop
+    // submitting them, so it runs with inline backends only
+    if (wait_on_group)
+        EXPECT_EQ(0, (test_submit_and_wait_on_group<just_call_submit, Policy>(u, f)), "wrong wait on group");
+}
+
+// The load reported at submission lasts until the completion of the task
+void
+test_dynamic_load_reports(const std::vector<pool_t*>& u)
+{
+    oneapi::dpl::experimental::dynamic_load_policy<backend_t> p{u};
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+
+    auto blocked = oneapi::dpl::experimental::submit(p, [released](pool_t* r) {
+        released.wait();
+        return r;
+    });
+    auto w = oneapi::dpl::experimental::submit(p, [](pool_t* r) { return r; });
+    EXPECT_TRUE(w.unwrap().get() != u[0], "a loaded resource is selected by dynamic_load_policy");
+    release.set_value();
+    EXPECT_TRUE(blocked.unwrap().get() == u[0], "the unloaded resource is not selected by dynamic_load_policy");
+    w = oneapi::dpl::experimental::submit(p, [](pool_t* r) { return r; });
+    EXPECT_TRUE(w.unwrap().get() == u[0], "the load is not released at task completion");
+}
+
+// The measured execution times make auto_tune_policy choose the fastest resource once all are profiled
+void
+test_auto_tune_reports(const std::vector<pool_t*>& u)
+{
+    oneapi::dpl::experimental::auto_tune_policy<backend_t> p{u};
+    const std::vector<int> delays{8, 1, 5};
+    auto f = [&](pool_t* r) {
+        const auto i = std::find(u.begin(), u.end(), r) - u.begin();
+        std::this_thread::sleep_for(std::chrono::milliseconds(delays[i]));
+        return r;
+    };
+
+    bool pass = true;
+    for (std::size_t i = 1; i <= 4 * u.size(); ++i)
+    {
+        auto s = oneapi::dpl::experimental::select(p, f);
+        auto w = oneapi::dpl::experimental::submit(s, f);
+        oneapi::dpl::experimental::wait(w);
+        pool_t* expected = i <= 2 * u.size() ? u[(i - 1) % u.size()] : u[1];
+        pass = pass && w.unwrap().get() == expected;
+    }
+    EXPECT_TRUE(pass, "auto_tune_policy did not select the fastest resource");
+}
+
+void
+test_task_results(const std::vector<pool_t*>& u)
+{
+    oneapi::dpl::experimental::round_robin_policy<backend_t> p{u};
+
+    auto w = oneapi::dpl::experimental::submit(p, [](pool_t*, int x, const std::unique_ptr<int>& y) { return x + *y; },
+                                               40, std::make_unique<int>(2));
+    EXPECT_EQ(42, w.unwrap().get(), "wrong result of the submitted function");
+
+    auto failed = oneapi::dpl::experimental::submit(p, [](pool_t*) { throw std::runtime_error("task failed"); });
+    bool thrown = false;
+    try
+    {
+        oneapi::dpl::experimental::wait(failed);
+    }
+    catch (const std::runtime_error&)
+    {
+        thrown = true;
+    }
+    EXPECT_TRUE(thrown, "the exception of the submitted function is not rethrown by wait");
+}
+
+// The policy released by its last task, with the backend and the resources it owns
+void
+test_default_resources()
+{
+    std::atomic<bool> done = false;
+    {
+        oneapi::dpl::experimental::round_robin_policy<> p;
+        EXPECT_TRUE(!oneapi::dpl::experimental::get_resources(p).empty(), "no default resources of host_backend");
+        oneapi::dpl::experimental::submit_and_wait(p, [](auto) {});
+        oneapi::dpl::experimental::submit(p, [&done](auto) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            done = true;
+        });
+    }
+    while (!done)
+        std::this_thread::yield();
+}
+#endif // !_DS_BACKEND_SYCL
+
+int
+main()
+{
+#if !_DS_BACKEND_SYCL
+    pool_t p1{1}, p2{2}, p3{4};
+    const std::vector<pool_t*> u{&p1, &p2, &p3};
+
+    test_policy<oneapi::dpl::experimental::round_robin_policy<backend_t>>(
+        u, [&u](int i) { return u[(i - 1) % u.size()]; });
+    test_policy<oneapi::dpl::experimental::fixed_resource_policy<backend_t>>(u, [&u](int) { return u[0]; });
+    // tasks in flight load their resource, so only the resource of a sole task is known
+    test_policy<oneapi::dpl::experimental::dynamic_load_policy<backend_t>>(u, [&u](int) { return u[0]; }, false);
+
+    test_dynamic_load_reports(u);
+    test_auto_tune_reports(u);
+    test_task_results(u);
+    test_default_resources();
+
+#    if _ONEDPL_PAR_BACKEND_TBB
+    tbb::task_arena a1{1}, a2{2};
+    const std::vector<tbb::task_arena*> arenas{&a1, &a2};
+    test_policy<oneapi::dpl::experimental::round_robin_policy<>>(
+        arenas, [&arenas](int i) { return arenas[(i - 1) % arenas.size()]; });
+#    endif
+#endif // !_DS_BACKEND_SYCL
+
+    return TestUtils::done();
+}
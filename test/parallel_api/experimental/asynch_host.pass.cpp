@@ -0,0 +1,135 @@
+// -*- C++ -*-
+//===-- asynch_host.pass.cpp ----------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include "oneapi/dpl/async"
+#include "oneapi/dpl/execution"
+
+#include "support/utils.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+using namespace TestUtils;
+
+namespace async = oneapi::dpl::experimental;
+
+// Two independent chains of stages run concurrently, and are joined by the stages depending on both
+template <typename Policy>
+void
+test_chains(const Policy& exec, std::int32_t n)
+{
+    std::vector<std::int32_t> x(n), y(n), z(n), w(n);
+
+    auto fill_x = async::fill_async(exec, x.begin(), x.end(), 1);
+    auto fill_y = async::fill_async(exec, y.begin(), y.end(), 7);
+    auto inc_x = async::for_each_async(exec, x.begin(), x.end(), [](std::int32_t& e) { ++e; }, fill_x); // x = [2..2]
+    auto half_y = async::transform_async(
+        exec, y.begin(), y.end(), y.begin(), [](std::int32_t e) { return e / 2; }, fill_y); // y = [3..3]
+    auto sum_xy = async::transform_async(exec, x.begin(), x.end(), y.begin(), z.begin(), std::plus<std::int32_t>(),
+                                         inc_x, half_y); // z = [5..5]
+    EXPECT_TRUE(sum_xy.get() == z.end(), "wrong result of transform_async");
+
+    EXPECT_TRUE(async::reduce_async(exec, z.begin(), z.end(), sum_xy).get() == 5 * n, "wrong result of reduce_async");
+    EXPECT_TRUE(async::reduce_async(exec, z.begin(), z.end(), 3).get() == 5 * n + 3, "wrong result of reduce_async");
+    auto max_op = [](std::int32_t a, std::int32_t b) { return std::max(a, b); };
+    EXPECT_TRUE(async::reduce_async(exec, z.begin(), z.end(), 1, max_op).get() == (n > 0 ? 5 : 1),
+                "wrong result of reduce_async");
+    EXPECT_TRUE(async::transform_reduce_async(exec, x.begin(), x.end(), y.begin(), 0).get() == 6 * n,
+                "wrong result of transform_reduce_async");
+    EXPECT_TRUE(async::transform_reduce_async(exec, x.begin(), x.end(), y.begin(), 0, std::plus<std::int32_t>(),
+                                              std::minus<std::int32_t>())
+                        .get() == -n,
+                "wrong result of transform_reduce_async");
+    EXPECT_TRUE(async::transform_reduce_async(exec, x.begin(), x.end(), 0, std::plus<std::int32_t>(),
+                                              [](std::int32_t e) { return e * 10; })
+                        .get() == 20 * n,
+                "wrong result of transform_reduce_async");
+
+    // The copy and the scans of the same input may overlap, as the outputs are distinct
+    std::iota(x.begin(), x.end(), 0);
+    auto copied = async::copy_async(exec, x.begin(), x.end(), w.begin());
+    auto scanned = async::inclusive_scan_async(exec, x.begin(), x.end(), z.begin());
+    async::wait_for_all(copied, scanned);
+    EXPECT_TRUE(w == x, "wrong effect of copy_async");
+    std::vector<std::int32_t> expected(n);
+    std::inclusive_scan(x.begin(), x.end(), expected.begin());
+    EXPECT_TRUE(z == expected, "wrong effect of inclusive_scan_async");
+
+    async::inclusive_scan_async(exec, x.begin(), x.end(), z.begin(), std::plus<std::int32_t>(), 10).wait();
+    std::inclusive_scan(x.begin(), x.end(), expected.begin(), std::plus<std::int32_t>(), 10);
+    EXPECT_TRUE(z == expected, "wrong effect of inclusive_scan_async with an initial value");
+
+    async::exclusive_scan_async(exec, x.begin(), x.end(), z.begin(), 10, std::plus<std::int32_t>()).wait();
+    std::exclusive_scan(x.begin(), x.end(), expected.begin(), 10);
+    EXPECT_TRUE(z == expected, "wrong effect of exclusive_scan_async");
+
+    auto twice = [](std::int32_t e) { return 2 * e; };
+    async::transform_inclusive_scan_async(exec, x.begin(), x.end(), z.begin(), std::plus<std::int32_t>(), twice, 1)
+        .wait();
+    std::transform_inclusive_scan(x.begin(), x.end(), expected.begin(), std::plus<std::int32_t>(), twice, 1);
+    EXPECT_TRUE(z == expected, "wrong effect of transform_inclusive_scan_async");
+
+    auto scan = async::transform_exclusive_scan_async(exec, x.begin(), x.end(), z.begin(), 0,
+                                                      std::plus<std::int32_t>(), twice);
+    auto sorted = async::sort_async(exec, z.begin(), z.end(), std::greater<std::int32_t>(), scan);
+    sorted.wait();
+    EXPECT_TRUE(std::is_sorted(z.begin(), z.end(), std::greater<std::int32_t>()), "wrong effect of sort_async");
+    async::sort_async(exec, z.begin(), z.end(), sorted).wait();
+    EXPECT_TRUE(std::is_sorted(z.begin(), z.end()), "wrong effect of sort_async");
+}
+
+// An algorithm runs even if its future is never waited for. The serial backend runs it before returning the
+// future; the other backends may run it after the sequence is gone, so they are not tested.
+template <typename Policy>
+void
+test_dropped_future(const Policy& exec, std::int32_t n)
+{
+#if _ONEDPL_PAR_BACKEND_SERIAL
+    std::vector<std::int32_t> x(n);
+    async::fill_async(exec, x.begin(), x.end(), 3);
+    EXPECT_TRUE(std::all_of(x.begin(), x.end(), [](std::int32_t e) { return e == 3; }),
+                "fill_async does not run without waiting for its future");
+#else
+    (void)exec;
+    (void)n;
+#endif
+}
+
+template <typename Policy>
+void
+test_policy(const Policy& exec)
+{
+    for (std::int32_t n : {0, 1, 17, 1000, 100000})
+    {
+        test_chains(exec, n);
+        test_dropped_future(exec, n);
+    }
+}
+
+std::int32_t
+main()
+{
+    test_policy(oneapi::dpl::execution::seq);
+    test_policy(oneapi::dpl::execution::unseq);
+    test_policy(oneapi::dpl::execution::par);
+    test_policy(oneapi::dpl::execution::par_unseq);
+
+    return done();
+}
@@ -0,0 +1,103 @@
+// -*- C++ -*-
+//===-- for_loop_nd.pass.cpp ----------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+#include "oneapi/dpl/execution"
+#include "oneapi/dpl/pstl/experimental/algorithm"
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+#include "support/utils.h"
+
+using namespace TestUtils;
+
+// Every index of the space is visited exactly once, and the reductions and the induction see the row-major ordinals
+template <typename Policy, std::size_t Rank>
+void
+test_space(const Policy& exec, const std::array<std::int32_t, Rank>& extents,
+           const std::array<std::int32_t, Rank>& tile_shape, std::experimental::tile_order order)
+{
+    std::size_t n = 1;
+    for (auto extent : extents)
+        n *= extent;
+
+    std::vector<std::atomic<std::int32_t>> visits(n);
+    for (auto& v : visits)
+        v = 0;
+    std::atomic<bool> wrong_induction{false};
+
+    std::int64_t sum = 0;
+    std::int64_t max = -1;
+    std::int64_t ind = 0;
+    std::experimental::for_loop_nd(
+        exec, extents, tile_shape, order, std::experimental::reduction_plus(sum),
+        std::experimental::reduction_max(max), std::experimental::induction(ind),
+        [&](const std::array<std::int32_t, Rank>& idx, std::int64_t& s, std::int64_t& m, std::int64_t i) {
+            std::int64_t pos = 0;
+            for (std::size_t d = 0; d < Rank; ++d)
+                pos = pos * extents[d] + idx[d];
+            ++visits[pos];
+            if (i != pos)
+                wrong_induction = true;
+            s += pos;
+            m = std::max(m, pos);
+        });
+
+    bool once = true;
+    for (auto& v : visits)
+        once = once && v == 1;
+    EXPECT_TRUE(once, "each index must be visited exactly once");
+    EXPECT_TRUE(!wrong_induction, "wrong value of the induction");
+    EXPECT_TRUE(sum == std::int64_t(n) * (std::int64_t(n) - 1) / 2, "wrong result of reduction_plus");
+    EXPECT_TRUE(max == std::int64_t(n) - 1, "wrong result of reduction_max");
+    EXPECT_TRUE(ind == std::int64_t(n), "wrong final value of the induction");
+}
+
+template <typename Policy>
+void
+test_policy(const Policy& exec)
+{
+    using std::experimental::tile_order;
+    for (tile_order order : {tile_order::row_major, tile_order::morton})
+    {
+        test_space<Policy, 1>(exec, {1000}, {64}, order);
+        test_space<Policy, 2>(exec, {0, 7}, {0, 0}, order);
+        test_space<Policy, 2>(exec, {37, 101}, {8, 16}, order);
+        test_space<Policy, 2>(exec, {300, 700}, {0, 0}, order);
+        test_space<Policy, 2>(exec, {5, 1000}, {2, 0}, order);
+        test_space<Policy, 3>(exec, {13, 9, 50}, {4, 4, 8}, order);
+        test_space<Policy, 3>(exec, {3, 64, 64}, {0, 0, 0}, order);
+    }
+
+    // The default order is row-major, and the callable may take no reduction
+    std::vector<std::int32_t> matrix(20 * 30, 0);
+    std::experimental::for_loop_nd(exec, std::array<std::int32_t, 2>{20, 30}, std::array<std::int32_t, 2>{6, 7},
+                                   [&](std::array<std::int32_t, 2> idx) { matrix[idx[0] * 30 + idx[1]] += 1; });
+    EXPECT_TRUE(std::count(matrix.begin(), matrix.end(), 1) == 20 * 30, "each element must be visited exactly once");
+}
+
+std::int32_t
+main()
+{
+    test_policy(oneapi::dpl::execution::seq);
+    test_policy(oneapi::dpl::execution::unseq);
+    test_policy(oneapi::dpl::execution::par);
+    test_policy(oneapi::dpl::execution::par_unseq);
+    test_policy(oneapi::dpl::execution::par_unseq.with(oneapi::dpl::execution::grainsize(1)));
+
+    return done();
+}
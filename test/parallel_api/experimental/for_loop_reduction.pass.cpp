@@ -59,13 +59,40 @@ test_body_reduction(Policy&& exec, Iterator first, Iterator last, Iterator /* ex
     EXPECT_TRUE(var2 == var2_exp, "wrong result of reduction 2");
 }
 
+// The reductions of a vectorized loop are accumulated per lane, while an induction still follows the iteration
+template <typename T, typename Policy, typename Size>
+void
+test_body_reduction_induction(Policy&& exec, Size n)
+{
+
+    T sum = 0, max = 0;
+    Size ind = 0;
+    ::std::experimental::for_loop_n(::std::forward<Policy>(exec), Size(0), n, ::std::experimental::reduction_plus(sum),
+                                    ::std::experimental::reduction_max(max), ::std::experimental::induction(ind, 2),
+                                    [](Size i, T& sum_acc, T& max_acc, Size j) {
+                                        EXPECT_TRUE(j == 2 * i, "wrong induction value");
+                                        sum_acc += T(i % 5);
+                                        max_acc = ::std::max(max_acc, T(i));
+                                    });
+
+    T sum_exp = 0;
+    for (Size i = 0; i < n; ++i)
+        sum_exp += T(i % 5);
+
+    EXPECT_TRUE(sum == sum_exp, "wrong result of reduction_plus with an induction");
+    EXPECT_TRUE(max == (n > 0 ? T(n - 1) : T(0)), "wrong result of reduction_max with an induction");
+    EXPECT_TRUE(ind == 2 * n, "wrong result of induction with reductions");
+}
+
 struct test_body
 {
     template <typename Policy, typename Iterator, typename Size>
     void
     operator()(Policy&& exec, Iterator first, Iterator last, Iterator expected_first, Iterator expected_last, Size n)
     {
-        test_body_reduction(::std::forward<Policy>(exec), first, last, expected_first, expected_last, n);
+        test_body_reduction(exec, first, last, expected_first, expected_last, n);
+        test_body_reduction_induction<typename ::std::iterator_traits<Iterator>::value_type>(
+            ::std::forward<Policy>(exec), n);
     }
 };
 
@@ -0,0 +1,228 @@
+// -*- C++ -*-
+//===-- pipeline.pass.cpp -------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include <oneapi/dpl/execution>
+#include <oneapi/dpl/algorithm>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <string>
+#include <vector>
+
+#include "support/utils.h"
+
+using namespace TestUtils;
+
+// The fused stages must give the results of the algorithms run over the intermediate sequences
+template <typename Policy>
+void
+test_pipeline(const Policy& exec, std::int32_t n)
+{
+    std::vector<std::int32_t> in(n);
+    std::iota(in.begin(), in.end(), 0);
+
+    auto triple = [](std::int32_t x) { return std::int64_t(x) * 3; };
+    auto is_even = [](std::int64_t x) { return x % 2 == 0; };
+    auto not_div5 = [](std::int64_t x) { return x % 5 != 0; };
+    auto minus_one = [](std::int64_t x) { return x - 1; };
+
+    // The reference sequence of in | transform(triple) | filter(is_even) | filter(not_div5) | transform(minus_one)
+    std::vector<std::int64_t> expected;
+    for (std::int32_t x : in)
+        if (is_even(triple(x)) && not_div5(triple(x)))
+            expected.push_back(minus_one(triple(x)));
+
+    const auto unfiltered = oneapi::dpl::experimental::pipeline(exec, in.begin(), in.end()).transform(triple);
+    const auto filtered = unfiltered.filter(is_even).filter(not_div5).transform(minus_one);
+
+    // reduce
+    EXPECT_TRUE(unfiltered.reduce() == std::int64_t(3) * n * (n - 1) / 2, "wrong result of reduce without filters");
+    EXPECT_TRUE(filtered.reduce(std::int64_t(7)) == std::accumulate(expected.begin(), expected.end(), std::int64_t(7)),
+                "wrong result of reduce with filters");
+    // A non-commutative operation, the partial sums must be combined in order
+    auto first_of = [](std::int64_t x, std::int64_t) { return x; };
+    EXPECT_TRUE(filtered.reduce(std::int64_t(-5), first_of) == -5, "wrong order of the operands of reduce");
+    auto max_op = [](std::int64_t x, std::int64_t y) { return std::max(x, y); };
+    EXPECT_TRUE(filtered.reduce(std::int64_t(-5), max_op) == (expected.empty() ? -5 : expected.back()),
+                "wrong result of reduce with filters and a custom operation");
+    EXPECT_TRUE(filtered.filter([](std::int64_t) { return false; }).reduce(std::int64_t(42)) == 42,
+                "wrong result of reduce with nothing passing the filters");
+
+    // copy
+    std::vector<std::int64_t> out(n, -1);
+    auto out_last = filtered.copy(out.begin());
+    EXPECT_TRUE(out_last - out.begin() == std::ptrdiff_t(expected.size()), "wrong result of copy with filters");
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), out.begin()), "wrong effect of copy with filters");
+    EXPECT_TRUE(std::all_of(out_last, out.end(), [](std::int64_t x) { return x == -1; }),
+                "copy with filters must not write past the result");
+
+    out_last = unfiltered.copy(out.begin());
+    EXPECT_TRUE(out_last == out.end(), "wrong result of copy without filters");
+    EXPECT_TRUE(std::equal(in.begin(), in.end(), out.begin(), [triple](std::int32_t x, std::int64_t y) {
+                    return triple(x) == y;
+                }),
+                "wrong effect of copy without filters");
+
+    // inclusive_scan
+    std::vector<std::int64_t> expected_scan(expected.size());
+    std::inclusive_scan(expected.begin(), expected.end(), expected_scan.begin());
+    std::fill(out.begin(), out.end(), -1);
+    out_last = filtered.inclusive_scan(out.begin());
+    EXPECT_TRUE(out_last - out.begin() == std::ptrdiff_t(expected.size()),
+                "wrong result of inclusive_scan with filters");
+    EXPECT_TRUE(std::equal(expected_scan.begin(), expected_scan.end(), out.begin()),
+                "wrong effect of inclusive_scan with filters");
+
+    std::vector<std::int64_t> unfiltered_scan(n);
+    std::transform_inclusive_scan(in.begin(), in.end(), unfiltered_scan.begin(), std::plus<std::int64_t>(), triple);
+    out_last = unfiltered.inclusive_scan(out.begin());
+    EXPECT_TRUE(out_last == out.end(), "wrong result of inclusive_scan without filters");
+    EXPECT_TRUE(out == unfiltered_scan, "wrong effect of inclusive_scan without filters");
+
+    // exclusive_scan
+    std::exclusive_scan(expected.begin(), expected.end(), expected_scan.begin(), std::int64_t(10));
+    std::fill(out.begin(), out.end(), -1);
+    out_last = filtered.exclusive_scan(out.begin(), std::int64_t(10));
+    EXPECT_TRUE(out_last - out.begin() == std::ptrdiff_t(expected.size()),
+                "wrong result of exclusive_scan with filters");
+    EXPECT_TRUE(std::equal(expected_scan.begin(), expected_scan.end(), out.begin()),
+                "wrong effect of exclusive_scan with filters");
+
+    std::transform_exclusive_scan(in.begin(), in.end(), unfiltered_scan.begin(), std::int64_t(10),
+                                  std::plus<std::int64_t>(), triple);
+    out_last = unfiltered.exclusive_scan(out.begin(), std::int64_t(10));
+    EXPECT_TRUE(out_last == out.end(), "wrong result of exclusive_scan without filters");
+    EXPECT_TRUE(out == unfiltered_scan, "wrong effect of exclusive_scan without filters");
+
+    // An inclusive scan without an initial value is seeded by the first value passing the filters
+    std::fill(out.begin(), out.end(), -1);
+    out_last = filtered.inclusive_scan(out.begin(), first_of);
+    EXPECT_TRUE(out_last - out.begin() == std::ptrdiff_t(expected.size()),
+                "wrong result of inclusive_scan with filters and a custom operation");
+    EXPECT_TRUE(std::all_of(out.begin(), out_last, [&expected](std::int64_t x) { return x == expected.front(); }),
+                "wrong seed of inclusive_scan with filters");
+}
+
+// Each stage is computed once per element in a pass over the input, and the filters see the computed values
+template <typename Policy>
+void
+test_stage_calls(const Policy& exec, std::int32_t n)
+{
+    std::vector<std::int32_t> in(n);
+    std::iota(in.begin(), in.end(), 0);
+    std::vector<std::int64_t> out(n);
+
+    std::atomic<std::int64_t> calls{0};
+    const auto filtered = oneapi::dpl::experimental::pipeline(exec, in.begin(), in.end())
+                              .transform([&calls](std::int32_t x) {
+                                  ++calls;
+                                  return std::int64_t(x);
+                              })
+                              .filter([](std::int64_t x) { return x % 2 == 0; })
+                              .filter([](std::int64_t x) { return x % 3 == 0; })
+                              .transform([](std::int64_t x) { return x + 1; });
+
+    filtered.reduce(std::int64_t(0));
+    EXPECT_EQ(std::int64_t(n), calls.load(), "the stages of reduce are computed more than once per element");
+
+    // The compaction and the scan traverse the input twice, to count and to write the values
+    calls = 0;
+    filtered.copy(out.begin());
+    EXPECT_TRUE(calls <= 2 * std::int64_t(n), "the stages of copy are computed more than once per element and pass");
+    calls = 0;
+    filtered.inclusive_scan(out.begin());
+    EXPECT_TRUE(calls <= 2 * std::int64_t(n),
+                "the stages of inclusive_scan are computed more than once per element and pass");
+}
+
+// The values of a non-trivial type, with an associative operation keeping the end of the concatenation
+template <typename Policy>
+void
+test_string_values(const Policy& exec, std::int32_t n)
+{
+    std::vector<std::int32_t> in(n);
+    std::iota(in.begin(), in.end(), 0);
+
+    auto to_string = [](std::int32_t x) { return std::to_string(x) + ", a value longer than the small buffer"; };
+    auto not_div3 = [](const std::string& x) { return (x[0] - '0') % 3 != 0; };
+    auto concat_tail = [](const std::string& x, const std::string& y) {
+        std::string z = x + y;
+        return z.size() > 64 ? z.substr(z.size() - 64) : z;
+    };
+
+    std::vector<std::string> expected;
+    for (std::int32_t x : in)
+        if (not_div3(to_string(x)))
+            expected.push_back(to_string(x));
+
+    const auto filtered = oneapi::dpl::experimental::pipeline(exec, in.begin(), in.end())
+                              .transform(to_string)
+                              .filter(not_div3);
+
+    // reduce may reorder the operands, unlike the scans
+    auto max_op = [](const std::string& x, const std::string& y) { return std::max(x, y); };
+    EXPECT_TRUE(filtered.reduce(std::string("1"), max_op) ==
+                    std::accumulate(expected.begin(), expected.end(), std::string("1"), max_op),
+                "wrong result of reduce of strings");
+
+    std::vector<std::string> out(n, "none");
+    auto out_last = filtered.copy(out.begin());
+    EXPECT_TRUE(out_last - out.begin() == std::ptrdiff_t(expected.size()), "wrong result of copy of strings");
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), out.begin()), "wrong effect of copy of strings");
+
+    std::vector<std::string> expected_scan(expected.size());
+    std::inclusive_scan(expected.begin(), expected.end(), expected_scan.begin(), concat_tail);
+    out_last = filtered.inclusive_scan(out.begin(), concat_tail);
+    EXPECT_TRUE(out_last - out.begin() == std::ptrdiff_t(expected.size()),
+                "wrong result of inclusive_scan of strings");
+    EXPECT_TRUE(std::equal(expected_scan.begin(), expected_scan.end(), out.begin()),
+                "wrong effect of inclusive_scan of strings");
+
+    std::exclusive_scan(expected.begin(), expected.end(), expected_scan.begin(), std::string("init"), concat_tail);
+    out_last = filtered.exclusive_scan(out.begin(), std::string("init"), concat_tail);
+    EXPECT_TRUE(out_last - out.begin() == std::ptrdiff_t(expected.size()),
+                "wrong result of exclusive_scan of strings");
+    EXPECT_TRUE(std::equal(expected_scan.begin(), expected_scan.end(), out.begin()),
+                "wrong effect of exclusive_scan of strings");
+}
+
+template <typename Policy>
+void
+test_policy(const Policy& exec)
+{
+    for (std::int32_t n : {0, 1, 2, 17, 1000, 100000})
+    {
+        test_pipeline(exec, n);
+        test_stage_calls(exec, n);
+        test_string_values(exec, n);
+    }
+}
+
+std::int32_t
+main()
+{
+    test_policy(oneapi::dpl::execution::seq);
+    test_policy(oneapi::dpl::execution::unseq);
+    test_policy(oneapi::dpl::execution::par);
+    test_policy(oneapi::dpl::execution::par_unseq);
+
+    return done();
+}
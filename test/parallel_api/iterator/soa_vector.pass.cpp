@@ -0,0 +1,151 @@
+// -*- C++ -*-
+//===-- soa_vector.pass.cpp -----------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include _PSTL_TEST_HEADER(execution)
+#include _PSTL_TEST_HEADER(algorithm)
+#include _PSTL_TEST_HEADER(iterator)
+
+#include "support/utils.h"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#if !TEST_ONLY_HETERO_POLICIES
+using Records = oneapi::dpl::soa_vector<std::int32_t, double, std::string>;
+
+Records
+make_records(std::size_t n)
+{
+    Records records;
+    records.reserve(n);
+    for (std::size_t i = 0; i < n; ++i)
+        records.push_back(std::int32_t((i * 7919) % (n / 3 + 1)), i * 0.5, std::to_string(i));
+    return records;
+}
+
+template <typename Reference>
+std::tuple<std::int32_t, double, std::string>
+as_tuple(const Reference& record)
+{
+    return {std::get<0>(record), std::get<1>(record), std::get<2>(record)};
+}
+
+void
+test_container()
+{
+    Records records(3, 1, 2.0, "x");
+    EXPECT_EQ(std::size_t(3), records.size(), "wrong size of soa_vector");
+    EXPECT_TRUE(as_tuple(records[2]) == std::make_tuple(1, 2.0, std::string("x")), "wrong element of soa_vector");
+
+    records.push_back(4, 5.0, "y");
+    std::get<0>(records[0]) = 7;
+    EXPECT_TRUE(records.column<0>() == std::vector<std::int32_t>({7, 1, 1, 4}), "wrong column of soa_vector");
+    EXPECT_EQ(4, records.end() - records.begin(), "wrong iterators of soa_vector");
+    EXPECT_TRUE(as_tuple(records.cend()[-1]) == std::make_tuple(4, 5.0, std::string("y")),
+                "wrong iterators of soa_vector");
+
+    records.pop_back();
+    records.resize(5);
+    EXPECT_TRUE(as_tuple(records[4]) == std::make_tuple(0, 0.0, std::string()), "wrong element added by resize");
+
+    Records other;
+    swap(records, other);
+    EXPECT_TRUE(records.empty() && other.size() == 5, "wrong effect of swap");
+    other.clear();
+    EXPECT_TRUE(other == records, "wrong effect of clear");
+}
+
+// The whole records are copied column by column
+template <typename Policy>
+void
+test_copy(const Policy& policy, const Records& records)
+{
+    const std::size_t n = records.size();
+    auto pred = [](const auto& record) { return std::get<0>(record) % 3 == 0; };
+
+    Records out(n), expected(n);
+    auto end = std::copy_if(policy, records.begin(), records.end(), out.begin(), pred);
+    auto expected_end = std::copy_if(records.begin(), records.end(), expected.begin(), pred);
+    out.resize(end - out.begin());
+    expected.resize(expected_end - expected.begin());
+    EXPECT_TRUE(out == expected, "wrong effect of copy_if of soa_vector");
+
+    auto equal_keys = [](const auto& x, const auto& y) { return std::get<0>(x) / 4 == std::get<0>(y) / 4; };
+    out.resize(n);
+    expected.resize(n);
+    end = std::unique_copy(policy, records.cbegin(), records.cend(), out.begin(), equal_keys);
+    expected_end = std::unique_copy(records.cbegin(), records.cend(), expected.begin(), equal_keys);
+    out.resize(end - out.begin());
+    expected.resize(expected_end - expected.begin());
+    EXPECT_TRUE(out == expected, "wrong effect of unique_copy of soa_vector");
+}
+
+// The columns of the values are permuted after the keys are sorted
+template <typename Policy>
+void
+test_sort_by_key(const Policy& policy, const Records& records)
+{
+    const std::size_t n = records.size();
+    for (auto comp : {std::function<bool(std::int32_t, std::int32_t)>(std::less<std::int32_t>()),
+                      std::function<bool(std::int32_t, std::int32_t)>(std::greater<std::int32_t>())})
+    {
+        Records sorted(records);
+        std::vector<std::int32_t> keys(records.column<0>());
+        oneapi::dpl::sort_by_key(policy, keys.begin(), keys.end(), sorted.begin(), comp);
+
+        EXPECT_TRUE(std::is_sorted(keys.begin(), keys.end(), comp), "wrong order of keys sorted by sort_by_key");
+        bool permuted = true;
+        for (std::size_t i = 0; i < n; ++i)
+        {
+            // The second column holds the position of the record before the sort
+            const std::size_t from = std::size_t(std::get<1>(sorted[i]) * 2);
+            permuted = permuted && from < n && as_tuple(sorted[i]) == as_tuple(records[from]) &&
+                       keys[i] == std::get<0>(records[from]);
+        }
+        EXPECT_TRUE(permuted, "wrong permutation of the columns by sort_by_key");
+    }
+}
+
+template <typename Policy>
+void
+test_policy(const Policy& policy)
+{
+    for (std::size_t n : {0, 1, 2, 100, 10000})
+    {
+        const Records records = make_records(n);
+        test_copy(policy, records);
+        test_sort_by_key(policy, records);
+    }
+}
+#endif // !TEST_ONLY_HETERO_POLICIES
+
+int
+main()
+{
+#if !TEST_ONLY_HETERO_POLICIES
+    test_container();
+    test_policy(oneapi::dpl::execution::seq);
+    test_policy(oneapi::dpl::execution::unseq);
+    test_policy(oneapi::dpl::execution::par);
+    test_policy(oneapi::dpl::execution::par_unseq);
+#endif // !TEST_ONLY_HETERO_POLICIES
+
+    return TestUtils::done();
+}
@@ -0,0 +1,152 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+// This file incorporates work covered by the following copyright and permission
+// notice:
+//
+// Part of the LLVM Project, under the Apache License v2.0 with LLVM Exceptions.
+// See https://llvm.org/LICENSE.txt for license information.
+//
+//===----------------------------------------------------------------------===//
+
+#include "support/test_config.h"
+
+#include <oneapi/dpl/execution>
+#include <oneapi/dpl/algorithm>
+#include <oneapi/dpl/numeric>
+
+#if _ENABLE_HOST_RANGES_TESTING
+#    include <oneapi/dpl/ranges>
+#endif
+
+#include "support/utils.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+#if _ENABLE_HOST_RANGES_TESTING
+namespace ranges = oneapi::dpl::experimental::ranges;
+
+// The lazy views are consumed by the algorithms directly, the intermediate sequences are never stored
+template <typename Policy>
+void
+test_pipelines(const Policy& exec, std::int64_t n)
+{
+    auto pipeline = ranges::views::iota(std::int64_t(0), 2 * n) |
+                    ranges::views::transform([](std::int64_t i) { return 3 * i + 1; }) | ranges::views::take(n);
+
+    const std::int64_t expected_sum = 3 * n * (n - 1) / 2 + n;
+    EXPECT_TRUE(ranges::reduce(exec, pipeline) == expected_sum, "wrong result of reduce over a view pipeline");
+    EXPECT_TRUE(ranges::transform_reduce(exec, pipeline, std::int64_t(0), std::plus<std::int64_t>(),
+                                         [](std::int64_t x) { return x % 7; }) ==
+                    std::transform_reduce(pipeline.begin(), pipeline.end(), std::int64_t(0), std::plus<std::int64_t>(),
+                                          [](std::int64_t x) { return x % 7; }),
+                "wrong result of transform_reduce over a view pipeline");
+
+    std::vector<std::int64_t> out(n, -1);
+    auto is_even = [](std::int64_t x) { return x % 2 == 0; };
+    const auto count = ranges::copy_if(exec, pipeline, out, is_even);
+    std::vector<std::int64_t> expected;
+    std::copy_if(pipeline.begin(), pipeline.end(), std::back_inserter(expected), is_even);
+    EXPECT_TRUE(count == std::int64_t(expected.size()), "wrong count of copy_if over a view pipeline");
+    EXPECT_TRUE(std::equal(expected.begin(), expected.end(), out.begin()),
+                "wrong effect of copy_if over a view pipeline");
+
+    std::vector<std::int64_t> scanned(n);
+    ranges::inclusive_scan(exec, pipeline, scanned);
+    std::vector<std::int64_t> expected_scan(n);
+    std::inclusive_scan(pipeline.begin(), pipeline.end(), expected_scan.begin());
+    EXPECT_TRUE(scanned == expected_scan, "wrong effect of inclusive_scan over a view pipeline");
+}
+
+template <typename Policy>
+void
+test_algorithms(const Policy& exec, std::int64_t n)
+{
+    std::vector<std::int64_t> v(n);
+    ranges::copy(exec, ranges::views::iota(std::int64_t(0), n) |
+                           ranges::views::transform([n](std::int64_t i) { return (i * 7919) % (n + 1); }),
+                 v);
+
+    EXPECT_TRUE(ranges::count_if(exec, v, [](std::int64_t x) { return x % 3 == 0; }) ==
+                    std::count_if(v.begin(), v.end(), [](std::int64_t x) { return x % 3 == 0; }),
+                "wrong result of count_if");
+    EXPECT_TRUE(ranges::find(exec, v, v[n / 2]) == std::find(v.begin(), v.end(), v[n / 2]) - v.begin(),
+                "wrong result of find");
+    EXPECT_TRUE(ranges::min_element(exec, v) == std::min_element(v.begin(), v.end()) - v.begin(),
+                "wrong result of min_element");
+    const auto minmax = ranges::minmax_element(exec, v);
+    const auto expected_minmax = std::minmax_element(v.begin(), v.end());
+    EXPECT_TRUE(minmax.first == expected_minmax.first - v.begin() &&
+                    minmax.second == expected_minmax.second - v.begin(),
+                "wrong result of minmax_element");
+
+    std::vector<std::int64_t> reversed = v;
+    ranges::reverse(exec, reversed);
+    EXPECT_TRUE(std::equal(v.rbegin(), v.rend(), reversed.begin()), "wrong effect of reverse");
+
+    std::vector<std::int64_t> sorted = v;
+    ranges::sort(exec, sorted);
+    EXPECT_TRUE(std::is_sorted(sorted.begin(), sorted.end()), "wrong effect of sort");
+    EXPECT_TRUE(ranges::equal(exec, reversed | ranges::views::reverse, v), "wrong result of equal");
+    EXPECT_TRUE(ranges::equal(exec, sorted, v) == std::is_sorted(v.begin(), v.end()), "wrong result of equal");
+
+    std::vector<std::int64_t> merged(2 * n);
+    EXPECT_TRUE(ranges::merge(exec, sorted, sorted, merged) == 2 * n, "wrong result of merge");
+    EXPECT_TRUE(std::is_sorted(merged.begin(), merged.end()), "wrong effect of merge");
+
+    std::vector<std::int64_t> uniq = merged;
+    const auto n_unique = ranges::unique(exec, uniq);
+    EXPECT_TRUE(n_unique == std::unique(merged.begin(), merged.end()) - merged.begin(), "wrong result of unique");
+
+    std::vector<std::int64_t> removed = v;
+    const auto n_kept = ranges::remove_if(exec, removed, [](std::int64_t x) { return x % 2 != 0; });
+    EXPECT_TRUE(n_kept == std::count_if(v.begin(), v.end(), [](std::int64_t x) { return x % 2 == 0; }),
+                "wrong result of remove_if");
+
+    std::vector<std::int64_t> a(n, 1), b(n, 2);
+    ranges::swap_ranges(exec, a, b);
+    EXPECT_TRUE(std::count(a.begin(), a.end(), 2) == n && std::count(b.begin(), b.end(), 1) == n,
+                "wrong effect of swap_ranges");
+
+    // Keys 0 0 0 1 1 1 ..., every segment sums the values 1
+    std::vector<std::int64_t> keys(n), vals(n, 1), out_keys(n), out_vals(n);
+    for (std::int64_t i = 0; i < n; ++i)
+        keys[i] = i / 3;
+    const auto n_segments = ranges::reduce_by_segment(exec, keys, vals, out_keys, out_vals);
+    EXPECT_TRUE(n_segments == (n + 2) / 3, "wrong result of reduce_by_segment");
+    EXPECT_TRUE(out_vals[0] == std::min<std::int64_t>(n, 3) && out_keys[n_segments - 1] == (n - 1) / 3,
+                "wrong effect of reduce_by_segment");
+}
+
+template <typename Policy>
+void
+test_policy(const Policy& exec)
+{
+    for (std::int64_t n : {1, 2, 17, 1000, 100000})
+    {
+        test_pipelines(exec, n);
+        test_algorithms(exec, n);
+    }
+}
+#endif //_ENABLE_HOST_RANGES_TESTING
+
+std::int32_t
+main()
+{
+#if _ENABLE_HOST_RANGES_TESTING
+    test_policy(oneapi::dpl::execution::seq);
+    test_policy(oneapi::dpl::execution::unseq);
+    test_policy(oneapi::dpl::execution::par);
+    test_policy(oneapi::dpl::execution::par_unseq);
+#endif //_ENABLE_HOST_RANGES_TESTING
+
+    return TestUtils::done(_ENABLE_HOST_RANGES_TESTING);
+}
@@ -0,0 +1,178 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#if !__SYCL_PSTL_OFFLOAD__
+#error "PSTL offload compiler mode should be enabled to run this test"
+#endif
+
+// ATTENTION: don't include oneDPL and unguarded standard headers
+// to guarantee that intercepting overloads of oneapi::dpl:: algorithms
+// appear before corresponding functions in oneDPL headers
+
+// The test checks that the standard parallel algorithms are offloaded for the sequences
+// reaching the threshold, and run with the host policy otherwise, counting the elements of
+// all the input sequences of the algorithm
+
+#define PSTL_OFFLOAD_MIN_ELEMENTS 100
+
+// Define guard to include only standard part of the header
+// without additional pstl offload part
+#define _ONEDPL_PSTL_OFFLOAD_TOP_LEVEL
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#undef _ONEDPL_PSTL_OFFLOAD_TOP_LEVEL
+
+namespace oneapi::dpl::execution {
+inline namespace v1 {
+
+template <typename T>
+struct is_execution_policy;
+
+} // inline namespace v1
+} // namespace oneapi::dpl::execution
+
+// An iterator giving the length of a sequence without a pass over it
+struct sized_iterator {
+    using difference_type = std::ptrdiff_t;
+    using value_type = int;
+    using pointer = int*;
+    using reference = int&;
+    using iterator_category = std::random_access_iterator_tag;
+
+    difference_type pos;
+
+    friend difference_type operator-(sized_iterator x, sized_iterator y) { return x.pos - y.pos; }
+};
+
+template <typename ExecutionPolicy, typename T = void>
+using test_enable_if_execution_policy = std::enable_if_t<
+    oneapi::dpl::execution::is_execution_policy<std::decay_t<ExecutionPolicy>>::value, T>;
+
+template <typename _ExecutionPolicy>
+void record_policy(const _ExecutionPolicy& exec);
+
+namespace oneapi::dpl {
+
+template <typename _ExecutionPolicy, typename _UnaryOperation>
+test_enable_if_execution_policy<_ExecutionPolicy, sized_iterator>
+transform(_ExecutionPolicy&& __exec, sized_iterator __first, sized_iterator __last, sized_iterator __result,
+          _UnaryOperation __op)
+{
+    record_policy(__exec);
+    return __result;
+}
+
+template <typename _ExecutionPolicy, typename _BinaryOperation>
+test_enable_if_execution_policy<_ExecutionPolicy, sized_iterator>
+transform(_ExecutionPolicy&& __exec, sized_iterator __first1, sized_iterator __last1, sized_iterator __first2,
+          sized_iterator __result, _BinaryOperation __op)
+{
+    record_policy(__exec);
+    return __result;
+}
+
+template <typename _ExecutionPolicy>
+test_enable_if_execution_policy<_ExecutionPolicy, bool>
+equal(_ExecutionPolicy&& __exec, sized_iterator __first1, sized_iterator __last1, sized_iterator __first2)
+{
+    record_policy(__exec);
+    return true;
+}
+
+template <typename _ExecutionPolicy>
+test_enable_if_execution_policy<_ExecutionPolicy, bool>
+equal(_ExecutionPolicy&& __exec, sized_iterator __first1, sized_iterator __last1, sized_iterator __first2,
+      sized_iterator __last2)
+{
+    record_policy(__exec);
+    return true;
+}
+
+template <typename _ExecutionPolicy>
+test_enable_if_execution_policy<_ExecutionPolicy, sized_iterator>
+merge(_ExecutionPolicy&& __exec, sized_iterator __first1, sized_iterator __last1, sized_iterator __first2,
+      sized_iterator __last2, sized_iterator __d_first)
+{
+    record_policy(__exec);
+    return __d_first;
+}
+
+} // namespace oneapi::dpl
+
+#include <oneapi/dpl/execution>
+
+#include <algorithm>
+#include <execution>
+
+#include <support/utils.h>
+
+enum class run_on { none, host, device };
+
+static run_on run_on_state = run_on::none;
+
+template <typename _T>
+struct is_device_policy_impl : std::false_type {};
+
+template <typename _KernelName>
+struct is_device_policy_impl<oneapi::dpl::execution::device_policy<_KernelName>> : std::true_type {};
+
+template <typename _ExecutionPolicy>
+void record_policy(const _ExecutionPolicy& __policy) {
+    EXPECT_TRUE(run_on_state == run_on::none, "run_on_state contains non empty value");
+    if constexpr (is_device_policy_impl<_ExecutionPolicy>::value) {
+        EXPECT_TRUE(__policy.queue().get_device() == TestUtils::get_pstl_offload_device(), "The passed policy is associated with the wrong device");
+        run_on_state = run_on::device;
+    } else {
+        static_assert(std::is_same_v<_ExecutionPolicy, oneapi::dpl::execution::parallel_unsequenced_policy>, "Algorithm was redirected with unexpected policy type");
+        run_on_state = run_on::host;
+    }
+}
+
+template <typename _RunAlgorithmBody>
+void test_run_on(run_on __expected, _RunAlgorithmBody __run_algorithm, const char* __message) {
+    __run_algorithm();
+    EXPECT_TRUE(run_on_state != run_on::none, "Algorithm was not redirected");
+    EXPECT_TRUE(run_on_state == __expected, __message);
+    run_on_state = run_on::none;
+}
+
+int main() {
+    auto it = [](std::ptrdiff_t pos) { return sized_iterator{pos}; };
+    auto unary_op = [](int x) { return x; };
+    auto binary_op = [](int x, int) { return x; };
+
+    test_run_on(run_on::host, [&] { std::transform(std::execution::par_unseq, it(0), it(99), it(0), unary_op); },
+                "transform of a sequence below the threshold is offloaded");
+    test_run_on(run_on::device, [&] { std::transform(std::execution::par_unseq, it(0), it(100), it(0), unary_op); },
+                "transform of a sequence reaching the threshold is not offloaded");
+
+    // The two input sequences of the same length count twice the elements of the first one
+    test_run_on(run_on::host, [&] { std::transform(std::execution::par_unseq, it(0), it(49), it(0), it(0), binary_op); },
+                "binary transform of the sequences below the threshold is offloaded");
+    test_run_on(run_on::device, [&] { std::transform(std::execution::par_unseq, it(0), it(50), it(0), it(0), binary_op); },
+                "binary transform of the sequences reaching the threshold is not offloaded");
+    test_run_on(run_on::host, [&] { std::equal(std::execution::par_unseq, it(0), it(49), it(0)); },
+                "equal of the sequences below the threshold is offloaded");
+    test_run_on(run_on::device, [&] { std::equal(std::execution::par_unseq, it(0), it(50), it(0)); },
+                "equal of the sequences reaching the threshold is not offloaded");
+
+    // The input sequences of their own lengths count the elements of both
+    test_run_on(run_on::host, [&] { std::equal(std::execution::par_unseq, it(0), it(60), it(0), it(39)); },
+                "equal of the sequences of their own lengths below the threshold is offloaded");
+    test_run_on(run_on::device, [&] { std::equal(std::execution::par_unseq, it(0), it(60), it(0), it(40)); },
+                "equal of the sequences of their own lengths reaching the threshold is not offloaded");
+    test_run_on(run_on::host, [&] { std::merge(std::execution::par_unseq, it(0), it(60), it(0), it(39), it(0)); },
+                "merge of the sequences below the threshold is offloaded");
+    test_run_on(run_on::device, [&] { std::merge(std::execution::par_unseq, it(0), it(60), it(0), it(40), it(0)); },
+                "merge of the sequences reaching the threshold is not offloaded");
+
+    return TestUtils::done();
+}
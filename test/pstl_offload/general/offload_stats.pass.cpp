@@ -0,0 +1,123 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#if !__SYCL_PSTL_OFFLOAD__
+#error "PSTL offload compiler mode should be enabled to run this test"
+#endif
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <execution>
+#include <string>
+#include <vector>
+
+#include "support/utils.h"
+
+// The statistics are enabled by the environment at the library load and printed at its unload, so the test runs
+// itself with PSTL_OFFLOAD_STATS and PSTL_OFFLOAD_TRACE set, and checks the summary and the trace it leaves
+
+static const char* summary_file_name = "offload_stats.summary.txt";
+static const char* trace_file_name = "offload_stats.trace.csv";
+
+// A call kept on the host by the default threshold, and an offloaded one
+constexpr std::size_t host_elements = 10;
+constexpr std::size_t device_elements = 1 << 20;
+
+static void run_algorithms() {
+    std::vector<int> host_data(host_elements, 1);
+    std::for_each(std::execution::par_unseq, host_data.begin(), host_data.end(), [](int& x) { ++x; });
+
+    std::vector<int> device_data(device_elements, 1);
+    std::for_each(std::execution::par_unseq, device_data.begin(), device_data.end(), [](int& x) { ++x; });
+}
+
+static void set_environment(const char* name, const char* value) {
+#if _WIN64
+    _putenv_s(name, value);
+#else
+    setenv(name, value, 1);
+#endif
+}
+
+static std::string read_file(const char* file_name) {
+    std::string content;
+    if (std::FILE* file = std::fopen(file_name, "r")) {
+        char buffer[256];
+        while (std::fgets(buffer, sizeof(buffer), file)) {
+            content += buffer;
+        }
+        std::fclose(file);
+    }
+    return content;
+}
+
+static void check_summary(const std::string& summary) {
+    EXPECT_TRUE(summary.find("PSTL offload statistics:") != std::string::npos, "No statistics summary printed");
+
+    const std::size_t pos = summary.find("\nfor_each ");
+    EXPECT_TRUE(pos != std::string::npos, "No statistics of for_each printed");
+    if (pos != std::string::npos) {
+        std::size_t calls = 0, host_calls = 0, elements = 0;
+        const int fields = std::sscanf(summary.c_str() + pos, " for_each %zu %zu %zu", &calls, &host_calls, &elements);
+        EXPECT_TRUE(fields == 3, "Wrong format of the statistics of for_each");
+        EXPECT_TRUE(calls == 2, "Wrong number of calls of for_each");
+        EXPECT_TRUE(host_calls == 1, "Wrong number of host calls of for_each");
+        EXPECT_TRUE(elements == host_elements + device_elements, "Wrong number of elements of for_each");
+    }
+
+    // the vectors are allocated in USM by the replaced allocation functions
+    const std::size_t usm_pos = summary.find("USM allocations: ");
+    EXPECT_TRUE(usm_pos != std::string::npos, "No statistics of USM allocations printed");
+    if (usm_pos != std::string::npos) {
+        std::size_t allocations = 0, bytes = 0;
+        std::sscanf(summary.c_str() + usm_pos, "USM allocations: %zu (%zu bytes)", &allocations, &bytes);
+        EXPECT_TRUE(allocations >= 2, "Wrong number of USM allocations");
+        EXPECT_TRUE(bytes >= device_elements * sizeof(int), "Wrong size of USM allocations");
+    }
+}
+
+static void check_trace(const std::string& trace) {
+    EXPECT_TRUE(trace.rfind("algorithm,elements,policy,start_ns,duration_ns\n", 0) == 0, "Wrong header of the trace");
+    EXPECT_TRUE(trace.find("\nfor_each," + std::to_string(host_elements) + ",host,") != std::string::npos,
+                "No trace of the host call of for_each");
+    EXPECT_TRUE(trace.find("\nfor_each," + std::to_string(device_elements) + ",device,") != std::string::npos,
+                "No trace of the offloaded call of for_each");
+}
+
+int main(int argc, char* argv[]) {
+    if (argc > 1 && std::strcmp(argv[1], "run_algorithms") == 0) {
+        run_algorithms();
+        return 0;
+    }
+
+    std::remove(summary_file_name);
+    std::remove(trace_file_name);
+    set_environment("PSTL_OFFLOAD_STATS", "1");
+    set_environment("PSTL_OFFLOAD_TRACE", trace_file_name);
+
+    std::string command = std::string("\"") + argv[0] + "\" run_algorithms 2> " + summary_file_name;
+#if _WIN64
+    // cmd.exe strips the outer quotes of the command
+    command = "\"" + command + "\"";
+#endif
+    EXPECT_TRUE(std::system(command.c_str()) == 0, "The test run with the statistics enabled failed");
+    // the statistics of this process are not enabled at its exit
+    set_environment("PSTL_OFFLOAD_STATS", "0");
+    set_environment("PSTL_OFFLOAD_TRACE", "");
+
+    check_summary(read_file(summary_file_name));
+    check_trace(read_file(trace_file_name));
+
+    std::remove(summary_file_name);
+    std::remove(trace_file_name);
+
+    return TestUtils::done();
+}
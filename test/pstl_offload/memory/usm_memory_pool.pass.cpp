@@ -0,0 +1,109 @@
+// -*- C++ -*-
+//===----------------------------------------------------------------------===//
+//
+// Copyright (C) Intel Corporation
+//
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#if !__SYCL_PSTL_OFFLOAD__
+#error "PSTL offload compiler mode should be enabled to run this test"
+#endif
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "sycl/sycl.hpp"
+
+#include "support/utils.h"
+
+#if __linux__
+#include <malloc.h>
+#endif
+
+// The small allocations come from the pool of USM shared blocks, kept by the thread caches
+
+static sycl::context memory_context = TestUtils::get_pstl_offload_device().get_platform().ext_oneapi_get_default_context();
+
+static void check_block(void* ptr, std::size_t size, const char* message) {
+    EXPECT_TRUE(ptr != nullptr, message);
+    EXPECT_TRUE(sycl::get_pointer_type(ptr, memory_context) == sycl::usm::alloc::shared, message);
+    EXPECT_TRUE(std::uintptr_t(ptr) % alignof(std::max_align_t) == 0, message);
+#if __linux__
+    EXPECT_TRUE(malloc_usable_size(ptr) >= size, message);
+#endif
+    std::memset(ptr, 0xAB, size);
+}
+
+static std::vector<void*> allocate_blocks(std::size_t count, std::size_t size) {
+    std::vector<void*> blocks(count);
+    for (void*& ptr : blocks) {
+        ptr = std::malloc(size);
+        check_block(ptr, size, "Wrong pooled block");
+    }
+    return blocks;
+}
+
+static void free_blocks(const std::vector<void*>& blocks) {
+    for (void* ptr : blocks) {
+        std::free(ptr);
+    }
+}
+
+int main() {
+    // allocation and release, in several size classes
+    for (std::size_t size : {1, 16, 100, 1000, 4000, 30000}) {
+        void* ptr = std::malloc(size);
+        check_block(ptr, size, "Wrong pooled block of malloc");
+        std::free(ptr);
+
+        ptr = ::operator new(size);
+        check_block(ptr, size, "Wrong pooled block of new");
+        ::operator delete(ptr);
+    }
+
+    // a released block is reused by the thread for the next allocation of its size class
+    {
+        void* ptr = std::malloc(100);
+        std::free(ptr);
+        void* reused = std::malloc(100);
+        EXPECT_TRUE(reused == ptr, "The released block was not reused");
+        check_block(reused, 100, "Wrong reused pooled block");
+
+        // realloc stays in the block within its size class
+        void* grown = std::realloc(reused, 110);
+        EXPECT_TRUE(grown == reused, "realloc within the size class did not keep the block");
+        std::free(grown);
+    }
+
+    // more blocks than the thread caches keep, released by another thread than the allocating one
+    {
+        std::vector<void*> blocks = allocate_blocks(1000, 200);
+        std::thread([&blocks] { free_blocks(blocks); }).join();
+
+        std::thread([&blocks] { blocks = allocate_blocks(1000, 200); }).join();
+        free_blocks(blocks);
+    }
+
+    // the threads return their cached blocks to the pool at their exit
+    {
+        std::vector<std::thread> threads;
+        for (int i = 0; i < 8; ++i) {
+            threads.emplace_back([] {
+                for (int j = 0; j < 10; ++j) {
+                    free_blocks(allocate_blocks(100, 64 * (j + 1)));
+                }
+            });
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+        free_blocks(allocate_blocks(1000, 64));
+    }
+
+    return TestUtils::done();
+}
@@ -13,6 +13,9 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <random>
+#include <vector>
+
 using namespace TestUtils;
 
 // TODO: replace data generation with random data and update check to compare result to
@@ -38,3 +41,43 @@ initialize_data(Accessor1 data, Accessor2 value, Accessor3 result, Size n)
         result[i / 2] = 0;
     }
 }
+
+// Compare the host search engine with the serial algorithm on random data: unsorted and sorted queries
+// against tables on both sides of the size threshold of the Eytzinger table layout
+template <typename T, typename Search, typename SerialSearch>
+void
+test_random_host_queries(Search search, SerialSearch serial_search)
+{
+    ::std::default_random_engine gen{42};
+    for (::std::size_t n : {::std::size_t(1000), ::std::size_t(300000)})
+    {
+        ::std::uniform_int_distribution<T> dist(0, n);
+        ::std::vector<T> data(n);
+        ::std::vector<T> value(n / 2);
+        for (auto& x : data)
+            x = dist(gen);
+        for (auto& x : value)
+            x = dist(gen);
+        ::std::sort(data.begin(), data.end());
+
+        ::std::vector<T> expected(value.size());
+        ::std::vector<T> result(value.size());
+        for (bool sorted_values : {false, true})
+        {
+            if (sorted_values)
+                ::std::sort(value.begin(), value.end());
+            for (::std::size_t i = 0; i < value.size(); ++i)
+                expected[i] = serial_search(data.begin(), data.end(), value[i]);
+
+            auto check = [&](auto&& exec) {
+                ::std::fill(result.begin(), result.end(), T(0));
+                search(exec, data.begin(), data.end(), value.begin(), value.end(), result.begin());
+                EXPECT_EQ_N(expected.begin(), result.begin(), result.size(), "wrong result on random data");
+            };
+            check(oneapi::dpl::execution::seq);
+            check(oneapi::dpl::execution::unseq);
+            check(oneapi::dpl::execution::par);
+            check(oneapi::dpl::execution::par_unseq);
+        }
+    }
+}
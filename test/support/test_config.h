@@ -117,6 +117,17 @@
 #endif
 #endif //!defined(_ENABLE_RANGES_TESTING)
 
+// The range-based API with the host policies does not depend on the DPC++ backend
+#if !defined(_ENABLE_HOST_RANGES_TESTING)
+#if defined(_GLIBCXX_RELEASE)
+#    define _ENABLE_HOST_RANGES_TESTING (_GLIBCXX_RELEASE >= 8 && __GLIBCXX__ >= 20180502)
+#elif defined(_LIBCPP_VERSION)
+#    define _ENABLE_HOST_RANGES_TESTING (_LIBCPP_VERSION >= 7000)
+#else
+#    define _ENABLE_HOST_RANGES_TESTING 1
+#endif
+#endif //!defined(_ENABLE_HOST_RANGES_TESTING)
+
 #define TEST_HAS_NO_INT128
 #define _PSTL_TEST_COMPLEX_NON_FLOAT_AVAILABLE (_MSVC_STL_VERSION < 143)
 